@@ -0,0 +1,116 @@
+/**
+ * @file arbiter_benchmark.cpp
+ * @author Kevin Rodrigues
+ * @brief Cost of a rejected duplicate against a full parse, and two-connection arbitration
+ * @version 1.0
+ * @date 16/10/2026
+ */
+
+#include <chrono>
+#include <random>
+#include <string>
+#include <vector>
+#include <benchmark/benchmark.h>
+
+#include <faster_parser/binance/arbiter.h>
+#include <faster_parser/binance/listeners/sequence_checker.h>
+
+using namespace core::faster_parser::binance;
+using namespace core::faster_parser::binance::types;
+
+namespace {
+    constexpr size_t symbol_count = 300;
+    constexpr size_t message_count = 20'000;
+
+    // bookTicker stream over 300 symbols, update ids increasing per symbol
+    struct fixture_t {
+        std::vector<std::string> messages;
+
+        fixture_t() {
+            std::mt19937_64 rng(11);
+            std::uniform_int_distribution<size_t> pick(0, symbol_count - 1);
+            std::vector<uint64_t> update_ids(symbol_count, 8822354685185ULL);
+            for (size_t m = 0; m < message_count; ++m) {
+                const size_t s = pick(rng);
+                update_ids[s] += 1 + m % 5;
+                messages.push_back(R"({"e":"bookTicker","u":)" + std::to_string(update_ids[s]) + R"(,"s":"SYM)" + std::to_string(s) +
+                                   R"(USDT","b":"1.5822000","B":"457","a":"1.5823000","A":"112","T":1760083106579,"E":1760083106579})");
+            }
+        }
+    };
+
+    const fixture_t fixture;
+
+    struct sink_t {
+        uint64_t sum = 0;
+        void on_book_ticker(const book_ticker_t &ticker) { sum += ticker.bid.sequence; }
+    };
+}
+
+// ============================================================================
+// One message (items = messages)
+// ============================================================================
+
+static void bm_arbiter_rejected_duplicate(benchmark::State &state) {
+    sink_t sink;
+    feed_arbiter_t arbiter(symbol_count);
+    const auto now = std::chrono::system_clock::now();
+    for (auto const &message : fixture.messages) arbiter.parse(now, message, sink);
+    for (auto _ : state) {
+        for (auto const &message : fixture.messages) {
+            benchmark::DoNotOptimize(arbiter.parse(now, message, sink));
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * message_count));
+    if (arbiter.accepted() != message_count) state.SkipWithError("duplicate accepted");
+}
+
+static void bm_process_book_ticker(benchmark::State &state) {
+    sink_t sink;
+    const auto now = std::chrono::system_clock::now();
+    for (auto _ : state) {
+        for (auto const &message : fixture.messages) {
+            benchmark::DoNotOptimize(binance_future_parser_t::process_book_ticker(now, message, sink));
+        }
+    }
+    benchmark::DoNotOptimize(sink.sum);
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * message_count));
+}
+
+// ============================================================================
+// Two identical connections, every message received twice (items = received messages)
+// ============================================================================
+
+static void bm_arbiter_two_connections(benchmark::State &state) {
+    sink_t sink;
+    const auto now = std::chrono::system_clock::now();
+    for (auto _ : state) {
+        feed_arbiter_t arbiter(symbol_count);
+        for (auto const &message : fixture.messages) {
+            arbiter.parse(now, message, sink);
+            arbiter.parse(now, message, sink);
+        }
+    }
+    benchmark::DoNotOptimize(sink.sum);
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * message_count * 2));
+}
+
+// Baseline: parse both copies, then drop the stale one by update id
+static void bm_parse_both_then_dedupe(benchmark::State &state) {
+    sink_t sink;
+    const auto now = std::chrono::system_clock::now();
+    for (auto _ : state) {
+        listeners::sequence_checker_t checker(sink, symbol_count, true);
+        for (auto const &message : fixture.messages) {
+            binance_future_parser_t::parse(now, message, checker);
+            binance_future_parser_t::parse(now, message, checker);
+        }
+    }
+    benchmark::DoNotOptimize(sink.sum);
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * message_count * 2));
+}
+
+BENCHMARK(bm_arbiter_rejected_duplicate)->Unit(benchmark::kMicrosecond);
+BENCHMARK(bm_process_book_ticker)->Unit(benchmark::kMicrosecond);
+BENCHMARK(bm_arbiter_two_connections)->Unit(benchmark::kMicrosecond);
+BENCHMARK(bm_parse_both_then_dedupe)->Unit(benchmark::kMicrosecond);
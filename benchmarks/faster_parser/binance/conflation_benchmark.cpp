@@ -0,0 +1,146 @@
+/**
+ * @file conflation_benchmark.cpp
+ * @author Kevin Rodrigues
+ * @brief Producer cost and consumer drain latency of the per-symbol conflating cache
+ * @version 1.0
+ * @date 16/10/2026
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+#include <benchmark/benchmark.h>
+
+#include <faster_parser/binance/listeners/conflation.h>
+
+using namespace core::faster_parser::binance;
+using namespace core::faster_parser::binance::types;
+
+namespace {
+    constexpr size_t symbol_count = 300;
+    constexpr size_t paced_rate = 1'000'000;                    // Updates per second
+    constexpr auto paced_duration = std::chrono::milliseconds(200);
+
+    struct fixture_t {
+        std::vector<std::string> names;
+        std::vector<book_ticker_t> tickers;
+
+        fixture_t() {
+            for (size_t i = 0; i < symbol_count; ++i) names.push_back("SYM" + std::to_string(i) + "USDT");
+            for (size_t i = 0; i < symbol_count; ++i) {
+                book_ticker_t ticker;
+                ticker.symbol = names[i];
+                ticker.bid.price = 100. + static_cast<double>(i);
+                ticker.ask.price = 100.5 + static_cast<double>(i);
+                tickers.push_back(ticker);
+            }
+        }
+    };
+
+    const fixture_t fixture;
+}
+
+// ============================================================================
+// Producer: cost of one conflated update
+// ============================================================================
+
+static void bm_conflation_produce(benchmark::State &state) {
+    listeners::conflating_cache_t cache(symbol_count);
+    uint64_t update_id = 0;
+    for (auto _ : state) {
+        for (auto ticker : fixture.tickers) {
+            ticker.bid.sequence = ++update_id;
+            cache.on_book_ticker(ticker);
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * symbol_count));
+}
+
+// ============================================================================
+// Consumer: one drain with `dirty` of the 300 symbols updated
+// ============================================================================
+
+static void bm_conflation_drain(benchmark::State &state) {
+    const auto dirty = static_cast<size_t>(state.range(0));
+    listeners::conflating_cache_t cache(symbol_count);
+    for (auto const &ticker : fixture.tickers) cache.on_book_ticker(ticker);
+    cache.drain_book_tickers([](symbol_id_t, auto const &) {});
+
+    double sum = 0;
+    for (auto _ : state) {
+        state.PauseTiming();
+        for (size_t i = 0; i < dirty; ++i) cache.on_book_ticker(fixture.tickers[i * symbol_count / dirty]);
+        state.ResumeTiming();
+        cache.drain_book_tickers([&](symbol_id_t, listeners::conflating_cache_t::book_ticker_entry_t const &entry) {
+            sum += entry.value.bid_price;
+        });
+    }
+    benchmark::DoNotOptimize(sum);
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * dirty));
+}
+
+// ============================================================================
+// Paced: producer thread at 1M updates/s over 300 symbols, consumer draining in a loop
+// Reports how old the drained values are (now - receive time) and the conflation ratio.
+// ============================================================================
+
+static void bm_conflation_paced(benchmark::State &state) {
+    std::vector<uint64_t> staleness;
+    uint64_t produced = 0, delivered = 0;
+
+    for (auto _ : state) {
+        listeners::conflating_cache_t cache(symbol_count);
+        std::atomic<bool> done{false};
+        staleness.clear();
+
+        std::thread producer([&] {
+            const auto start = std::chrono::steady_clock::now();
+            uint64_t sent = 0;
+            while (true) {
+                const auto elapsed = std::chrono::steady_clock::now() - start;
+                if (elapsed >= paced_duration) break;
+                const auto due = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()) *
+                                 paced_rate / 1'000'000'000;
+                const auto now = std::chrono::system_clock::now();
+                for (; sent < due; ++sent) {
+                    book_ticker_t ticker = fixture.tickers[sent % symbol_count];
+                    ticker.bid.sequence = sent;
+                    ticker.time = now;
+                    cache.on_book_ticker(ticker);
+                }
+            }
+            produced += sent;
+            done.store(true, std::memory_order_release);
+        });
+
+        auto on_entry = [&](symbol_id_t, listeners::conflating_cache_t::book_ticker_entry_t const &entry) {
+            staleness.push_back(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::system_clock::now() - std::chrono::system_clock::time_point(
+                    std::chrono::system_clock::duration(entry.receive_time))).count()));
+        };
+        while (!done.load(std::memory_order_acquire)) {
+            if (cache.drain_book_tickers(on_entry) == 0) std::this_thread::yield();
+        }
+        producer.join();
+        cache.drain_book_tickers(on_entry);
+        delivered += staleness.size();
+    }
+
+    std::sort(staleness.begin(), staleness.end());
+    if (!staleness.empty()) {
+        state.counters["p50_ns"] = static_cast<double>(staleness[staleness.size() / 2]);
+        state.counters["p99_ns"] = static_cast<double>(staleness[staleness.size() * 99 / 100]);
+    }
+    state.counters["updates/delivered"] = delivered ? static_cast<double>(produced) / static_cast<double>(delivered) : 0.;
+}
+
+// ============================================================================
+// Register Benchmarks
+// ============================================================================
+
+BENCHMARK(bm_conflation_produce);
+BENCHMARK(bm_conflation_drain)->ArgName("dirty")->Arg(1)->Arg(30)->Arg(300);
+BENCHMARK(bm_conflation_paced)->Unit(benchmark::kMillisecond)->UseRealTime()->Iterations(3);
@@ -0,0 +1,157 @@
+/**
+ * @file deflate_benchmark.cpp
+ * @author Kevin Rodrigues
+ * @brief Benchmarks for permessage-deflate: inflate cost per message vs bytes saved on the wire
+ * @version 1.0
+ * @date 16/10/2026
+ */
+
+#include <chrono>
+#include <string>
+#include <vector>
+#include <benchmark/benchmark.h>
+
+#include <faster_parser/binance/websocket.h>
+#include <faster_parser/websocket/deflate.h>
+#include <faster_parser/websocket/frame.h>
+
+using namespace core::faster_parser::binance;
+using namespace core::faster_parser::binance::types;
+using namespace core::faster_parser::websocket;
+
+class BenchmarkListener {
+public:
+    book_ticker_t last_book_ticker;
+    trade_t last_trade;
+    ticker_t last_ticker;
+
+    void on_book_ticker(const book_ticker_t& ticker) {
+        last_book_ticker = ticker;
+    }
+
+    void on_trade(const trade_t& trade) {
+        last_trade = trade;
+    }
+
+    void on_ticker(const ticker_t& ticker) {
+        last_ticker = ticker;
+    }
+};
+
+const std::vector<std::string> messages = {
+    R"({"e":"bookTicker","u":8822354685185,"s":"ASTERUSDT","b":"1.5822000","B":"457","a":"1.5823000","A":"112","T":1760083106579,"E":1760083106579})",
+    R"({"e":"aggTrade","E":123456789,"s":"BTCUSDT","a":5933014,"p":"0.001","q":"100","f":100,"l":105,"T":123456785,"m":true})",
+    R"({"e":"bookTicker","u":123456789,"s":"BTCUSDT","b":"45123.78900000","B":"10.5","a":"45124.12300000","A":"5.25","T":1234567890123,"E":1234567890123})",
+    R"({"e":"24hrTicker","E":123456789,"s":"BTCUSDT","p":"0.0015","P":"250.00","w":"0.0018","c":"0.0025","Q":"10","o":"0.0010","h":"0.0025","l":"0.0010","v":"10000","q":"18","O":0,"C":86400000,"F":0,"L":18150,"n":18151})",
+};
+
+constexpr size_t frames_per_buffer = 10'000;
+
+struct corpus_t {
+    std::string frames;
+    size_t raw_bytes = 0;   // JSON bytes before compression
+};
+
+// Server frames as a permessage-deflate peer would send them. Sequence numbers and
+// timestamps vary per message so back references cannot cover whole messages.
+static corpus_t make_corpus(bool compressed, bool no_context_takeover) {
+    corpus_t corpus;
+    deflater_t deflater(15, 6, no_context_takeover);
+    std::string payload;
+    for (size_t i = 0; i < frames_per_buffer; ++i) {
+        std::string message = messages[i % messages.size()];
+        const std::string tag = std::to_string(123456789 + i);
+        if (size_t pos = message.find("123456789"); pos != std::string::npos) message.replace(pos, 9, tag);
+        corpus.raw_bytes += message.size();
+
+        if (compressed) {
+            deflater.deflate(message, payload);
+            encode_frame(corpus.frames, opcode_t::text, payload, 0, true, true);
+        } else {
+            encode_frame(corpus.frames, opcode_t::text, message);
+        }
+    }
+    return corpus;
+}
+
+static void set_counters(benchmark::State &state, corpus_t const &corpus) {
+    state.SetItemsProcessed(state.iterations() * frames_per_buffer);
+    state.SetBytesProcessed(state.iterations() * corpus.raw_bytes);
+    state.counters["wire_bytes/msg"] = static_cast<double>(corpus.frames.size()) / frames_per_buffer;
+    state.counters["wire_ratio"] = static_cast<double>(corpus.frames.size()) / static_cast<double>(corpus.raw_bytes);
+    state.counters["time/msg"] = benchmark::Counter(static_cast<double>(frames_per_buffer),
+                                                  benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert,
+                                                  benchmark::Counter::OneK::kIs1000);
+}
+
+// ============================================================================
+// Decode + parse, plain vs compressed
+// ============================================================================
+
+static void bm_websocket_plain(benchmark::State &state) {
+    corpus_t corpus = make_corpus(false, false);
+    BenchmarkListener listener;
+    websocket_feed_t feed(listener);
+    auto now = std::chrono::system_clock::now();
+
+    for (auto _ : state) {
+        size_t consumed = feed.feed(now, std::span(corpus.frames.data(), corpus.frames.size()));
+        benchmark::DoNotOptimize(consumed);
+        benchmark::DoNotOptimize(listener.last_trade);
+    }
+
+    set_counters(state, corpus);
+}
+
+// Arg: 1 = server_no_context_takeover (window reset after every message)
+static void bm_websocket_deflate(benchmark::State &state) {
+    const bool no_context_takeover = state.range(0) != 0;
+    corpus_t corpus = make_corpus(true, no_context_takeover);
+    BenchmarkListener listener;
+    websocket_feed_t feed(listener);
+    feed.enable_permessage_deflate(15, no_context_takeover);
+    auto now = std::chrono::system_clock::now();
+
+    for (auto _ : state) {
+        // The window must start empty, as at the start of the captured stream
+        feed.reset();
+        size_t consumed = feed.feed(now, std::span(corpus.frames.data(), corpus.frames.size()));
+        benchmark::DoNotOptimize(consumed);
+        benchmark::DoNotOptimize(listener.last_trade);
+    }
+
+    if (feed.rejected() != 0 || feed.failed()) state.SkipWithError("compressed corpus did not parse");
+    set_counters(state, corpus);
+}
+
+// Inflate alone, to separate decompression from parsing
+static void bm_inflate_only(benchmark::State &state) {
+    deflater_t deflater(15, 6, false);
+    std::vector<std::string> payloads(frames_per_buffer);
+    size_t raw_bytes = 0;
+    for (size_t i = 0; i < frames_per_buffer; ++i) {
+        deflater.deflate(messages[i % messages.size()], payloads[i]);
+        raw_bytes += messages[i % messages.size()].size();
+    }
+
+    for (auto _ : state) {
+        inflater_t inflater;
+        for (auto const &payload : payloads) {
+            std::string_view out;
+            bool ok = inflater.inflate(payload, out);
+            benchmark::DoNotOptimize(ok);
+            benchmark::DoNotOptimize(out.data());
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * frames_per_buffer);
+    state.SetBytesProcessed(state.iterations() * raw_bytes);
+}
+
+// ============================================================================
+// Register Benchmarks
+// ============================================================================
+
+BENCHMARK(bm_websocket_plain);
+BENCHMARK(bm_websocket_deflate)->Arg(0)->Arg(1);
+BENCHMARK(bm_inflate_only);
@@ -0,0 +1,280 @@
+/**
+ * @file event_types_benchmark.cpp
+ * @author Kevin Rodrigues
+ * @brief Enqueue cost and queue bandwidth of the Binance event layouts
+ * @version 1.0
+ * @date 16/10/2026
+ */
+
+#include <chrono>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include <benchmark/benchmark.h>
+
+#include <faster_parser/binance/future.h>
+#include <faster_parser/binance/types/compact.h>
+
+using namespace core::faster_parser::binance;
+using namespace core::faster_parser::binance::types;
+
+const std::vector<std::string> book_ticker_messages = {
+    R"({"e":"bookTicker","u":8822354685185,"s":"ASTERUSDT","b":"1.5822000","B":"457","a":"1.5823000","A":"112","T":1760083106579,"E":1760083106579})",
+    R"({"e":"bookTicker","u":123456789,"s":"BTCUSDT","b":"45123.78900000","B":"10.5","a":"45124.12300000","A":"5.25","T":1234567890123,"E":1234567890123})",
+    R"({"e":"bookTicker","u":999999,"s":"DOGEUSDT","b":"0.00012345","B":"1000000","a":"0.00012346","A":"999999","T":9999999999,"E":9999999999})",
+    R"({"e":"bookTicker","u":111111111,"s":"ETHUSDT","b":"3000","B":"100","a":"3001","A":"200","T":1111111111111,"E":1111111111111})",
+    R"({"e":"bookTicker","u":555555,"s":"ADAUSDT","b":"0.45678","B":"5000","a":"0.45679","A":"4500","T":555555555,"E":555555555})",
+    R"({"e":"bookTicker","u":666666,"s":"SOLUSDT","b":"123.456","B":"25.5","a":"123.457","A":"30.25","T":666666666,"E":666666666})",
+};
+
+const std::vector<std::string> agg_trade_messages = {
+    R"({"e":"aggTrade","E":123456789,"s":"BTCUSDT","a":5933014,"p":"0.001","q":"100","f":100,"l":105,"T":123456785,"m":true})",
+    R"({"e":"aggTrade","E":987654321,"s":"ETHUSDT","a":8888888,"p":"3500.50","q":"10.5","f":200,"l":210,"T":987654320,"m":false})",
+    R"({"e":"aggTrade","E":111111111,"s":"DOGEUSDT","a":99999,"p":"0.00012345","q":"1000000","f":50000,"l":50010,"T":111111110,"m":true})",
+    R"({"e":"aggTrade","E":333333333,"s":"ADAUSDT","a":123456,"p":"0.45","q":"5000","f":100000,"l":100050,"T":333333332,"m":false})",
+};
+
+constexpr size_t queue_capacity = 4096;
+
+// Pre-allocated slots standing in for a cross-thread queue: only the copy into the slot is measured
+template<typename slot_t>
+struct slot_queue_t {
+    std::vector<slot_t> slots = std::vector<slot_t>(queue_capacity);
+    size_t head = 0;
+
+    slot_t &next() {
+        return slots[head++ & (queue_capacity - 1)];
+    }
+};
+
+// Hand-rolled handoff: copy the symbol into a std::string owned by the slot
+struct book_ticker_string_slot_t {
+    std::string symbol;
+    book_ticker_t ticker;
+};
+
+class StringCopyListener {
+public:
+    slot_queue_t<book_ticker_string_slot_t> queue;
+
+    void on_book_ticker(const book_ticker_t &ticker) {
+        auto &slot = queue.next();
+        slot.symbol.assign(ticker.symbol);
+        slot.ticker = ticker;
+        slot.ticker.symbol = slot.symbol;
+    }
+
+    void on_trade(const trade_t &) {}
+
+    void on_ticker(const ticker_t &) {}
+};
+
+// Hand-rolled handoff: intern the symbol through a hash map and queue the interned id
+struct book_ticker_interned_slot_t {
+    uint32_t symbol_id;
+    book_ticker_t ticker;
+};
+
+class InternListener {
+public:
+    slot_queue_t<book_ticker_interned_slot_t> queue;
+    std::unordered_map<std::string, uint32_t> symbols;
+
+    void on_book_ticker(const book_ticker_t &ticker) {
+        auto &slot = queue.next();
+        auto it = symbols.find(std::string(ticker.symbol));
+        if (it == symbols.end()) {
+            it = symbols.emplace(std::string(ticker.symbol), static_cast<uint32_t>(symbols.size())).first;
+        }
+        slot.symbol_id = it->second;
+        slot.ticker = ticker;
+        slot.ticker.symbol = {};
+    }
+
+    void on_trade(const trade_t &) {}
+
+    void on_ticker(const ticker_t &) {}
+};
+
+class OwnedListener {
+public:
+    slot_queue_t<book_ticker_owned_t> book_tickers;
+    slot_queue_t<trade_owned_t> trades;
+
+    void on_book_ticker(const book_ticker_t &ticker) {
+        book_tickers.next() = book_ticker_owned_t(ticker);
+    }
+
+    void on_trade(const trade_t &trade) {
+        trades.next() = trade_owned_t(trade);
+    }
+
+    void on_ticker(const ticker_t &) {}
+};
+
+template<typename listener_t>
+static void run_book_ticker_enqueue(benchmark::State &state) {
+    listener_t listener;
+    auto now = std::chrono::system_clock::now();
+    size_t index = 0;
+
+    for (auto _ : state) {
+        const auto &message = book_ticker_messages[index % book_ticker_messages.size()];
+        bool result = binance_future_parser_t::parse(now, message, listener);
+        benchmark::DoNotOptimize(result);
+        ++index;
+    }
+
+    benchmark::DoNotOptimize(listener);
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void bm_enqueue_book_ticker_string_copy(benchmark::State &state) {
+    run_book_ticker_enqueue<StringCopyListener>(state);
+}
+
+static void bm_enqueue_book_ticker_interned(benchmark::State &state) {
+    run_book_ticker_enqueue<InternListener>(state);
+}
+
+static void bm_enqueue_book_ticker_owned(benchmark::State &state) {
+    run_book_ticker_enqueue<OwnedListener>(state);
+}
+
+static void bm_enqueue_agg_trade_owned(benchmark::State &state) {
+    OwnedListener listener;
+    auto now = std::chrono::system_clock::now();
+    size_t index = 0;
+
+    for (auto _ : state) {
+        const auto &message = agg_trade_messages[index % agg_trade_messages.size()];
+        bool result = binance_future_parser_t::parse(now, message, listener);
+        benchmark::DoNotOptimize(result);
+        ++index;
+    }
+
+    benchmark::DoNotOptimize(listener);
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void bm_symbol_from_string_view(benchmark::State &state) {
+    std::string_view message = book_ticker_messages[1];
+    std::string_view symbol = message.substr(message.find("BTCUSDT"), 7);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(symbol);
+        symbol_t owned = symbol_t::from(symbol);
+        benchmark::DoNotOptimize(owned);
+    }
+}
+
+// ============================================================================
+// Queue bandwidth: millions of events pushed through a ring larger than the LLC
+// ============================================================================
+
+constexpr size_t bandwidth_queue_capacity = 1 << 20;
+constexpr size_t bandwidth_batch = 256;
+
+struct parsed_events_t {
+    std::vector<book_ticker_t> book_tickers;
+    std::vector<trade_t> trades;
+    std::vector<ticker_t> tickers;
+
+    void on_book_ticker(const book_ticker_t &ticker) { book_tickers.push_back(ticker); }
+    void on_trade(const trade_t &trade) { trades.push_back(trade); }
+    void on_ticker(const ticker_t &ticker) { tickers.push_back(ticker); }
+};
+
+static const parsed_events_t &parsed_events() {
+    static const parsed_events_t events = [] {
+        parsed_events_t parsed;
+        auto now = std::chrono::system_clock::now();
+        for (const auto &message : book_ticker_messages) binance_future_parser_t::parse(now, message, parsed);
+        for (const auto &message : agg_trade_messages) binance_future_parser_t::parse(now, message, parsed);
+        binance_future_parser_t::parse(now, std::string_view(R"({"e":"24hrTicker","E":123456789,"s":"BTCUSDT","p":"0.0015","P":"250.00","w":"0.0018","c":"0.0025","Q":"10","o":"0.0010","h":"0.0025","l":"0.0010","v":"10000","q":"18","O":0,"C":86400000,"F":0,"L":18150,"n":18151})"), parsed);
+        return parsed;
+    }();
+    return events;
+}
+
+template<typename slot_t, typename event_t>
+static void run_queue_bandwidth(benchmark::State &state, std::vector<event_t> const &events) {
+    // Conversion cost is covered by the enqueue benchmarks: only move bytes here
+    std::vector<slot_t> sources(events.begin(), events.end());
+    std::vector<slot_t> queue(bandwidth_queue_capacity);
+    size_t head = 0;
+    size_t tail = 0;
+    uint64_t checksum = 0;
+
+    for (auto _ : state) {
+        for (size_t i = 0; i < bandwidth_batch; ++i) {
+            queue[head++ & (bandwidth_queue_capacity - 1)] = sources[i % sources.size()];
+        }
+        for (size_t i = 0; i < bandwidth_batch; ++i) {
+            // Touch both ends of the slot as a consumer would
+            const slot_t &slot = queue[tail++ & (bandwidth_queue_capacity - 1)];
+            uint64_t first, last;
+            std::memcpy(&first, &slot, sizeof(first));
+            std::memcpy(&last, reinterpret_cast<const char *>(&slot) + sizeof(slot_t) - sizeof(last), sizeof(last));
+            checksum += first ^ last;
+        }
+    }
+
+    benchmark::DoNotOptimize(checksum);
+    state.SetItemsProcessed(state.iterations() * bandwidth_batch);
+    state.SetBytesProcessed(state.iterations() * bandwidth_batch * sizeof(slot_t));
+    state.counters["slot_bytes"] = sizeof(slot_t);
+}
+
+static void bm_queue_bandwidth_book_ticker_view(benchmark::State &state) {
+    run_queue_bandwidth<book_ticker_t>(state, parsed_events().book_tickers);
+}
+
+static void bm_queue_bandwidth_book_ticker_owned(benchmark::State &state) {
+    run_queue_bandwidth<book_ticker_owned_t>(state, parsed_events().book_tickers);
+}
+
+static void bm_queue_bandwidth_book_ticker_compact(benchmark::State &state) {
+    run_queue_bandwidth<book_ticker_compact_t>(state, parsed_events().book_tickers);
+}
+
+static void bm_queue_bandwidth_trade_view(benchmark::State &state) {
+    run_queue_bandwidth<trade_t>(state, parsed_events().trades);
+}
+
+static void bm_queue_bandwidth_trade_owned(benchmark::State &state) {
+    run_queue_bandwidth<trade_owned_t>(state, parsed_events().trades);
+}
+
+static void bm_queue_bandwidth_trade_compact(benchmark::State &state) {
+    run_queue_bandwidth<trade_compact_t>(state, parsed_events().trades);
+}
+
+static void bm_queue_bandwidth_ticker_view(benchmark::State &state) {
+    run_queue_bandwidth<ticker_t>(state, parsed_events().tickers);
+}
+
+static void bm_queue_bandwidth_ticker_compact(benchmark::State &state) {
+    run_queue_bandwidth<ticker_compact_t>(state, parsed_events().tickers);
+}
+
+// ============================================================================
+// Register Benchmarks
+// ============================================================================
+
+BENCHMARK(bm_enqueue_book_ticker_string_copy);
+BENCHMARK(bm_enqueue_book_ticker_interned);
+BENCHMARK(bm_enqueue_book_ticker_owned);
+BENCHMARK(bm_enqueue_agg_trade_owned);
+BENCHMARK(bm_symbol_from_string_view);
+
+BENCHMARK(bm_queue_bandwidth_book_ticker_view);
+BENCHMARK(bm_queue_bandwidth_book_ticker_owned);
+BENCHMARK(bm_queue_bandwidth_book_ticker_compact);
+BENCHMARK(bm_queue_bandwidth_trade_view);
+BENCHMARK(bm_queue_bandwidth_trade_owned);
+BENCHMARK(bm_queue_bandwidth_trade_compact);
+BENCHMARK(bm_queue_bandwidth_ticker_view);
+BENCHMARK(bm_queue_bandwidth_ticker_compact);
@@ -7,10 +7,12 @@
  */
 
 #include <chrono>
+#include <cstring>
 #include <string>
 #include <vector>
 #include <benchmark/benchmark.h>
 
+#include <faster_parser/binance/cursor.h>
 #include <faster_parser/binance/future.h>
 
 using namespace core::faster_parser::binance;
@@ -35,6 +37,16 @@ public:
     }
 };
 
+// Only implements on_trade: bookTicker and 24hrTicker dispatch is compiled out of the parser
+class TradeOnlyListener {
+public:
+    trade_t last_trade;
+
+    void on_trade(const trade_t& trade) {
+        last_trade = trade;
+    }
+};
+
 const std::vector<std::string> book_ticker_messages = {
     R"({"e":"bookTicker","u":8822354685185,"s":"ASTERUSDT","b":"1.5822000","B":"457","a":"1.5823000","A":"112","T":1760083106579,"E":1760083106579})",
     R"({"e":"bookTicker","u":123456789,"s":"BTCUSDT","b":"45123.78900000","B":"10.5","a":"45124.12300000","A":"5.25","T":1234567890123,"E":1234567890123})",
@@ -442,6 +454,117 @@ static void bm_binance_future_mixed_messages(benchmark::State &state) {
     }
 }
 
+static void bm_binance_future_mixed_messages_trade_only(benchmark::State &state) {
+    TradeOnlyListener listener;
+    auto now = std::chrono::system_clock::now();
+    size_t book_index = 0;
+    size_t trade_index = 0;
+    size_t ticker_index = 0;
+
+    for (auto _ : state) {
+        // Same rotation as bm_binance_future_mixed_messages, book tickers and tickers are rejected
+        size_t msg_type = state.iterations() % 3;
+        if (msg_type == 0) {
+            const auto& message = book_ticker_messages[book_index % book_ticker_messages.size()];
+            bool result = binance_future_parser_t::parse(now, message, listener);
+            benchmark::DoNotOptimize(result);
+            ++book_index;
+        } else if (msg_type == 1) {
+            const auto& message = agg_trade_messages[trade_index % agg_trade_messages.size()];
+            bool result = binance_future_parser_t::parse(now, message, listener);
+            benchmark::DoNotOptimize(result);
+            benchmark::DoNotOptimize(listener.last_trade);
+            ++trade_index;
+        } else {
+            const auto& message = ticker_messages[ticker_index % ticker_messages.size()];
+            bool result = binance_future_parser_t::parse(now, message, listener);
+            benchmark::DoNotOptimize(result);
+            ++ticker_index;
+        }
+    }
+}
+
+// ============================================================================
+// Buffer Replay Benchmarks (push listener vs pull cursor)
+// ============================================================================
+
+// 1M newline-delimited messages cycling through book tickers, trades and tickers
+static const std::string &replay_buffer() {
+    static const std::string buffer = [] {
+        std::string out;
+        for (size_t i = 0; i < 1'000'000; ++i) {
+            switch (i % 3) {
+                case 0: out += book_ticker_messages[i % book_ticker_messages.size()]; break;
+                case 1: out += agg_trade_messages[i % agg_trade_messages.size()]; break;
+                default: out += ticker_messages[i % ticker_messages.size()]; break;
+            }
+            out += '\n';
+        }
+        return out;
+    }();
+    return buffer;
+}
+
+class SummingListener {
+public:
+    double sum = 0;
+
+    void on_book_ticker(const book_ticker_t& ticker) {
+        sum += ticker.bid.price;
+    }
+
+    void on_trade(const trade_t& trade) {
+        sum += trade.price;
+    }
+
+    void on_ticker(const ticker_t& ticker) {
+        sum += ticker.last_price;
+    }
+};
+
+static void bm_binance_future_replay_listener(benchmark::State &state) {
+    const std::string &buffer = replay_buffer();
+    auto now = std::chrono::system_clock::now();
+
+    for (auto _ : state) {
+        SummingListener listener;
+        const char *ptr = buffer.data();
+        const char *end = buffer.data() + buffer.size();
+        while (ptr < end) {
+            const char *line_end = static_cast<const char *>(std::memchr(ptr, '\n', end - ptr));
+            if (!line_end) line_end = end;
+            binance_future_parser_t::parse(now, std::string_view(ptr, line_end - ptr), listener);
+            ptr = line_end + 1;
+        }
+        benchmark::DoNotOptimize(listener.sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * 1'000'000);
+    state.SetBytesProcessed(state.iterations() * buffer.size());
+}
+
+static void bm_binance_future_replay_cursor(benchmark::State &state) {
+    const std::string &buffer = replay_buffer();
+    auto now = std::chrono::system_clock::now();
+
+    for (auto _ : state) {
+        double sum = 0;
+        message_cursor_t cursor(buffer, framing_t::newline, now);
+        event_t event;
+        while (cursor.next(event)) {
+            switch (event.index()) {
+                case 0: sum += std::get<book_ticker_t>(event).bid.price; break;
+                case 1: sum += std::get<trade_t>(event).price; break;
+                default: sum += std::get<ticker_t>(event).last_price; break;
+            }
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * 1'000'000);
+    state.SetBytesProcessed(state.iterations() * buffer.size());
+}
+
 // ============================================================================
 // Register Benchmarks
 // ============================================================================
@@ -479,5 +602,10 @@ BENCHMARK(bm_binance_future_ticker_latency)->UseManualTime();
 
 // Mixed Messages Benchmark
 BENCHMARK(bm_binance_future_mixed_messages);
+BENCHMARK(bm_binance_future_mixed_messages_trade_only);
+
+// Buffer Replay Benchmarks
+BENCHMARK(bm_binance_future_replay_listener)->Unit(benchmark::kMillisecond);
+BENCHMARK(bm_binance_future_replay_cursor)->Unit(benchmark::kMillisecond);
 
 BENCHMARK_MAIN();
\ No newline at end of file
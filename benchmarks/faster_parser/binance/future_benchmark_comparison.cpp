@@ -7,6 +7,7 @@
  */
 
 #include <chrono>
+#include <map>
 #include <string>
 #include <vector>
 #include <benchmark/benchmark.h>
@@ -572,6 +573,105 @@ static void bm_simdjson_ticker_workload(benchmark::State &state) {
     state.SetBytesProcessed(total_bytes);
 }
 
+// ============================================================================
+// NDJSON stream benchmarks (parse_stream vs simdjson iterate_many)
+// ============================================================================
+
+// Synthetic newline-delimited capture of at least `size` bytes, built once per size
+static const simdjson::padded_string &ndjson_corpus(size_t size) {
+    static std::map<size_t, simdjson::padded_string> corpora;
+    auto it = corpora.find(size);
+    if (it == corpora.end()) {
+        std::string out;
+        out.reserve(size + 512);
+        for (size_t i = 0; out.size() < size; ++i) {
+            out += mixed_messages[i % mixed_messages.size()];
+            out += '\n';
+        }
+        it = corpora.emplace(size, simdjson::padded_string(out)).first;
+    }
+    return it->second;
+}
+
+static void bm_faster_parser_ndjson_stream(benchmark::State &state) {
+    const auto &corpus = ndjson_corpus(static_cast<size_t>(state.range(0)));
+    BenchmarkListener listener;
+    auto now = std::chrono::system_clock::now();
+
+    for (auto _ : state) {
+        size_t consumed = binance_future_parser_t::parse_stream(now, std::string_view(corpus.data(), corpus.size()), listener);
+        benchmark::DoNotOptimize(consumed);
+        benchmark::DoNotOptimize(listener.last_book_ticker);
+        benchmark::DoNotOptimize(listener.last_trade);
+        benchmark::DoNotOptimize(listener.last_ticker);
+    }
+
+    state.SetBytesProcessed(state.iterations() * corpus.size());
+}
+
+static void bm_simdjson_ndjson_iterate_many(benchmark::State &state) {
+    const auto &corpus = ndjson_corpus(static_cast<size_t>(state.range(0)));
+    simdjson::ondemand::parser parser;
+    book_ticker_t book_ticker;
+    trade_t trade;
+    ticker_t ticker;
+    auto now = std::chrono::system_clock::now();
+
+    for (auto _ : state) {
+        simdjson::ondemand::document_stream stream = parser.iterate_many(corpus).value();
+        for (auto doc : stream) {
+            std::string_view event_type = doc["e"].get_string().value();
+
+            if (event_type == "bookTicker") {
+                book_ticker.bid.sequence = doc["u"].get_uint64().value();
+                book_ticker.ask.sequence = book_ticker.bid.sequence;
+                book_ticker.symbol = doc["s"].get_string().value();
+                book_ticker.bid.price = std::stod(std::string(doc["b"].get_string().value()));
+                book_ticker.bid.volume = std::stod(std::string(doc["B"].get_string().value()));
+                book_ticker.ask.price = std::stod(std::string(doc["a"].get_string().value()));
+                book_ticker.ask.volume = std::stod(std::string(doc["A"].get_string().value()));
+                book_ticker.exchange_timestamp = doc["E"].get_uint64().value();
+                book_ticker.time = now;
+                benchmark::DoNotOptimize(book_ticker);
+            } else if (event_type == "aggTrade") {
+                trade.event_time = doc["E"].get_uint64().value();
+                trade.symbol = doc["s"].get_string().value();
+                trade.agg_trade_id = doc["a"].get_uint64().value();
+                trade.price = std::stod(std::string(doc["p"].get_string().value()));
+                trade.quantity = std::stod(std::string(doc["q"].get_string().value()));
+                trade.first_trade_id = doc["f"].get_uint64().value();
+                trade.last_trade_id = doc["l"].get_uint64().value();
+                trade.trade_time = doc["T"].get_uint64().value();
+                trade.is_buyer_maker = doc["m"].get_bool().value();
+                trade.time = now;
+                benchmark::DoNotOptimize(trade);
+            } else if (event_type == "24hrTicker") {
+                ticker.event_time = doc["E"].get_uint64().value();
+                ticker.symbol = doc["s"].get_string().value();
+                ticker.price_change = std::stod(std::string(doc["p"].get_string().value()));
+                ticker.price_change_percent = std::stod(std::string(doc["P"].get_string().value()));
+                ticker.weighted_avg_price = std::stod(std::string(doc["w"].get_string().value()));
+                ticker.last_price = std::stod(std::string(doc["c"].get_string().value()));
+                ticker.last_quantity = std::stod(std::string(doc["Q"].get_string().value()));
+                ticker.open_price = std::stod(std::string(doc["o"].get_string().value()));
+                ticker.high_price = std::stod(std::string(doc["h"].get_string().value()));
+                ticker.low_price = std::stod(std::string(doc["l"].get_string().value()));
+                ticker.total_traded_base_volume = std::stod(std::string(doc["v"].get_string().value()));
+                ticker.total_traded_quote_volume = std::stod(std::string(doc["q"].get_string().value()));
+                ticker.statistics_open_time = doc["O"].get_uint64().value();
+                ticker.statistics_close_time = doc["C"].get_uint64().value();
+                ticker.first_trade_id = doc["F"].get_uint64().value();
+                ticker.last_trade_id = doc["L"].get_uint64().value();
+                ticker.total_trades = doc["n"].get_uint64().value();
+                ticker.time = now;
+                benchmark::DoNotOptimize(ticker);
+            }
+        }
+    }
+
+    state.SetBytesProcessed(state.iterations() * corpus.size());
+}
+
 // ============================================================================
 // Register benchmarks
 // ============================================================================
@@ -598,4 +698,8 @@ BENCHMARK(bm_simdjson_ticker_workload);
 BENCHMARK(bm_faster_parser_mixed_workload);
 BENCHMARK(bm_simdjson_mixed_workload);
 
+// NDJSON stream (256 MiB and 2 GiB synthetic captures): faster-parser vs simdjson
+BENCHMARK(bm_faster_parser_ndjson_stream)->Arg(int64_t{256} << 20)->Arg(int64_t{2} << 30)->Unit(benchmark::kMillisecond);
+BENCHMARK(bm_simdjson_ndjson_iterate_many)->Arg(int64_t{256} << 20)->Arg(int64_t{2} << 30)->Unit(benchmark::kMillisecond);
+
 BENCHMARK_MAIN();
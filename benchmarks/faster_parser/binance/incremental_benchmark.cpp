@@ -0,0 +1,106 @@
+/**
+ * @file incremental_benchmark.cpp
+ * @author Kevin Rodrigues
+ * @brief Time-to-first-event for a ticker array frame received across many reads
+ * @version 1.0
+ * @date 16/10/2026
+ */
+
+#include <chrono>
+#include <string>
+#include <vector>
+#include <benchmark/benchmark.h>
+
+#include <faster_parser/binance/future.h>
+#include <faster_parser/binance/incremental.h>
+
+using namespace core::faster_parser::binance;
+using namespace core::faster_parser::binance::types;
+
+// Typical payload of one TCP segment
+constexpr size_t read_size = 1448;
+
+// ~200 KB !ticker@arr frame
+static const std::string &ticker_array_frame() {
+    static const std::string frame = [] {
+        std::string out = "[";
+        for (size_t i = 0; out.size() < 200 * 1024; ++i) {
+            if (i) out += ",";
+            out += R"({"e":"24hrTicker","E":)" + std::to_string(1760083106579ULL + i) + R"(,"s":"SYM)" + std::to_string(i) +
+                   R"(USDT","p":"150.50","P":"4.52","w":"3320.75","c":"3500.50","Q":"25.5","o":"3350.00","h":"3600.00","l":"3300.00","v":"125000.5","q":"415000000.25","O":1234467890,"C":1234567890,"F":1000000,"L":1050000,"n":50001})";
+        }
+        out += "]";
+        return out;
+    }();
+    return frame;
+}
+
+// Records when the first and last tickers are delivered
+class TimingListener {
+public:
+    std::chrono::high_resolution_clock::time_point first;
+    std::chrono::high_resolution_clock::time_point last;
+    size_t count = 0;
+
+    void on_ticker(const ticker_t& ticker) {
+        last = std::chrono::high_resolution_clock::now();
+        if (count++ == 0) first = last;
+        benchmark::DoNotOptimize(ticker);
+    }
+};
+
+// ============================================================================
+// Time-to-first-event: accumulate then parse vs resumable parser
+// ============================================================================
+
+static void bm_ticker_array_accumulate_first_event(benchmark::State &state) {
+    const std::string &frame = ticker_array_frame();
+    auto now = std::chrono::system_clock::now();
+    std::string buffer;
+    buffer.reserve(frame.size());
+    double last_event = 0;
+
+    for (auto _ : state) {
+        TimingListener listener;
+        buffer.clear();
+        auto start = std::chrono::high_resolution_clock::now();
+        for (size_t offset = 0; offset < frame.size(); offset += read_size) {
+            buffer.append(frame, offset, read_size);
+        }
+        binance_future_parser_t::process_ticker_array(now, buffer, listener);
+
+        state.SetIterationTime(std::chrono::duration<double>(listener.first - start).count());
+        last_event += std::chrono::duration<double>(listener.last - start).count();
+    }
+
+    state.counters["last_event_us"] = benchmark::Counter(last_event * 1e6 / static_cast<double>(state.iterations()));
+}
+
+static void bm_ticker_array_incremental_first_event(benchmark::State &state) {
+    const std::string &frame = ticker_array_frame();
+    auto now = std::chrono::system_clock::now();
+    ticker_array_stream_t stream;
+    double last_event = 0;
+
+    for (auto _ : state) {
+        TimingListener listener;
+        stream.reset();
+        auto start = std::chrono::high_resolution_clock::now();
+        for (size_t offset = 0; offset < frame.size(); offset += read_size) {
+            stream.feed(now, std::string_view(frame).substr(offset, read_size), listener);
+        }
+
+        state.SetIterationTime(std::chrono::duration<double>(listener.first - start).count());
+        last_event += std::chrono::duration<double>(listener.last - start).count();
+    }
+
+    state.counters["last_event_us"] = benchmark::Counter(last_event * 1e6 / static_cast<double>(state.iterations()));
+}
+
+// ============================================================================
+// Register Benchmarks
+// ============================================================================
+
+// Every iteration replays the whole frame while only the first event is timed: fixed iteration count
+BENCHMARK(bm_ticker_array_accumulate_first_event)->UseManualTime()->Iterations(1000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(bm_ticker_array_incremental_first_event)->UseManualTime()->Iterations(1000)->Unit(benchmark::kMicrosecond);
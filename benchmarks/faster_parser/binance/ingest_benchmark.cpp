@@ -0,0 +1,214 @@
+/**
+ * @file ingest_benchmark.cpp
+ * @author Kevin Rodrigues
+ * @brief io_uring ingest loop vs epoll + recv, against a local TCP replay server
+ * @version 1.0
+ * @date 16/10/2026
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+#include <benchmark/benchmark.h>
+
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <faster_parser/binance/future.h>
+#include <faster_parser/binance/ingest.h>
+
+using namespace core::faster_parser::binance;
+using namespace core::faster_parser::binance::types;
+
+namespace {
+    constexpr size_t messages_per_run = 200'000;
+    constexpr size_t messages_per_write = 32;
+
+    uint64_t steady_ns() {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+
+    // aggTrade whose "E" field carries the send time; the 19 digits are patched in place
+    const std::string message_template =
+        R"({"e":"aggTrade","E":0000000000000000000,"s":"BTCUSDT","a":5933014,"p":"0.001","q":"100","f":100,"l":105,"T":123456785,"m":true})" "\n";
+    const size_t stamp_offset = message_template.find("000");
+
+    // Latency from the server's write to the listener callback
+    class LatencyListener {
+    public:
+        std::vector<uint64_t> latencies;
+
+        LatencyListener() { latencies.reserve(messages_per_run); }
+
+        void on_trade(const trade_t &trade) {
+            latencies.push_back(steady_ns() - trade.event_time);
+        }
+    };
+
+    /**
+     * Replay server on a loopback port: writes messages_per_run stamped messages, then closes.
+     * Unpaced, it writes as fast as the socket accepts (throughput; latency is then mostly
+     * queueing). Paced, it sleeps ~50 us between writes so latency reflects the receive path.
+     */
+    class replay_server_t {
+    public:
+        explicit replay_server_t(bool paced) : paced_(paced) {
+            listen_fd_ = ::socket(AF_INET, SOCK_STREAM, 0);
+            sockaddr_in address{};
+            address.sin_family = AF_INET;
+            address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+            ::bind(listen_fd_, reinterpret_cast<sockaddr *>(&address), sizeof(address));
+            ::listen(listen_fd_, 1);
+            socklen_t length = sizeof(address);
+            ::getsockname(listen_fd_, reinterpret_cast<sockaddr *>(&address), &length);
+            address_ = address;
+
+            thread_ = std::thread([this] { serve(); });
+        }
+
+        ~replay_server_t() {
+            thread_.join();
+            ::close(listen_fd_);
+        }
+
+        int connect() const {
+            int fd = ::socket(AF_INET, SOCK_STREAM, 0);
+            int one = 1;
+            ::setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+            ::connect(fd, reinterpret_cast<const sockaddr *>(&address_), sizeof(address_));
+            return fd;
+        }
+
+    private:
+        void serve() {
+            int fd = ::accept(listen_fd_, nullptr, nullptr);
+            int one = 1;
+            ::setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+
+            std::string batch;
+            for (size_t i = 0; i < messages_per_write; ++i) batch += message_template;
+
+            for (size_t sent = 0; sent < messages_per_run; sent += messages_per_write) {
+                char digits[20];
+                std::snprintf(digits, sizeof(digits), "%019llu", static_cast<unsigned long long>(steady_ns()));
+                for (size_t i = 0; i < messages_per_write; ++i) {
+                    std::memcpy(batch.data() + i * message_template.size() + stamp_offset, digits, 19);
+                }
+                const char *ptr = batch.data();
+                size_t left = batch.size();
+                while (left > 0) {
+                    ssize_t written = ::write(fd, ptr, left);
+                    if (written <= 0) break;
+                    ptr += written;
+                    left -= static_cast<size_t>(written);
+                }
+                if (paced_) std::this_thread::sleep_for(std::chrono::microseconds(50));
+            }
+            ::close(fd);
+        }
+
+        bool paced_;
+        int listen_fd_ = -1;
+        sockaddr_in address_{};
+        std::thread thread_;
+    };
+
+    void report(benchmark::State &state, std::vector<uint64_t> &latencies) {
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * messages_per_run));
+        if (latencies.empty()) return;
+        std::sort(latencies.begin(), latencies.end());
+        state.counters["p50_ns"] = static_cast<double>(latencies[latencies.size() / 2]);
+        state.counters["p99_ns"] = static_cast<double>(latencies[latencies.size() * 99 / 100]);
+        state.counters["max_ns"] = static_cast<double>(latencies.back());
+    }
+}
+
+// ============================================================================
+// epoll + recv: the loop most users write
+// ============================================================================
+
+static void bm_ingest_epoll_recv(benchmark::State &state) {
+    std::vector<uint64_t> latencies;
+
+    for (auto _ : state) {
+        replay_server_t server(state.range(0) != 0);
+        int fd = server.connect();
+        ::fcntl(fd, F_SETFL, ::fcntl(fd, F_GETFL) | O_NONBLOCK);
+        int epoll_fd = ::epoll_create1(0);
+        epoll_event event{};
+        event.events = EPOLLIN;
+        event.data.fd = fd;
+        ::epoll_ctl(epoll_fd, EPOLL_CTL_ADD, fd, &event);
+
+        LatencyListener listener;
+        std::vector<char> buffer(64 * 1024 + uring_ingest_t::padding);
+        const size_t capacity = 64 * 1024;
+        size_t filled = 0;
+        bool open = true;
+        while (open) {
+            epoll_event ready{};
+            if (::epoll_wait(epoll_fd, &ready, 1, -1) <= 0) continue;
+            while (true) {
+                ssize_t received = ::recv(fd, buffer.data() + filled, capacity - filled, 0);
+                if (received == 0) {
+                    open = false;
+                    break;
+                }
+                if (received < 0) break;
+                filled += static_cast<size_t>(received);
+
+                size_t consumed = binance_future_parser_t::parse_stream(std::chrono::system_clock::now(),
+                                                                        std::string_view(buffer.data(), filled), listener);
+                std::memmove(buffer.data(), buffer.data() + consumed, filled - consumed);
+                filled -= consumed;
+            }
+        }
+        ::close(epoll_fd);
+        ::close(fd);
+
+        latencies.insert(latencies.end(), listener.latencies.begin(), listener.latencies.end());
+    }
+
+    report(state, latencies);
+}
+
+// ============================================================================
+// io_uring multishot recv into provided buffers
+// ============================================================================
+
+static void bm_ingest_io_uring(benchmark::State &state) {
+    std::vector<uint64_t> latencies;
+
+    for (auto _ : state) {
+        replay_server_t server(state.range(0) != 0);
+        int fd = server.connect();
+
+        uring_ingest_t ingest;
+        if (!ingest.open(fd)) {
+            ::close(fd);
+            state.SkipWithError("io_uring unavailable");
+            break;
+        }
+
+        LatencyListener listener;
+        ingest.run_ndjson(listener);
+        latencies.insert(latencies.end(), listener.latencies.begin(), listener.latencies.end());
+    }
+
+    report(state, latencies);
+}
+
+// ============================================================================
+// Register Benchmarks
+// ============================================================================
+
+BENCHMARK(bm_ingest_epoll_recv)->ArgName("paced")->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(bm_ingest_io_uring)->ArgName("paced")->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond)->UseRealTime();
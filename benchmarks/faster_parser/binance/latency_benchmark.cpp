@@ -0,0 +1,528 @@
+/**
+ * @file latency_benchmark.cpp
+ * @author Kevin Rodrigues
+ * @brief Per-message parse latency distributions over a large shuffled corpus, with run metadata
+ * @version 1.0
+ * @date 16/10/2026
+ *
+ * Google Benchmark reports the mean time of a loop over a handful of hot messages. This
+ * harness times every message on its own with serialising counter reads, over a corpus of
+ * distinct messages visited in a new random order each pass, and reports the percentile
+ * distribution per message type. Run metadata (CPU, parser ISA, governor, SMT, isolation
+ * and the kernel parameters set by prepare_*.sh) is written with the results as JSON.
+ *
+ * Modes set how much of the parser's state is still cached when a message arrives:
+ *   hot     cycle through a handful of messages, as the Google Benchmark loops do
+ *   rotate  visit the whole corpus, each message once per pass (default)
+ *   cold    rotate, and before every message evict L1/L2 and trash the branch predictor
+ * --evict, --trash-branches, --working-set and --idle-us set the parts individually.
+ * --warm=discard|exact calls warm() (warm.h) after making the state cold, before timing.
+ *
+ * Usage: binance_latency_benchmarks [--mode=hot|rotate|cold] [--messages=N] [--passes=N]
+ *                                   [--working-set=N] [--evict] [--evict-bytes=N]
+ *                                   [--trash-branches] [--idle-us=N] [--warm=discard|exact]
+ *                                   [--seed=N] [--cpu=N] [--json=path|-] [--raw]
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <sched.h>
+#include <unistd.h>
+
+#include <faster_parser/binance/future.h>
+#include <faster_parser/binance/warm.h>
+
+using namespace core::faster_parser;
+using namespace core::faster_parser::binance;
+using namespace core::faster_parser::binance::types;
+
+namespace {
+    enum class warm_t { off, discard, exact };
+
+    struct options_t {
+        size_t messages = 1'000'000;
+        size_t passes = 3;
+        uint64_t seed = 42;
+        int cpu = -1;                                   // Pin to this CPU (-1: stay where started)
+        std::string json;                               // Output path, "-" for stdout
+        bool raw = false;                               // Keep the timer overhead in the samples
+        std::string mode = "rotate";
+        size_t working_set = 0;                         // Cycle through the first N messages (0: whole corpus)
+        bool evict = false;                             // Sweep evict_bytes of memory before each message
+        size_t evict_bytes = 0;                         // 0: twice the L2 size
+        bool trash_branches = false;                    // Run random branches before each message
+        uint32_t idle_us = 0;                           // Sleep before each message
+        warm_t warm = warm_t::off;                      // Warm the parser before each message
+    };
+
+    bool parse_options(int argc, char **argv, options_t &options) {
+        // Modes first: they only set defaults, which the other options override
+        for (int i = 1; i < argc; ++i) {
+            const std::string_view arg(argv[i]);
+            if (arg == "--mode=hot") {
+                options.mode = "hot";
+                options.working_set = 8;
+            } else if (arg == "--mode=cold") {
+                // Each sample costs a sweep of L2, so fewer of them
+                options.mode = "cold";
+                options.evict = true;
+                options.trash_branches = true;
+                options.messages = 100'000;
+                options.passes = 1;
+            } else if (arg.starts_with("--mode=") && arg != "--mode=rotate") {
+                return false;
+            }
+        }
+        for (int i = 1; i < argc; ++i) {
+            const std::string_view arg(argv[i]);
+            auto value = [&](std::string_view name) -> const char * {
+                return arg.starts_with(name) && arg.size() > name.size() ? argv[i] + name.size() : nullptr;
+            };
+            if (const char *v = value("--messages=")) options.messages = std::strtoull(v, nullptr, 10);
+            else if (const char *v = value("--passes=")) options.passes = std::strtoull(v, nullptr, 10);
+            else if (const char *v = value("--seed=")) options.seed = std::strtoull(v, nullptr, 10);
+            else if (const char *v = value("--cpu=")) options.cpu = std::atoi(v);
+            else if (const char *v = value("--json=")) options.json = v;
+            else if (const char *v = value("--working-set=")) options.working_set = std::strtoull(v, nullptr, 10);
+            else if (const char *v = value("--evict-bytes=")) options.evict = (options.evict_bytes = std::strtoull(v, nullptr, 10)) > 0;
+            else if (const char *v = value("--idle-us=")) options.idle_us = static_cast<uint32_t>(std::strtoul(v, nullptr, 10));
+            else if (arg == "--warm=discard") options.warm = warm_t::discard;
+            else if (arg == "--warm=exact") options.warm = warm_t::exact;
+            else if (arg == "--raw") options.raw = true;
+            else if (arg == "--evict") options.evict = true;
+            else if (arg == "--trash-branches") options.trash_branches = true;
+            else if (!arg.starts_with("--mode=")) return false;
+        }
+        if (options.working_set > options.messages) options.working_set = options.messages;
+        return options.messages > 0 && options.passes > 0;
+    }
+
+    // ========================================================================
+    // Corpus: distinct messages of every type, shuffled
+    // ========================================================================
+
+    struct message_t {
+        uint64_t offset;
+        uint32_t length;
+        trace_type_t type;
+    };
+
+    struct corpus_t {
+        std::string storage;
+        std::vector<message_t> messages;
+
+        [[nodiscard]] std::string_view view(message_t const &message) const {
+            return std::string_view(storage).substr(message.offset, message.length);
+        }
+    };
+
+    // 60% bookTicker, 25% aggTrade, 10% depthUpdate, 5% 24hrTicker over 300 symbols, with
+    // prices and quantities of varying magnitude and precision
+    corpus_t make_corpus(size_t count, uint64_t seed) {
+        std::mt19937_64 rng(seed);
+        std::uniform_int_distribution<int> kind(0, 99);
+        std::uniform_int_distribution<int> symbol(0, 299);
+        std::uniform_int_distribution<int> decimals(0, 8);
+        std::uniform_int_distribution<int> levels(0, 6);
+        std::lognormal_distribution<double> magnitude(2., 3.);
+
+        auto number = [&] {
+            char buffer[48];
+            const int n = std::snprintf(buffer, sizeof(buffer), "%.*f", decimals(rng), magnitude(rng));
+            return std::string(buffer, static_cast<size_t>(n));
+        };
+        auto name = [&] {
+            std::string symbol_name(1, 'S');
+            symbol_name += std::to_string(symbol(rng) * 7919 % 100000);
+            symbol_name += "USDT";
+            return symbol_name;
+        };
+
+        corpus_t corpus;
+        corpus.messages.reserve(count);
+        uint64_t id = 8'822'354'685'185;
+        uint64_t time = 1'760'083'106'579;
+        for (size_t i = 0; i < count; ++i) {
+            id += 1 + i % 7;
+            time += i % 3;
+            const int k = kind(rng);
+            std::string message;
+            trace_type_t type;
+            if (k < 60) {
+                type = trace_type_t::book_ticker;
+                message = R"({"e":"bookTicker","u":)" + std::to_string(id) + R"(,"s":")" + name() + R"(","b":")" + number() +
+                          R"(","B":")" + number() + R"(","a":")" + number() + R"(","A":")" + number() + R"(","T":)" +
+                          std::to_string(time) + R"(,"E":)" + std::to_string(time) + "}";
+            } else if (k < 85) {
+                type = trace_type_t::trade;
+                message = R"({"e":"aggTrade","E":)" + std::to_string(time) + R"(,"s":")" + name() + R"(","a":)" + std::to_string(id) +
+                          R"(,"p":")" + number() + R"(","q":")" + number() + R"(","f":)" + std::to_string(id * 3) + R"(,"l":)" +
+                          std::to_string(id * 3 + 2) + R"(,"T":)" + std::to_string(time) + R"(,"m":)" + (k % 2 ? "true" : "false") + "}";
+            } else if (k < 95) {
+                type = trace_type_t::depth;
+                message = R"({"e":"depthUpdate","E":)" + std::to_string(time) + R"(,"T":)" + std::to_string(time) + R"(,"s":")" + name() +
+                          R"(","U":)" + std::to_string(id) + R"(,"u":)" + std::to_string(id + 4) + R"(,"pu":)" + std::to_string(id - 1) + R"(,"b":[)";
+                for (int side = 0; side < 2; ++side) {
+                    const int n = levels(rng);
+                    for (int l = 0; l < n; ++l) {
+                        if (l) message += ',';
+                        message += R"([")";
+                        message += number();
+                        message += R"(",")";
+                        message += number();
+                        message += R"("])";
+                    }
+                    message += side == 0 ? R"(],"a":[)" : "]}";
+                }
+            } else {
+                type = trace_type_t::ticker;
+                message = R"({"e":"24hrTicker","E":)" + std::to_string(time) + R"(,"s":")" + name() + R"(","p":")" + number() +
+                          R"(","P":")" + number() + R"(","w":")" + number() + R"(","c":")" + number() + R"(","Q":")" + number() +
+                          R"(","o":")" + number() + R"(","h":")" + number() + R"(","l":")" + number() + R"(","v":")" + number() +
+                          R"(","q":")" + number() + R"(","O":0,"C":86400000,"F":0,"L":18150,"n":)" + std::to_string(id % 100000) + "}";
+            }
+            corpus.messages.push_back({corpus.storage.size(), static_cast<uint32_t>(message.size()), type});
+            corpus.storage += message;
+        }
+        std::shuffle(corpus.messages.begin(), corpus.messages.end(), rng);
+        return corpus;
+    }
+
+    struct sink_t {
+        uint64_t sum = 0;
+        void on_book_ticker(const book_ticker_t &ticker) { sum += ticker.bid.sequence; }
+        void on_trade(const trade_t &trade) { sum += trade.agg_trade_id; }
+        void on_ticker(const ticker_t &ticker) { sum += ticker.event_time; }
+        void on_depth_update(const depth_update_t &update) { sum += update.final_update_id; }
+    };
+
+    // A strategy's live path: one out-of-line handler, which --warm=exact runs on the
+    // synthetic messages so that the same instructions are warmed
+    __attribute__((noinline)) bool handle_message(std::chrono::system_clock::time_point const &now, std::string_view raw, sink_t &sink) {
+        return binance_future_parser_t::parse(now, raw, sink);
+    }
+
+    // ========================================================================
+    // Run metadata
+    // ========================================================================
+
+    std::string read_line(std::string const &path) {
+        std::ifstream file(path);
+        std::string line;
+        if (!file || !std::getline(file, line)) return "unknown";
+        return line;
+    }
+
+    std::string cpu_model() {
+        std::ifstream file("/proc/cpuinfo");
+        std::string line;
+        while (std::getline(file, line)) {
+            if (line.starts_with("model name") || line.starts_with("CPU part")) {
+                const size_t colon = line.find(':');
+                return colon == std::string::npos ? line : line.substr(line.find_first_not_of(' ', colon + 1));
+            }
+        }
+        return "unknown";
+    }
+
+    // Whether `cpu` is in a kernel CPU list such as "0-7,12"
+    bool in_cpu_list(std::string const &list, int cpu) {
+        std::stringstream stream(list);
+        std::string range;
+        while (std::getline(stream, range, ',')) {
+            if (range.empty() || range == "unknown") continue;
+            const size_t dash = range.find('-');
+            const int first = std::atoi(range.c_str());
+            const int last = dash == std::string::npos ? first : std::atoi(range.c_str() + dash + 1);
+            if (cpu >= first && cpu <= last) return true;
+        }
+        return false;
+    }
+
+    // Kernel parameters set by the prepare_*.sh scripts
+    std::string kernel_parameters() {
+        std::stringstream stream(read_line("/proc/cmdline"));
+        std::string parameter, out;
+        for (const char *prefix : {"isolcpus=", "nohz_full=", "rcu_nocbs=", "intel_pstate=", "processor.max_cstate=", "intel_idle.max_cstate="}) {
+            stream.clear();
+            stream.seekg(0);
+            while (stream >> parameter) {
+                if (!parameter.starts_with(prefix)) continue;
+                if (!out.empty()) out += ' ';
+                out += parameter;
+            }
+        }
+        return out;
+    }
+
+    std::string json_string(std::string_view value) {
+        std::string out = "\"";
+        for (char c : value) {
+            if (c == '"' || c == '\\') out += '\\';
+            if (static_cast<unsigned char>(c) >= 0x20) out += c;
+        }
+        return out + '"';
+    }
+
+    // Size in bytes of the data or unified cache at `level` of `cpu`, 0 if unknown
+    size_t cache_size(int cpu, int level) {
+        for (int index = 0; index < 8; ++index) {
+            const std::string path = "/sys/devices/system/cpu/cpu" + std::to_string(cpu) + "/cache/index" + std::to_string(index) + "/";
+            if (read_line(path + "level") != std::to_string(level) || read_line(path + "type") == "Instruction") continue;
+            const std::string size = read_line(path + "size");
+            const size_t value = std::strtoull(size.c_str(), nullptr, 10);
+            return size.ends_with('M') ? value << 20 : size.ends_with('K') ? value << 10 : value;
+        }
+        return 0;
+    }
+
+    // ========================================================================
+    // Cold state: cache eviction and branch predictor trashing
+    // ========================================================================
+
+    // Read-modify-write one word per cache line: a buffer twice the size of L2 leaves
+    // none of the parser's data (tables, listener state, stack) in L1 or L2
+    __attribute__((noinline)) void evict_caches(std::vector<uint64_t> &buffer) {
+        for (size_t i = 0; i < buffer.size(); i += 64 / sizeof(uint64_t)) buffer[i] += 1;
+        asm volatile("" : : "r"(buffer.data()) : "memory");
+    }
+
+    // One conditional branch per site, expanded by halving; the empty asm keeps the
+    // compiler from turning it into a conditional move
+    template<size_t first, size_t count>
+    __attribute__((always_inline)) inline void random_branches(const uint8_t *bits, size_t offset, uint64_t &acc) {
+        if constexpr (count == 1) {
+            if (bits[(offset + first) & 0xffff]) {
+                asm volatile("" : "+r"(acc));
+                acc = acc * 3 + first;
+            } else {
+                acc ^= first;
+            }
+        } else {
+            random_branches<first, count / 2>(bits, offset, acc);
+            random_branches<first + count / 2, count - count / 2>(bits, offset, acc);
+        }
+    }
+
+    // 2048 distinct branch sites taking fresh random directions on every call: overwrites
+    // the direction history and BTB entries the parser trained, and at ~64 KB of code also
+    // pushes the parser out of L1i and the uop cache
+    constexpr size_t branch_sites = 2048;
+
+    __attribute__((noinline)) uint64_t trash_branches(const uint8_t *bits, size_t offset) {
+        uint64_t acc = 0;
+        random_branches<0, branch_sites>(bits, offset, acc);
+        return acc;
+    }
+
+    volatile uint64_t checksum = 0;                     // Keeps the listener's work observable
+
+    constexpr double percentiles[] = {1., 5., 10., 25., 50., 75., 90., 95., 99., 99.5, 99.9, 99.99, 99.999, 100.};
+}
+
+int main(int argc, char **argv) {
+    options_t options;
+    if (!parse_options(argc, argv, options)) {
+        std::fprintf(stderr,
+                     "usage: %s [--mode=hot|rotate|cold] [--messages=N] [--passes=N] [--working-set=N] [--evict] [--evict-bytes=N]\n"
+                     "       [--trash-branches] [--idle-us=N] [--warm=discard|exact] [--seed=N] [--cpu=N] [--json=path|-] [--raw]\n",
+                     argv[0]);
+        return 2;
+    }
+
+    bool pinned = false;
+    if (options.cpu >= 0) {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(options.cpu, &set);
+        pinned = sched_setaffinity(0, sizeof(set), &set) == 0;
+        if (!pinned) std::fprintf(stderr, "warning: could not pin to CPU %d\n", options.cpu);
+    }
+    const int cpu = sched_getcpu();
+
+    const tsc_clock_t clock = tsc_clock_t::calibrate(std::chrono::milliseconds(100));
+    const corpus_t corpus = make_corpus(options.messages, options.seed);
+
+    // Cost of an empty timed region, subtracted from every sample unless --raw
+    latency_histogram_t overhead_histogram;
+    for (int i = 0; i < 100'000; ++i) {
+        const uint64_t start = read_tsc_start();
+        overhead_histogram.record(read_tsc_end() - start);
+    }
+    const uint64_t overhead = options.raw ? 0 : overhead_histogram.percentile(50.);
+
+    const size_t l1_bytes = cache_size(cpu, 1);
+    const size_t l2_bytes = cache_size(cpu, 2);
+    const size_t llc_bytes = std::max({l2_bytes, cache_size(cpu, 3), cache_size(cpu, 4)});
+    if (options.evict && options.evict_bytes == 0) options.evict_bytes = l2_bytes ? 2 * l2_bytes : size_t(8) << 20;
+    std::vector<uint64_t> evict_buffer(options.evict ? options.evict_bytes / sizeof(uint64_t) : 0, 1);
+    std::vector<uint8_t> branch_bits(options.trash_branches ? 1 << 16 : 0);
+    std::mt19937_64 cold_rng(options.seed + 2);
+    for (auto &bit : branch_bits) bit = static_cast<uint8_t>(cold_rng() & 1);
+    // Rotation alone only leaves messages cold if they do not all fit in the LLC. With
+    // eviction, an LLC-resident message is the intended state: NICs with DDIO deliver there
+    if (options.working_set == 0 && !options.evict && llc_bytes > 0 && corpus.storage.size() < 2 * llc_bytes) {
+        std::fprintf(stderr, "warning: corpus (%zu MB) is not much larger than the LLC (%zu MB): raise --messages for cache-cold messages\n",
+                     corpus.storage.size() >> 20, llc_bytes >> 20);
+    }
+
+    sink_t sink;
+    const auto now = std::chrono::system_clock::now();
+    for (auto const &message : corpus.messages) binance_future_parser_t::parse(now, corpus.view(message), sink);
+    uint64_t cold_work = 0;
+    sink_t scratch;
+
+    std::vector<latency_histogram_t> histograms(trace_type_count);
+    latency_histogram_t all;
+    uint64_t failures = 0;
+    std::vector<uint32_t> order(corpus.messages.size());
+    std::mt19937_64 rng(options.seed + 1);
+    for (size_t pass = 0; pass < options.passes; ++pass) {
+        for (uint32_t i = 0; i < order.size(); ++i) order[i] = i;
+        std::shuffle(order.begin(), order.end(), rng);
+        for (size_t i = 0; i < order.size(); ++i) {
+            message_t const &message = corpus.messages[options.working_set ? i % options.working_set : order[i]];
+            const std::string_view raw = corpus.view(message);
+            if (options.idle_us) std::this_thread::sleep_for(std::chrono::microseconds(options.idle_us));
+            if (options.evict) evict_caches(evict_buffer);
+            if (options.trash_branches) cold_work += trash_branches(branch_bits.data(), cold_rng());
+            if (options.warm == warm_t::discard) {
+                cold_work += warm<sink_t>();
+            } else if (options.warm == warm_t::exact) {
+                cold_work += warm_with<sink_t>([&](std::string_view synthetic) { handle_message(now, synthetic, scratch); });
+            }
+            const uint64_t start = read_tsc_start();
+            const bool parsed = handle_message(now, raw, sink);
+            const uint64_t elapsed = read_tsc_end() - start;
+            const uint64_t sample = elapsed > overhead ? elapsed - overhead : 0;
+            failures += !parsed;
+            histograms[static_cast<size_t>(message.type)].record(sample);
+            all.record(sample);
+        }
+    }
+
+    // ========================================================================
+    // Text report
+    // ========================================================================
+
+    const double ns_per_tick = clock.ns_per_tick();
+    const std::string governor = read_line("/sys/devices/system/cpu/cpu" + std::to_string(cpu) + "/cpufreq/scaling_governor");
+    const std::string isolated = read_line("/sys/devices/system/cpu/isolated");
+    const std::string nohz_full = read_line("/sys/devices/system/cpu/nohz_full");
+    const std::string smt = read_line("/sys/devices/system/cpu/smt/active");
+    const std::string pstate = read_line("/sys/devices/system/cpu/intel_pstate/status");
+    const std::string kernel = kernel_parameters();
+    const bool cpu_isolated = in_cpu_list(isolated, cpu);
+
+    std::printf("cpu: %s (cpu %d%s%s), parser: %s\n", cpu_model().c_str(), cpu, pinned ? ", pinned" : "", cpu_isolated ? ", isolated" : "",
+                std::string(parser_isa).c_str());
+    std::printf("governor: %s, smt: %s, isolated: %s, kernel: %s\n", governor.c_str(), smt.c_str(), isolated.empty() ? "none" : isolated.c_str(),
+                kernel.empty() ? "-" : kernel.c_str());
+    std::string state = options.mode;
+    if (options.working_set) state += ", working set " + std::to_string(options.working_set);
+    if (options.evict) state += ", evict " + std::to_string(options.evict_bytes >> 10) + " KB";
+    if (options.trash_branches) state += ", trash branches";
+    if (options.idle_us) state += ", idle " + std::to_string(options.idle_us) + " us";
+    if (options.warm != warm_t::off) state += options.warm == warm_t::discard ? ", warm" : ", warm exact";
+    std::printf("mode: %s; corpus %zu KB, L1d %zu KB, L2 %zu KB, LLC %zu KB\n", state.c_str(), corpus.storage.size() >> 10, l1_bytes >> 10,
+                l2_bytes >> 10, llc_bytes >> 10);
+    std::printf("messages: %zu x %zu passes, timer overhead: %.1f ns%s, failures: %llu\n\n", corpus.messages.size(), options.passes,
+                static_cast<double>(overhead_histogram.percentile(50.)) * ns_per_tick, options.raw ? " (kept)" : " (subtracted)",
+                static_cast<unsigned long long>(failures));
+    std::printf("%-12s %10s %8s %8s %8s %8s %8s %8s %8s %10s\n", "type", "count", "mean", "p1", "p50", "p90", "p99", "p99.9", "p99.99", "max");
+    auto row = [&](std::string_view name, latency_histogram_t const &histogram) {
+        if (histogram.count() == 0) return;
+        auto ns = [&](double p) { return static_cast<double>(histogram.percentile(p)) * ns_per_tick; };
+        std::printf("%-12.*s %10llu %8.1f %8.1f %8.1f %8.1f %8.1f %8.1f %8.1f %10.1f\n", static_cast<int>(name.size()), name.data(),
+                    static_cast<unsigned long long>(histogram.count()), histogram.mean() * ns_per_tick, ns(1.), ns(50.), ns(90.), ns(99.),
+                    ns(99.9), ns(99.99), static_cast<double>(histogram.max()) * ns_per_tick);
+    };
+    for (size_t i = 0; i < trace_type_count; ++i) row(trace_type_names[i], histograms[i]);
+    row("all", all);
+
+    // ========================================================================
+    // JSON report
+    // ========================================================================
+
+    checksum = sink.sum + scratch.sum + cold_work + (evict_buffer.empty() ? 0 : evict_buffer[0]);
+    if (options.json.empty()) return 0;
+
+    std::string json = "{\"metadata\":{";
+    json += "\"cpu_model\":" + json_string(cpu_model());
+    json += ",\"cpu\":" + std::to_string(cpu);
+    json += ",\"pinned\":" + std::string(pinned ? "true" : "false");
+    json += ",\"cpu_isolated\":" + std::string(cpu_isolated ? "true" : "false");
+    json += ",\"online_cpus\":" + std::to_string(sysconf(_SC_NPROCESSORS_ONLN));
+    json += ",\"parser_isa\":" + json_string(parser_isa);
+    json += ",\"compiler\":" + json_string(__VERSION__);
+    json += ",\"governor\":" + json_string(governor);
+    json += ",\"smt_active\":" + json_string(smt);
+    json += ",\"isolated_cpus\":" + json_string(isolated);
+    json += ",\"nohz_full_cpus\":" + json_string(nohz_full);
+    json += ",\"intel_pstate\":" + json_string(pstate);
+    json += ",\"kernel_parameters\":" + json_string(kernel);
+    json += ",\"tsc_ns_per_tick\":" + std::to_string(ns_per_tick);
+    json += ",\"timer_overhead_ns\":" + std::to_string(static_cast<double>(overhead_histogram.percentile(50.)) * ns_per_tick);
+    json += ",\"overhead_subtracted\":" + std::string(options.raw ? "false" : "true");
+    json += ",\"messages\":" + std::to_string(corpus.messages.size());
+    json += ",\"passes\":" + std::to_string(options.passes);
+    json += ",\"seed\":" + std::to_string(options.seed);
+    json += ",\"failures\":" + std::to_string(failures);
+    json += ",\"mode\":" + json_string(options.mode);
+    json += ",\"working_set\":" + std::to_string(options.working_set);
+    json += ",\"evict_bytes\":" + std::to_string(options.evict ? options.evict_bytes : 0);
+    json += ",\"trash_branches\":" + std::string(options.trash_branches ? "true" : "false");
+    json += ",\"idle_us\":" + std::to_string(options.idle_us);
+    json += ",\"warm\":" + json_string(options.warm == warm_t::off ? "off" : options.warm == warm_t::discard ? "discard" : "exact");
+    json += ",\"corpus_bytes\":" + std::to_string(corpus.storage.size());
+    json += ",\"l1d_bytes\":" + std::to_string(l1_bytes);
+    json += ",\"l2_bytes\":" + std::to_string(l2_bytes);
+    json += ",\"llc_bytes\":" + std::to_string(llc_bytes);
+    json += ",\"timestamp\":" + std::to_string(std::chrono::duration_cast<std::chrono::seconds>(now.time_since_epoch()).count());
+    json += "},\"results\":{";
+
+    auto result = [&](std::string_view name, latency_histogram_t const &histogram) {
+        if (histogram.count() == 0) return;
+        if (json.back() != '{') json += ',';
+        json += json_string(name) + ":{\"summary_ns\":" + histogram.to_json(ns_per_tick) + ",\"percentiles_ns\":{";
+        for (double p : percentiles) {
+            char key[32];
+            std::snprintf(key, sizeof(key), "%s\"%g\":", p == percentiles[0] ? "" : ",", p);
+            json += key;
+            json += std::to_string(static_cast<double>(histogram.percentile(p)) * ns_per_tick);
+        }
+        json += "},\"buckets_ns\":[";
+        bool first = true;
+        histogram.for_each_bucket([&](uint64_t upper_bound, uint64_t count) {
+            if (!first) json += ',';
+            first = false;
+            json += '[';
+            json += std::to_string(static_cast<double>(upper_bound) * ns_per_tick);
+            json += ',';
+            json += std::to_string(count);
+            json += ']';
+        });
+        json += "]}";
+    };
+    for (size_t i = 0; i < trace_type_count; ++i) result(trace_type_names[i], histograms[i]);
+    result("all", all);
+    json += "}}\n";
+
+    if (options.json == "-") {
+        std::fputs(json.c_str(), stdout);
+    } else {
+        std::ofstream(options.json) << json;
+        std::printf("\nresults written to %s\n", options.json.c_str());
+    }
+    return 0;
+}
@@ -0,0 +1,133 @@
+/**
+ * @file listeners_benchmark.cpp
+ * @author Kevin Rodrigues
+ * @brief Benchmarks for the ready-made Binance listeners
+ * @version 1.0
+ * @date 16/10/2026
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+#include <benchmark/benchmark.h>
+
+#include <faster_parser/binance/future.h>
+#include <faster_parser/binance/listeners/trade_columns.h>
+
+using namespace core::faster_parser::binance;
+using namespace core::faster_parser::binance::types;
+
+constexpr size_t corpus_symbols = 300;
+constexpr size_t corpus_distinct_messages = 1 << 16;
+
+static std::vector<std::string> make_symbols() {
+    std::vector<std::string> symbols;
+    for (size_t i = 0; i < corpus_symbols; ++i) {
+        symbols.push_back("SYM" + std::to_string(i) + "USDT");
+    }
+    return symbols;
+}
+
+// Distinct aggTrade messages over corpus_symbols symbols, replayed cyclically to build large corpora
+static const std::vector<std::string> &agg_trade_corpus() {
+    static const std::vector<std::string> corpus = [] {
+        std::vector<std::string> messages;
+        std::vector<std::string> symbols = make_symbols();
+        std::mt19937_64 rng(42);
+        char buffer[256];
+        uint64_t agg_id = 5933014;
+        for (size_t i = 0; i < corpus_distinct_messages; ++i) {
+            const std::string &symbol = symbols[rng() % symbols.size()];
+            double price = 100.0 + static_cast<double>(rng() % 1000000) / 100.0;
+            double quantity = static_cast<double>(rng() % 100000) / 1000.0;
+            uint64_t time = 1760083106579ULL + i;
+            std::snprintf(buffer, sizeof(buffer),
+                          R"({"e":"aggTrade","E":%llu,"s":"%s","a":%llu,"p":"%.2f","q":"%.3f","f":%llu,"l":%llu,"T":%llu,"m":%s})",
+                          static_cast<unsigned long long>(time + 1), symbol.c_str(), static_cast<unsigned long long>(agg_id),
+                          price, quantity, static_cast<unsigned long long>(agg_id * 3), static_cast<unsigned long long>(agg_id * 3 + 2),
+                          static_cast<unsigned long long>(time), (rng() & 1) ? "true" : "false");
+            messages.emplace_back(buffer);
+            ++agg_id;
+        }
+        return messages;
+    }();
+    return corpus;
+}
+
+// ============================================================================
+// Structure-of-arrays sink vs std::vector<trade_t>
+// ============================================================================
+
+class VectorTradeListener {
+public:
+    std::vector<trade_t> trades;
+
+    void on_book_ticker(const book_ticker_t &) {}
+
+    void on_trade(const trade_t &trade) {
+        trades.push_back(trade);
+    }
+
+    void on_ticker(const ticker_t &) {}
+};
+
+static void bm_trade_sink_vector(benchmark::State &state) {
+    const auto &corpus = agg_trade_corpus();
+    const size_t messages = static_cast<size_t>(state.range(0));
+    auto now = std::chrono::system_clock::now();
+
+    for (auto _ : state) {
+        VectorTradeListener listener;
+        for (size_t i = 0; i < messages; ++i) {
+            binance_future_parser_t::parse(now, corpus[i & (corpus_distinct_messages - 1)], listener);
+        }
+        benchmark::DoNotOptimize(listener.trades.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * messages);
+}
+
+static void bm_trade_sink_vector_reserved(benchmark::State &state) {
+    const auto &corpus = agg_trade_corpus();
+    const size_t messages = static_cast<size_t>(state.range(0));
+    auto now = std::chrono::system_clock::now();
+    VectorTradeListener listener;
+    listener.trades.reserve(messages);
+
+    for (auto _ : state) {
+        listener.trades.clear();
+        for (size_t i = 0; i < messages; ++i) {
+            binance_future_parser_t::parse(now, corpus[i & (corpus_distinct_messages - 1)], listener);
+        }
+        benchmark::DoNotOptimize(listener.trades.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * messages);
+}
+
+static void bm_trade_sink_columns(benchmark::State &state) {
+    const auto &corpus = agg_trade_corpus();
+    const size_t messages = static_cast<size_t>(state.range(0));
+    auto now = std::chrono::system_clock::now();
+    listeners::trade_columns_t columns(messages);
+
+    for (auto _ : state) {
+        columns.clear();
+        for (size_t i = 0; i < messages; ++i) {
+            binance_future_parser_t::parse(now, corpus[i & (corpus_distinct_messages - 1)], columns);
+        }
+        benchmark::DoNotOptimize(columns.price().data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * messages);
+}
+
+// ============================================================================
+// Register Benchmarks
+// ============================================================================
+
+BENCHMARK(bm_trade_sink_vector)->Arg(10'000'000)->Unit(benchmark::kMillisecond);
+BENCHMARK(bm_trade_sink_vector_reserved)->Arg(10'000'000)->Unit(benchmark::kMillisecond);
+BENCHMARK(bm_trade_sink_columns)->Arg(10'000'000)->Unit(benchmark::kMillisecond);
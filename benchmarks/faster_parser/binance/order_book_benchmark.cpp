@@ -0,0 +1,228 @@
+/**
+ * @file order_book_benchmark.cpp
+ * @author Kevin Rodrigues
+ * @brief Diff update apply latency of the flat-array L2 order book against a std::map book
+ * @version 1.0
+ * @date 16/10/2026
+ */
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <functional>
+#include <map>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+#include <benchmark/benchmark.h>
+
+#include <faster_parser/binance/future.h>
+#include <faster_parser/binance/order_book.h>
+
+using namespace core::faster_parser::binance;
+using namespace core::faster_parser::binance::types;
+
+namespace {
+    constexpr double tick_size = 0.1;
+    constexpr int64_t start_mid = 450'000;                      // 45000.0
+    constexpr size_t snapshot_levels = 1000;                    // Per side
+    constexpr size_t message_count = 10'000;
+
+    std::string format_level(int64_t ticks, double quantity) {
+        char buffer[64];
+        std::snprintf(buffer, sizeof(buffer), R"(["%lld.%lld","%.3f"])",
+                      static_cast<long long>(ticks / 10), static_cast<long long>(ticks % 10), quantity);
+        return buffer;
+    }
+
+    /**
+     * Synthetic BTCUSDT-like replay: the mid follows a random walk, every update touches
+     * 1-10 levels per side at an exponentially distributed distance from the top, a third
+     * of the touched levels are removed, and levels the mid moves through are removed as
+     * the exchange does, so the book never crosses.
+     */
+    struct fixture_t {
+        std::string snapshot;
+        std::vector<std::string> messages;
+        size_t levels = 0;
+
+        fixture_t() {
+            std::mt19937_64 rng(42);
+            std::uniform_real_distribution<double> quantity(0.001, 5.);
+            std::exponential_distribution<double> distance(0.15);
+            std::uniform_int_distribution<int> count(1, 10);
+            std::uniform_int_distribution<int> step(-2, 2);
+            std::bernoulli_distribution remove(1. / 3.);
+
+            std::set<int64_t> live_bids;
+            std::set<int64_t> live_asks;
+            snapshot = R"({"lastUpdateId":1001,"E":1,"T":1,"bids":[)";
+            for (size_t i = 0; i < snapshot_levels; ++i) {
+                if (i) snapshot += ',';
+                snapshot += format_level(start_mid - 1 - static_cast<int64_t>(i), quantity(rng));
+                live_bids.insert(start_mid - 1 - static_cast<int64_t>(i));
+            }
+            snapshot += R"(],"asks":[)";
+            for (size_t i = 0; i < snapshot_levels; ++i) {
+                if (i) snapshot += ',';
+                snapshot += format_level(start_mid + 1 + static_cast<int64_t>(i), quantity(rng));
+                live_asks.insert(start_mid + 1 + static_cast<int64_t>(i));
+            }
+            snapshot += "]}";
+
+            int64_t mid = start_mid;
+            uint64_t update_id = 1000;
+            for (size_t m = 0; m < message_count; ++m) {
+                mid += step(rng);
+                auto side = [&](int64_t direction, std::set<int64_t> &live) {
+                    std::string out = "[";
+                    auto emit = [&](int64_t ticks, double q) {
+                        if (out.size() > 1) out += ',';
+                        out += format_level(ticks, q);
+                        if (q == 0.) {
+                            live.erase(ticks);
+                        } else {
+                            live.insert(ticks);
+                        }
+                        ++levels;
+                    };
+                    // Levels at or through the mid were consumed
+                    while (!live.empty()) {
+                        const int64_t top = direction < 0 ? *live.rbegin() : *live.begin();
+                        if ((top - mid) * direction > 0) break;
+                        emit(top, 0.);
+                    }
+                    const int n = count(rng);
+                    for (int i = 0; i < n; ++i) {
+                        emit(mid + direction * (1 + static_cast<int64_t>(distance(rng))), remove(rng) ? 0. : quantity(rng));
+                    }
+                    return out + "]";
+                };
+                const uint64_t first = update_id + 1;
+                const uint64_t final = update_id + 1 + static_cast<uint64_t>(count(rng));
+                messages.push_back(R"({"e":"depthUpdate","E":1,"T":1,"s":"BTCUSDT","U":)" + std::to_string(first) +
+                                   R"(,"u":)" + std::to_string(final) + R"(,"pu":)" + std::to_string(update_id) +
+                                   R"(,"b":)" + side(-1, live_bids) + R"(,"a":)" + side(1, live_asks) + "}");
+                update_id = final;
+            }
+        }
+    };
+
+    const fixture_t fixture;
+
+    // Node-based baseline: one map per side, no sequence checks
+    struct map_book_t {
+        std::map<int64_t, double, std::greater<>> bids;
+        std::map<int64_t, double> asks;
+
+        template<typename map_t>
+        static void update(map_t &side, depth_levels_t const &levels) {
+            levels.for_each([&](depth_level_t const &level) {
+                const int64_t ticks = std::llround(level.price / tick_size);
+                if (level.quantity == 0.) {
+                    side.erase(ticks);
+                } else {
+                    side[ticks] = level.quantity;
+                }
+            });
+        }
+
+        void load(depth_snapshot_t const &snapshot) {
+            bids.clear();
+            asks.clear();
+            update(bids, snapshot.bids);
+            update(asks, snapshot.asks);
+        }
+
+        void on_depth_update(const depth_update_t &update) {
+            map_book_t::update(bids, update.bids);
+            map_book_t::update(asks, update.asks);
+        }
+    };
+
+    // Parses the updates without touching a book, to separate parsing from apply cost
+    struct parse_only_t {
+        double sum = 0.;
+
+        void on_depth_update(const depth_update_t &update) {
+            update.bids.for_each([&](depth_level_t const &level) { sum += level.quantity; });
+            update.asks.for_each([&](depth_level_t const &level) { sum += level.quantity; });
+        }
+    };
+
+    template<typename book_t>
+    void replay(benchmark::State &state, book_t &book, std::function<void(book_t &, depth_snapshot_t const &)> load) {
+        depth_snapshot_t snapshot;
+        binance_future_parser_t::parse_depth_snapshot(fixture.snapshot, snapshot);
+        const auto now = std::chrono::system_clock::now();
+        for (auto _ : state) {
+            state.PauseTiming();
+            load(book, snapshot);
+            state.ResumeTiming();
+            for (auto const &message : fixture.messages) {
+                binance_future_parser_t::parse(now, message, book);
+            }
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * message_count));
+        state.counters["ns_per_level"] = benchmark::Counter(
+            static_cast<double>(state.iterations() * fixture.levels),
+            benchmark::Counter::kIsRate | benchmark::Counter::kInvert);
+    }
+}
+
+// ============================================================================
+// Parse + apply of 10k diff updates (items = messages)
+// ============================================================================
+
+static void bm_order_book_parse_only(benchmark::State &state) {
+    parse_only_t listener;
+    replay<parse_only_t>(state, listener, [](parse_only_t &, depth_snapshot_t const &) {});
+    benchmark::DoNotOptimize(listener.sum);
+}
+
+static void bm_order_book_flat(benchmark::State &state) {
+    order_book_t book(tick_size);
+    replay<order_book_t>(state, book, [](order_book_t &b, depth_snapshot_t const &snapshot) { b.apply_snapshot(snapshot); });
+    if (!book.synced() || book.gaps() != 0) state.SkipWithError("order book lost sync");
+}
+
+static void bm_order_book_std_map(benchmark::State &state) {
+    map_book_t book;
+    replay<map_book_t>(state, book, [](map_book_t &b, depth_snapshot_t const &snapshot) { b.load(snapshot); });
+}
+
+// ============================================================================
+// Queries on a loaded book
+// ============================================================================
+
+static void bm_order_book_top(benchmark::State &state) {
+    order_book_t book(tick_size);
+    depth_snapshot_t snapshot;
+    binance_future_parser_t::parse_depth_snapshot(fixture.snapshot, snapshot);
+    book.apply_snapshot(snapshot);
+
+    std::vector<book_level_t> levels(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(book.top(book_side_t::bid, levels));
+        benchmark::ClobberMemory();
+    }
+}
+
+static void bm_order_book_vwap(benchmark::State &state) {
+    order_book_t book(tick_size);
+    depth_snapshot_t snapshot;
+    binance_future_parser_t::parse_depth_snapshot(fixture.snapshot, snapshot);
+    book.apply_snapshot(snapshot);
+
+    const auto size = static_cast<double>(state.range(0));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(book.vwap_to_size(book_side_t::ask, size));
+    }
+}
+
+BENCHMARK(bm_order_book_parse_only)->Unit(benchmark::kMicrosecond);
+BENCHMARK(bm_order_book_flat)->Unit(benchmark::kMicrosecond);
+BENCHMARK(bm_order_book_std_map)->Unit(benchmark::kMicrosecond);
+BENCHMARK(bm_order_book_top)->Arg(5)->Arg(20);
+BENCHMARK(bm_order_book_vwap)->Arg(10)->Arg(100);
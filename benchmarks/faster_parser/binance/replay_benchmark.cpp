@@ -0,0 +1,151 @@
+/**
+ * @file replay_benchmark.cpp
+ * @author Kevin Rodrigues
+ * @brief Scaling benchmark for memory-mapped multi-core capture replay
+ * @version 1.0
+ * @date 16/10/2026
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include <benchmark/benchmark.h>
+
+#include <faster_parser/binance/replay.h>
+#include <faster_parser/core/mapped_file.h>
+
+using namespace core::faster_parser;
+using namespace core::faster_parser::binance;
+using namespace core::faster_parser::binance::types;
+
+class CountingListener {
+public:
+    size_t events = 0;
+    double sum = 0;
+
+    void on_book_ticker(const book_ticker_t& ticker) {
+        ++events;
+        sum += ticker.bid.price;
+    }
+
+    void on_trade(const trade_t& trade) {
+        ++events;
+        sum += trade.price;
+    }
+
+    void on_ticker(const ticker_t& ticker) {
+        ++events;
+        sum += ticker.last_price;
+    }
+};
+
+// Synthetic daily capture: 3 book tickers for every trade, written once per size to the temp directory
+static const mapped_file_t &capture_file(size_t size) {
+    static std::map<size_t, mapped_file_t> files;
+    auto it = files.find(size);
+    if (it != files.end()) return it->second;
+
+    auto path = std::filesystem::temp_directory_path() / ("faster_parser_capture_" + std::to_string(size) + ".ndjson");
+    if (!std::filesystem::exists(path) || std::filesystem::file_size(path) < size) {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        std::mt19937_64 rng(42);
+        char buffer[256];
+        size_t written = 0;
+        for (uint64_t i = 0; written < size; ++i) {
+            double price = 100.0 + static_cast<double>(rng() % 1000000) / 100.0;
+            uint64_t time = 1760083106579ULL + i;
+            int length;
+            if (i % 4 == 3) {
+                length = std::snprintf(buffer, sizeof(buffer),
+                                       R"({"e":"aggTrade","E":%llu,"s":"BTCUSDT","a":%llu,"p":"%.2f","q":"%.3f","f":%llu,"l":%llu,"T":%llu,"m":%s})" "\n",
+                                       static_cast<unsigned long long>(time + 1), static_cast<unsigned long long>(i), price,
+                                       static_cast<double>(rng() % 100000) / 1000.0, static_cast<unsigned long long>(i * 3),
+                                       static_cast<unsigned long long>(i * 3 + 2), static_cast<unsigned long long>(time),
+                                       (rng() & 1) ? "true" : "false");
+            } else {
+                length = std::snprintf(buffer, sizeof(buffer),
+                                       R"({"e":"bookTicker","u":%llu,"s":"ETHUSDT","b":"%.2f","B":"%.3f","a":"%.2f","A":"%.3f","T":%llu,"E":%llu})" "\n",
+                                       static_cast<unsigned long long>(i), price, static_cast<double>(rng() % 100000) / 1000.0,
+                                       price + 0.01, static_cast<double>(rng() % 100000) / 1000.0,
+                                       static_cast<unsigned long long>(time), static_cast<unsigned long long>(time + 1));
+            }
+            out.write(buffer, length);
+            written += static_cast<size_t>(length);
+        }
+    }
+
+    return files.emplace(size, mapped_file_t(path.c_str())).first->second;
+}
+
+// ============================================================================
+// Replay Benchmarks
+// ============================================================================
+
+static void bm_replay_parallel(benchmark::State &state) {
+    const mapped_file_t &file = capture_file(static_cast<size_t>(state.range(0)));
+    const size_t threads = static_cast<size_t>(state.range(1));
+    auto now = std::chrono::system_clock::now();
+    size_t events = 0;
+
+    for (auto _ : state) {
+        std::vector<CountingListener> listeners(threads);
+        size_t consumed = replay_parallel(file.view(), std::span(listeners), now);
+        benchmark::DoNotOptimize(consumed);
+        events = 0;
+        for (auto const &listener : listeners) events += listener.events;
+    }
+
+    state.SetBytesProcessed(state.iterations() * file.size());
+    state.SetItemsProcessed(state.iterations() * events);
+    state.counters["file_mb"] = static_cast<double>(file.size()) / (1 << 20);
+}
+
+static void bm_replay_ordered(benchmark::State &state) {
+    const mapped_file_t &file = capture_file(static_cast<size_t>(state.range(0)));
+    const size_t threads = static_cast<size_t>(state.range(1));
+    auto now = std::chrono::system_clock::now();
+
+    for (auto _ : state) {
+        CountingListener listener;
+        size_t consumed = replay_ordered(file.view(), threads, listener, now);
+        benchmark::DoNotOptimize(consumed);
+        benchmark::DoNotOptimize(listener.sum);
+    }
+
+    state.SetBytesProcessed(state.iterations() * file.size());
+    state.counters["file_mb"] = static_cast<double>(file.size()) / (1 << 20);
+}
+
+// File sizes x thread counts from 1 up to the number of hardware threads
+static void replay_args(benchmark::internal::Benchmark *benchmark, std::vector<int64_t> const &sizes) {
+    const int64_t max_threads = std::max<int64_t>(1, std::thread::hardware_concurrency());
+    for (int64_t size : sizes) {
+        for (int64_t threads = 1; threads < max_threads; threads *= 2) {
+            benchmark->Args({size, threads});
+        }
+        benchmark->Args({size, max_threads});
+    }
+}
+
+// ============================================================================
+// Register Benchmarks
+// ============================================================================
+
+BENCHMARK(bm_replay_parallel)
+    ->Apply([](auto *b) { replay_args(b, {int64_t{64} << 20, int64_t{512} << 20, int64_t{2} << 30}); })
+    ->ArgNames({"bytes", "threads"})
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK(bm_replay_ordered)
+    ->Apply([](auto *b) { replay_args(b, {int64_t{64} << 20, int64_t{512} << 20}); })
+    ->ArgNames({"bytes", "threads"})
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
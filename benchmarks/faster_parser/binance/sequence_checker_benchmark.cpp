@@ -0,0 +1,129 @@
+/**
+ * @file sequence_checker_benchmark.cpp
+ * @author Kevin Rodrigues
+ * @brief Per-message overhead of in-parse sequence checks against a hash map lookup
+ * @version 1.0
+ * @date 16/10/2026
+ */
+
+#include <chrono>
+#include <random>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include <benchmark/benchmark.h>
+
+#include <faster_parser/binance/future.h>
+#include <faster_parser/binance/listeners/sequence_checker.h>
+
+using namespace core::faster_parser::binance;
+using namespace core::faster_parser::binance::types;
+
+namespace {
+    constexpr size_t symbol_count = 300;
+    constexpr size_t message_count = 30'000;
+
+    // Half bookTicker, half aggTrade over 300 symbols, ids increasing per symbol
+    struct fixture_t {
+        std::vector<std::string> names;
+        std::string buffer;
+
+        fixture_t() {
+            for (size_t i = 0; i < symbol_count; ++i) names.push_back("SYM" + std::to_string(i) + "USDT");
+            std::mt19937_64 rng(7);
+            std::uniform_int_distribution<size_t> pick(0, symbol_count - 1);
+            std::vector<uint64_t> book_ids(symbol_count, 1000), trade_ids(symbol_count, 5000);
+            for (size_t m = 0; m < message_count; ++m) {
+                const size_t s = pick(rng);
+                if (m % 2 == 0) {
+                    book_ids[s] += 1 + m % 7;
+                    buffer += R"({"e":"bookTicker","u":)" + std::to_string(book_ids[s]) + R"(,"s":")" + names[s] +
+                              R"(","b":"1.5822000","B":"457","a":"1.5823000","A":"112","T":1760083106579,"E":1760083106579})" "\n";
+                } else {
+                    ++trade_ids[s];
+                    buffer += R"({"e":"aggTrade","E":123456789,"s":")" + names[s] + R"(","a":)" + std::to_string(trade_ids[s]) +
+                              R"(,"p":"0.001","q":"100","f":100,"l":105,"T":123456785,"m":true})" "\n";
+                }
+            }
+        }
+    };
+
+    const fixture_t fixture;
+
+    struct sink_t {
+        uint64_t sum = 0;
+        void on_book_ticker(const book_ticker_t &ticker) { sum += ticker.bid.sequence; }
+        void on_trade(const trade_t &trade) { sum += trade.agg_trade_id; }
+    };
+
+    // Baseline: last ids in hash maps keyed by symbol, looked up after parsing
+    struct hash_map_checker_t {
+        sink_t &sink;
+        std::unordered_map<std::string_view, uint64_t> book_ids;
+        std::unordered_map<std::string_view, uint64_t> trade_ids;
+        uint64_t breaks = 0;
+
+        void on_book_ticker(const book_ticker_t &ticker) {
+            uint64_t &last = book_ids[ticker.symbol];
+            breaks += ticker.bid.sequence <= last;
+            last = ticker.bid.sequence;
+            sink.on_book_ticker(ticker);
+        }
+
+        void on_trade(const trade_t &trade) {
+            uint64_t &last = trade_ids[trade.symbol];
+            breaks += last != 0 && trade.agg_trade_id != last + 1;
+            last = trade.agg_trade_id;
+            sink.on_trade(trade);
+        }
+
+        void reset() {
+            for (auto &[symbol, last] : book_ids) last = 0;
+            for (auto &[symbol, last] : trade_ids) last = 0;
+        }
+    };
+}
+
+// ============================================================================
+// Parse 30k messages (items = messages)
+// ============================================================================
+
+static void bm_sequence_unchecked(benchmark::State &state) {
+    sink_t sink;
+    const auto now = std::chrono::system_clock::now();
+    for (auto _ : state) {
+        binance_future_parser_t::parse_stream(now, fixture.buffer, sink);
+    }
+    benchmark::DoNotOptimize(sink.sum);
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * message_count));
+}
+
+static void bm_sequence_checker(benchmark::State &state) {
+    sink_t sink;
+    listeners::sequence_checker_t checker(sink, symbol_count);
+    const auto now = std::chrono::system_clock::now();
+    for (auto _ : state) {
+        checker.reset();                                        // Replaying the same ids
+        binance_future_parser_t::parse_stream(now, fixture.buffer, checker);
+    }
+    benchmark::DoNotOptimize(sink.sum);
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * message_count));
+    if (checker.gaps() + checker.duplicates() + checker.regressions() != 0) state.SkipWithError("unexpected sequence break");
+}
+
+static void bm_sequence_hash_map(benchmark::State &state) {
+    sink_t sink;
+    hash_map_checker_t checker{sink, {}, {}, 0};
+    const auto now = std::chrono::system_clock::now();
+    for (auto _ : state) {
+        checker.reset();
+        binance_future_parser_t::parse_stream(now, fixture.buffer, checker);
+    }
+    benchmark::DoNotOptimize(sink.sum);
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * message_count));
+}
+
+BENCHMARK(bm_sequence_unchecked)->Unit(benchmark::kMicrosecond);
+BENCHMARK(bm_sequence_checker)->Unit(benchmark::kMicrosecond);
+BENCHMARK(bm_sequence_hash_map)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,122 @@
+/**
+ * @file sharded_benchmark.cpp
+ * @author Kevin Rodrigues
+ * @brief Scaling of the symbol-sharded pipeline from 1 to 8 workers on a mixed replay
+ * @version 1.0
+ * @date 16/10/2026
+ *
+ * The replay interleaves bookTicker, aggTrade and 24hrTicker messages over 64 symbols.
+ * The router runs on the benchmark thread and workers are pinned to cores 1..N when that
+ * many CPUs exist (run benchmarks/prepare_ultra7_265.sh first for stable figures).
+ */
+
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+#include <benchmark/benchmark.h>
+
+#include <faster_parser/binance/future.h>
+#include <faster_parser/binance/sharded.h>
+
+using namespace core::faster_parser::binance;
+using namespace core::faster_parser::binance::types;
+
+namespace {
+    constexpr size_t replay_messages = 100'000;
+    constexpr size_t replay_symbols = 64;
+
+    std::string build_replay() {
+        std::string out;
+        out.reserve(replay_messages * 200);
+        for (size_t i = 0; i < replay_messages; ++i) {
+            const std::string symbol = "SYM" + std::to_string(i * 7919 % replay_symbols) + "USDT";
+            const std::string id = std::to_string(1000 + i);
+            switch (i % 8) {
+                case 0:
+                    out += R"({"e":"24hrTicker","E":1,"s":")" + symbol + R"(","p":"0.0015","P":"250.00","w":"0.0018","c":"0.0025","Q":"10","o":"0.0010","h":"0.0025","l":"0.0010","v":"10000","q":"18","O":0,"C":86400000,"F":0,"L":18150,"n":)" + id + "}\n";
+                    break;
+                case 1: case 2: case 3:
+                    out += R"({"e":"aggTrade","E":123456789,"s":")" + symbol + R"(","a":)" + id + R"(,"p":"0.001","q":"100","f":100,"l":105,"T":123456785,"m":true})" "\n";
+                    break;
+                default:
+                    out += R"({"e":"bookTicker","u":)" + id + R"(,"s":")" + symbol + R"(","b":"25.35190000","B":"31.21000000","a":"25.36520000","A":"40.66000000","T":1568014460891,"E":1568014460893})" "\n";
+                    break;
+            }
+        }
+        return out;
+    }
+
+    const std::string replay = build_replay();
+
+    class SumListener {
+    public:
+        uint64_t events = 0;
+        double sum = 0;
+
+        void on_book_ticker(const book_ticker_t &ticker) {
+            ++events;
+            sum += ticker.bid.price + ticker.ask.price;
+        }
+
+        void on_trade(const trade_t &trade) {
+            ++events;
+            sum += trade.price * trade.quantity;
+        }
+
+        void on_ticker(const ticker_t &ticker) {
+            ++events;
+            sum += ticker.last_price;
+        }
+    };
+}
+
+// ============================================================================
+// Baseline: one core parses everything
+// ============================================================================
+
+static void bm_single_core(benchmark::State &state) {
+    for (auto _ : state) {
+        SumListener listener;
+        binance_future_parser_t::parse_stream(std::chrono::system_clock::now(), replay, listener);
+        benchmark::DoNotOptimize(listener.sum);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * replay_messages));
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * replay.size()));
+}
+
+// ============================================================================
+// Router + N workers
+// ============================================================================
+
+static void bm_sharded(benchmark::State &state) {
+    const auto workers = static_cast<size_t>(state.range(0));
+    sharded_pipeline_options_t options;
+    for (size_t i = 0; i < workers; ++i) {
+        if (i + 1 < std::thread::hardware_concurrency()) options.worker_cores.push_back(static_cast<int>(i + 1));
+    }
+
+    uint64_t stalls = 0;
+    for (auto _ : state) {
+        std::vector<SumListener> listeners(workers);
+        {
+            sharded_pipeline_t<SumListener> pipeline(listeners, options);
+            pipeline.route_stream(std::chrono::system_clock::now(), replay);
+            pipeline.stop();
+            stalls += pipeline.stalls();
+        }
+        uint64_t events = 0;
+        for (auto const &listener : listeners) events += listener.events;
+        if (events != replay_messages) state.SkipWithError("events lost");
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * replay_messages));
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * replay.size()));
+    state.counters["stalls"] = benchmark::Counter(static_cast<double>(stalls), benchmark::Counter::kAvgIterations);
+}
+
+// ============================================================================
+// Register Benchmarks
+// ============================================================================
+
+BENCHMARK(bm_single_core)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(bm_sharded)->ArgName("workers")->Arg(1)->Arg(2)->Arg(4)->Arg(8)->Unit(benchmark::kMillisecond)->UseRealTime();
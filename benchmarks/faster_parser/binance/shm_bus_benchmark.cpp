@@ -0,0 +1,134 @@
+/**
+ * @file shm_bus_benchmark.cpp
+ * @author Kevin Rodrigues
+ * @brief One publisher process to 1-8 reader processes over the shared-memory event bus
+ * @version 1.0
+ * @date 16/10/2026
+ *
+ * The benchmark thread parses a replay once and publishes it; each reader is a forked
+ * process polling the bus and measuring publish-to-read latency from the slot's receive
+ * time. Readers that fall a whole ring behind report the events they lost.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <new>
+#include <string>
+#include <vector>
+#include <benchmark/benchmark.h>
+
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <faster_parser/binance/future.h>
+#include <faster_parser/binance/listeners/bus_publisher.h>
+
+using namespace core::faster_parser::binance;
+using namespace core::faster_parser::binance::types;
+
+namespace {
+    constexpr size_t messages_per_run = 200'000;
+    constexpr size_t bus_capacity = 1 << 16;
+    constexpr size_t max_readers = 8;
+
+    const std::string replay = [] {
+        std::string out;
+        for (size_t i = 0; i < messages_per_run; ++i) {
+            out += (i & 1)
+                ? R"({"e":"aggTrade","E":123456789,"s":"BTCUSDT","a":5933014,"p":"0.001","q":"100","f":100,"l":105,"T":123456785,"m":true})" "\n"
+                : R"({"e":"bookTicker","u":400900217,"s":"BNBUSDT","b":"25.35190000","B":"31.21000000","a":"25.36520000","A":"40.66000000","T":1568014460891,"E":1568014460893})" "\n";
+        }
+        return out;
+    }();
+
+    // Anonymous shared mapping created before fork(): start/stop flags and per-reader results
+    struct control_t {
+        std::atomic<bool> done{false};
+        struct result_t {
+            uint64_t received;
+            uint64_t lost;
+            uint64_t p50_ns;
+            uint64_t p99_ns;
+        } results[max_readers];
+    };
+
+    void read_until_done(const char *name, control_t &control, size_t index) {
+        listeners::event_bus_reader_t reader;
+        if (!reader.open(name)) ::_exit(1);
+
+        std::vector<uint64_t> latencies;
+        latencies.reserve(messages_per_run);
+        auto on_event = [&](event_slot_t const &slot) {
+            latencies.push_back(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::system_clock::now() - slot.time()).count()));
+        };
+        while (true) {
+            if (reader.poll(on_event) != 0) continue;
+            if (control.done.load(std::memory_order_acquire) && reader.lag() == 0) break;
+        }
+
+        auto &result = control.results[index];
+        result.received = latencies.size();
+        result.lost = reader.lost();
+        if (!latencies.empty()) {
+            std::sort(latencies.begin(), latencies.end());
+            result.p50_ns = latencies[latencies.size() / 2];
+            result.p99_ns = latencies[latencies.size() * 99 / 100];
+        }
+        ::_exit(0);
+    }
+}
+
+static void bm_shm_bus_fanout(benchmark::State &state) {
+    const auto readers = static_cast<size_t>(state.range(0));
+    const std::string name = "/faster_parser_bench_" + std::to_string(::getpid());
+
+    void *shared = ::mmap(nullptr, sizeof(control_t), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (shared == MAP_FAILED) {
+        state.SkipWithError("mmap failed");
+        return;
+    }
+
+    double lost = 0, p50 = 0, p99 = 0;
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto *control = new (shared) control_t();
+        listeners::event_bus_writer_t bus;
+        if (!bus.create(name.c_str(), bus_capacity)) {
+            state.SkipWithError("shm_open failed");
+            break;
+        }
+        std::vector<pid_t> children;
+        for (size_t i = 0; i < readers; ++i) {
+            pid_t pid = ::fork();
+            if (pid == 0) read_until_done(name.c_str(), *control, i);
+            children.push_back(pid);
+        }
+        while (bus.readers() < readers) ::usleep(100);
+        state.ResumeTiming();
+
+        listeners::event_bus_publisher_t publisher(bus);
+        binance_future_parser_t::parse_stream(std::chrono::system_clock::now(), replay, publisher);
+        control->done.store(true, std::memory_order_release);
+        for (pid_t pid : children) ::waitpid(pid, nullptr, 0);
+
+        state.PauseTiming();
+        for (size_t i = 0; i < readers; ++i) {
+            lost += static_cast<double>(control->results[i].lost);
+            p50 = std::max(p50, static_cast<double>(control->results[i].p50_ns));
+            p99 = std::max(p99, static_cast<double>(control->results[i].p99_ns));
+        }
+        state.ResumeTiming();
+    }
+
+    ::munmap(shared, sizeof(control_t));
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * messages_per_run));
+    state.counters["lost/reader"] = benchmark::Counter(lost / static_cast<double>(readers), benchmark::Counter::kAvgIterations);
+    state.counters["worst_p50_ns"] = p50;
+    state.counters["worst_p99_ns"] = p99;
+}
+
+BENCHMARK(bm_shm_bus_fanout)->ArgName("readers")->Arg(1)->Arg(2)->Arg(4)->Arg(8)->Unit(benchmark::kMillisecond)->UseRealTime();
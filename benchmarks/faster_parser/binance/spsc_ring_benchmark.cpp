@@ -0,0 +1,184 @@
+/**
+ * @file spsc_ring_benchmark.cpp
+ * @author Kevin Rodrigues
+ * @brief Parse-to-consumer latency through the SPSC event ring vs a mutex-guarded deque
+ * @version 1.0
+ * @date 16/10/2026
+ *
+ * The parser and the consumer run on two pinned cores. On the Ultra 7 265 box, run
+ * benchmarks/prepare_ultra7_265.sh first and keep both threads inside the isolated set
+ * (the defaults pin the parser to core 2 and the consumer to core 3). With fewer CPUs
+ * than requested, the threads are left unpinned and the figures mostly measure the
+ * scheduler.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <benchmark/benchmark.h>
+
+#include <pthread.h>
+#include <sched.h>
+
+#include <faster_parser/binance/future.h>
+#include <faster_parser/binance/listeners/ring_writer.h>
+
+using namespace core::faster_parser::binance;
+using namespace core::faster_parser::binance::types;
+
+namespace {
+    constexpr size_t messages_per_run = 200'000;
+    constexpr int parser_core = 2;
+    constexpr int consumer_core = 3;
+
+    const std::string messages[] = {
+        R"({"e":"bookTicker","u":400900217,"s":"BNBUSDT","b":"25.35190000","B":"31.21000000","a":"25.36520000","A":"40.66000000","T":1568014460891,"E":1568014460893})",
+        R"({"e":"aggTrade","E":123456789,"s":"BTCUSDT","a":5933014,"p":"0.001","q":"100","f":100,"l":105,"T":123456785,"m":true})",
+    };
+
+    void pin_current_thread(int core) {
+        if (core >= static_cast<int>(std::thread::hardware_concurrency())) return;
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(core, &set);
+        pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+    }
+
+    // Parse on the pinned parser thread; each message is stamped with its own receive time
+    template<typename listener_t, typename flush_t>
+    void produce(listener_t &listener, flush_t &&flush) {
+        pin_current_thread(parser_core);
+        for (size_t i = 0; i < messages_per_run; ++i) {
+            binance_future_parser_t::parse(std::chrono::system_clock::now(), messages[i & 1], listener);
+            if ((i & 15) == 15) flush();
+        }
+        flush();
+    }
+
+    uint64_t since(std::chrono::system_clock::time_point time) {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::system_clock::now() - time).count());
+    }
+
+    void report(benchmark::State &state, std::vector<uint64_t> &latencies, uint64_t dropped) {
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * messages_per_run));
+        state.counters["dropped"] = benchmark::Counter(static_cast<double>(dropped), benchmark::Counter::kAvgIterations);
+        if (latencies.empty()) return;
+        std::sort(latencies.begin(), latencies.end());
+        state.counters["p50_ns"] = static_cast<double>(latencies[latencies.size() / 2]);
+        state.counters["p99_ns"] = static_cast<double>(latencies[latencies.size() * 99 / 100]);
+        state.counters["p999_ns"] = static_cast<double>(latencies[latencies.size() * 999 / 1000]);
+    }
+
+    // Baseline: the same events copied into a std::deque under a mutex
+    class locked_queue_writer_t {
+    public:
+        std::mutex mutex;
+        std::deque<event_slot_t> queue;
+
+        void on_book_ticker(const book_ticker_t &ticker) {
+            event_slot_t slot;
+            slot.assign(ticker);
+            std::lock_guard lock(mutex);
+            queue.push_back(slot);
+        }
+
+        void on_trade(const trade_t &trade) {
+            event_slot_t slot;
+            slot.assign(trade);
+            std::lock_guard lock(mutex);
+            queue.push_back(slot);
+        }
+
+        void on_ticker(const ticker_t &) {}
+    };
+}
+
+// ============================================================================
+// SPSC ring, parser writes slots in place
+// ============================================================================
+
+// slot_t: event_slot_t (three lines) or book_trade_slot_t (two lines)
+template<typename slot_t>
+static void bm_spsc_ring(benchmark::State &state) {
+    const size_t batch_size = static_cast<size_t>(state.range(0));
+    std::vector<uint64_t> latencies;
+    latencies.reserve(messages_per_run);
+    uint64_t dropped = 0;
+
+    for (auto _ : state) {
+        typename listeners::basic_event_ring_writer_t<slot_t>::ring_t ring(4096);
+        listeners::basic_event_ring_writer_t<slot_t> writer(ring, batch_size);
+        std::atomic<bool> done{false};
+        latencies.clear();
+
+        std::thread producer([&] {
+            produce(writer, [&] { writer.flush(); });
+            done.store(true, std::memory_order_release);
+        });
+
+        pin_current_thread(consumer_core);
+        auto on_slot = [&](slot_t const &slot) { latencies.push_back(since(slot.time())); };
+        while (!done.load(std::memory_order_acquire)) {
+            if (ring.consume(on_slot) == 0) std::this_thread::yield();
+        }
+        ring.consume(on_slot);
+        producer.join();
+        dropped += writer.dropped();
+    }
+
+    report(state, latencies, dropped);
+}
+
+// ============================================================================
+// Baseline: mutex + std::deque
+// ============================================================================
+
+static void bm_locked_deque(benchmark::State &state) {
+    std::vector<uint64_t> latencies;
+    latencies.reserve(messages_per_run);
+    std::deque<event_slot_t> drained;
+
+    for (auto _ : state) {
+        locked_queue_writer_t writer;
+        std::atomic<bool> done{false};
+        latencies.clear();
+
+        std::thread producer([&] {
+            produce(writer, [] {});
+            done.store(true, std::memory_order_release);
+        });
+
+        pin_current_thread(consumer_core);
+        auto drain = [&] {
+            {
+                std::lock_guard lock(writer.mutex);
+                drained.swap(writer.queue);
+            }
+            for (auto const &slot : drained) latencies.push_back(since(slot.time()));
+            const bool empty = drained.empty();
+            drained.clear();
+            return !empty;
+        };
+        while (!done.load(std::memory_order_acquire)) {
+            if (!drain()) std::this_thread::yield();
+        }
+        drain();
+        producer.join();
+    }
+
+    report(state, latencies, 0);
+}
+
+// ============================================================================
+// Register Benchmarks
+// ============================================================================
+
+BENCHMARK_TEMPLATE(bm_spsc_ring, event_slot_t)->ArgName("batch")->Arg(1)->Arg(16)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK_TEMPLATE(bm_spsc_ring, book_trade_slot_t)->ArgName("batch")->Arg(1)->Arg(16)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(bm_locked_deque)->Unit(benchmark::kMillisecond)->UseRealTime();
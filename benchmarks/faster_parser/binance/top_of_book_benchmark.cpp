@@ -0,0 +1,130 @@
+/**
+ * @file top_of_book_benchmark.cpp
+ * @author Kevin Rodrigues
+ * @brief Update and snapshot throughput of the seqlock top-of-book table under contention
+ * @version 1.0
+ * @date 16/10/2026
+ */
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+#include <benchmark/benchmark.h>
+
+#include <faster_parser/binance/listeners/top_of_book.h>
+
+using namespace core::faster_parser::binance;
+using namespace core::faster_parser::binance::types;
+
+namespace {
+    constexpr size_t symbol_count = 256;
+
+    struct fixture_t {
+        std::vector<std::string> names;
+        std::vector<book_ticker_t> tickers;
+
+        fixture_t() {
+            names.reserve(symbol_count);
+            for (size_t i = 0; i < symbol_count; ++i) names.push_back("SYM" + std::to_string(i) + "USDT");
+            for (size_t i = 0; i < symbol_count; ++i) {
+                book_ticker_t ticker;
+                ticker.symbol = names[i];
+                ticker.bid.price = 100. + static_cast<double>(i);
+                ticker.ask.price = 100.5 + static_cast<double>(i);
+                tickers.push_back(ticker);
+            }
+        }
+    };
+
+    const fixture_t fixture;
+
+    // Spin on snapshots of every symbol until stopped; returns the number of snapshots taken
+    uint64_t read_loop(listeners::top_of_book_table_t const &table, std::atomic<bool> const &stop) {
+        uint64_t reads = 0;
+        listeners::top_of_book_t book;
+        symbol_id_t id = 0;
+        while (!stop.load(std::memory_order_relaxed)) {
+            reads += table.snapshot(id, book);
+            benchmark::DoNotOptimize(book);
+            id = (id + 1) % symbol_count;
+        }
+        return reads;
+    }
+}
+
+// ============================================================================
+// Writer throughput while 0-4 reader threads snapshot the table
+// ============================================================================
+
+static void bm_update_under_readers(benchmark::State &state) {
+    listeners::top_of_book_table_t table(symbol_count);
+    for (auto const &name : fixture.names) table.intern(name);
+
+    std::atomic<bool> stop{false};
+    std::vector<uint64_t> reads(static_cast<size_t>(state.range(0)), 0);
+    std::vector<std::thread> readers;
+    for (size_t i = 0; i < reads.size(); ++i) {
+        readers.emplace_back([&, i] { reads[i] = read_loop(table, stop); });
+    }
+
+    uint64_t update_id = 1;
+    for (auto _ : state) {
+        for (auto ticker : fixture.tickers) {
+            ticker.bid.sequence = update_id;
+            table.on_book_ticker(ticker);
+        }
+        ++update_id;
+    }
+
+    stop.store(true);
+    for (auto &reader : readers) reader.join();
+    uint64_t total_reads = 0;
+    for (uint64_t count : reads) total_reads += count;
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * symbol_count));
+    state.counters["reads"] = benchmark::Counter(static_cast<double>(total_reads), benchmark::Counter::kIsRate);
+}
+
+// ============================================================================
+// Snapshot throughput with and without a writer updating the same lines
+// ============================================================================
+
+static void bm_snapshot_under_writer(benchmark::State &state) {
+    listeners::top_of_book_table_t table(symbol_count);
+    for (auto const &ticker : fixture.tickers) table.on_book_ticker(ticker);
+
+    std::atomic<bool> stop{false};
+    std::thread writer;
+    if (state.range(0)) {
+        writer = std::thread([&] {
+            uint64_t update_id = 1;
+            while (!stop.load(std::memory_order_relaxed)) {
+                for (auto ticker : fixture.tickers) {
+                    ticker.bid.sequence = update_id;
+                    table.on_book_ticker(ticker);
+                }
+                ++update_id;
+            }
+        });
+    }
+
+    listeners::top_of_book_t book;
+    for (auto _ : state) {
+        for (symbol_id_t id = 0; id < symbol_count; ++id) {
+            table.snapshot(id, book);
+            benchmark::DoNotOptimize(book);
+        }
+    }
+
+    stop.store(true);
+    if (writer.joinable()) writer.join();
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * symbol_count));
+}
+
+// ============================================================================
+// Register Benchmarks
+// ============================================================================
+
+BENCHMARK(bm_update_under_readers)->ArgName("readers")->Arg(0)->Arg(1)->Arg(2)->Arg(4)->UseRealTime();
+BENCHMARK(bm_snapshot_under_writer)->ArgName("writer")->Arg(0)->Arg(1)->UseRealTime();
@@ -0,0 +1,138 @@
+/**
+ * @file trace_benchmark.cpp
+ * @author Kevin Rodrigues
+ * @brief Cost of per-stage parse tracing and latency recording, and of timestamp counter reads against clock calls
+ * @version 1.0
+ * @date 16/10/2026
+ */
+
+#include <chrono>
+#include <string>
+#include <vector>
+#include <benchmark/benchmark.h>
+
+#include <faster_parser/binance/future.h>
+#include <faster_parser/binance/listeners/latency_recorder.h>
+
+using namespace core::faster_parser;
+using namespace core::faster_parser::binance;
+using namespace core::faster_parser::binance::types;
+
+namespace {
+    const std::vector<std::string> messages = {
+        R"({"e":"bookTicker","u":8822354685185,"s":"ASTERUSDT","b":"1.5822000","B":"457","a":"1.5823000","A":"112","T":1760083106579,"E":1760083106579})",
+        R"({"e":"aggTrade","E":123456789,"s":"BTCUSDT","a":5933014,"p":"0.001","q":"100","f":100,"l":105,"T":123456785,"m":true})",
+        R"({"e":"bookTicker","u":8822354685186,"s":"BTCUSDT","b":"112233.10","B":"3.211","a":"112233.20","A":"0.451","T":1760083106580,"E":1760083106580})",
+        R"({"e":"24hrTicker","E":123456789,"s":"BTCUSDT","p":"0.0015","P":"250.00","w":"0.0018","c":"0.0025","Q":"10","o":"0.0010","h":"0.0025","l":"0.0010","v":"10000","q":"18","O":0,"C":86400000,"F":0,"L":18150,"n":18151})",
+    };
+
+    struct sink_t {
+        uint64_t sum = 0;
+        void on_book_ticker(const book_ticker_t &ticker) { sum += ticker.bid.sequence; }
+        void on_trade(const trade_t &trade) { sum += trade.agg_trade_id; }
+        void on_ticker(const ticker_t &ticker) { sum += ticker.event_time; }
+    };
+}
+
+// ============================================================================
+// Parse, untraced and traced (items = messages)
+// ============================================================================
+
+static void bm_parse_untraced(benchmark::State &state) {
+    sink_t sink;
+    const auto now = std::chrono::system_clock::now();
+    for (auto _ : state) {
+        for (auto const &message : messages) benchmark::DoNotOptimize(binance_future_parser_t::parse(now, message, sink));
+    }
+    benchmark::DoNotOptimize(sink.sum);
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * messages.size()));
+}
+
+static void bm_parse_null_tracer(benchmark::State &state) {
+    sink_t sink;
+    null_tracer_t tracer;
+    const auto now = std::chrono::system_clock::now();
+    for (auto _ : state) {
+        for (auto const &message : messages) benchmark::DoNotOptimize(binance_future_parser_t::parse(now, message, sink, tracer));
+    }
+    benchmark::DoNotOptimize(sink.sum);
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * messages.size()));
+}
+
+static void bm_parse_traced(benchmark::State &state) {
+    sink_t sink;
+    parse_tracer_t tracer;
+    const auto now = std::chrono::system_clock::now();
+    for (auto _ : state) {
+        for (auto const &message : messages) benchmark::DoNotOptimize(binance_future_parser_t::parse(now, message, sink, tracer));
+    }
+    benchmark::DoNotOptimize(sink.sum);
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * messages.size()));
+
+    for (auto type : {trace_type_t::book_ticker, trace_type_t::trade, trace_type_t::ticker}) {
+        const char *name = type == trace_type_t::book_ticker ? "book" : type == trace_type_t::trade ? "trade" : "ticker";
+        state.counters[std::string(name) + "_extract_p50_ns"] = static_cast<double>(tracer.percentile_ns(type, trace_stage_t::extract, 50.));
+        state.counters[std::string(name) + "_total_p99_ns"] = static_cast<double>(tracer.percentile_ns(type, trace_stage_t::total, 99.));
+    }
+}
+
+static void bm_parse_latency_recorder(benchmark::State &state) {
+    sink_t sink;
+    listeners::latency_recorder_t recorder(sink);
+    const auto now = std::chrono::system_clock::now();
+    for (auto _ : state) {
+        for (auto const &message : messages) benchmark::DoNotOptimize(binance_future_parser_t::parse(now, message, recorder));
+    }
+    benchmark::DoNotOptimize(sink.sum);
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * messages.size()));
+}
+
+// Per-message parse time into a histogram: percentiles next to Google Benchmark's mean
+static void bm_parse_percentiles(benchmark::State &state) {
+    sink_t sink;
+    const tsc_clock_t clock = tsc_clock_t::calibrate();
+    latency_histogram_t histogram;
+    const auto now = std::chrono::system_clock::now();
+    for (auto _ : state) {
+        for (auto const &message : messages) {
+            const uint64_t start = read_tsc();
+            benchmark::DoNotOptimize(binance_future_parser_t::parse(now, message, sink));
+            histogram.record(read_tsc() - start);
+        }
+    }
+    benchmark::DoNotOptimize(sink.sum);
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * messages.size()));
+    state.counters["p50_ns"] = static_cast<double>(clock.to_ns(histogram.percentile(50.)));
+    state.counters["p99_ns"] = static_cast<double>(clock.to_ns(histogram.percentile(99.)));
+    state.counters["p99.9_ns"] = static_cast<double>(clock.to_ns(histogram.percentile(99.9)));
+    state.counters["max_ns"] = static_cast<double>(clock.to_ns(histogram.max()));
+}
+
+// ============================================================================
+// Timestamp sources (items = reads)
+// ============================================================================
+
+static void bm_read_tsc(benchmark::State &state) {
+    for (auto _ : state) benchmark::DoNotOptimize(read_tsc());
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+
+static void bm_tsc_clock_now(benchmark::State &state) {
+    const tsc_clock_t clock = tsc_clock_t::calibrate();
+    for (auto _ : state) benchmark::DoNotOptimize(clock.now());
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+
+static void bm_system_clock_now(benchmark::State &state) {
+    for (auto _ : state) benchmark::DoNotOptimize(std::chrono::system_clock::now());
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+
+BENCHMARK(bm_parse_untraced);
+BENCHMARK(bm_parse_null_tracer);
+BENCHMARK(bm_parse_traced);
+BENCHMARK(bm_parse_latency_recorder);
+BENCHMARK(bm_parse_percentiles);
+BENCHMARK(bm_read_tsc);
+BENCHMARK(bm_tsc_clock_now);
+BENCHMARK(bm_system_clock_now);
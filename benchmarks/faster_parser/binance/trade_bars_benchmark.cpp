@@ -0,0 +1,185 @@
+/**
+ * @file trade_bars_benchmark.cpp
+ * @author Kevin Rodrigues
+ * @brief Bar aggregation throughput on a multi-million trade replay
+ * @version 1.0
+ * @date 16/10/2026
+ */
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <benchmark/benchmark.h>
+
+#include <faster_parser/binance/listeners/trade_bars.h>
+
+using namespace core::faster_parser::binance;
+using namespace core::faster_parser::binance::types;
+
+namespace {
+    constexpr size_t symbol_count = 300;
+    constexpr size_t trade_count = 2'000'000;
+
+    // Compact replay record, expanded into a trade_t per callback
+    struct record_t {
+        uint32_t symbol;
+        uint32_t time_ms;                               // From the start of the replay
+        double price;
+        double quantity;
+        bool is_buyer_maker;
+    };
+
+    // 2M trades over ~1h: skewed symbol popularity, random-walk prices
+    struct fixture_t {
+        std::vector<std::string> names;
+        std::vector<record_t> records;
+
+        fixture_t() {
+            for (size_t i = 0; i < symbol_count; ++i) names.push_back("SYM" + std::to_string(i) + "USDT");
+            std::mt19937_64 rng(5);
+            std::geometric_distribution<uint32_t> pick(0.02);
+            std::exponential_distribution<double> size(1.);
+            std::normal_distribution<double> move(0., 0.0005);
+            std::bernoulli_distribution side(0.5);
+            std::vector<double> prices(symbol_count, 100.);
+
+            records.reserve(trade_count);
+            for (size_t i = 0; i < trade_count; ++i) {
+                const uint32_t s = std::min<uint32_t>(pick(rng), symbol_count - 1);
+                prices[s] *= 1. + move(rng);
+                records.push_back({s, static_cast<uint32_t>(i * 3'600'000 / trade_count), prices[s], size(rng), side(rng)});
+            }
+        }
+    };
+
+    const fixture_t fixture;
+    constexpr uint64_t start_ms = 1'760'083'200'000;
+
+    template<typename listener_t>
+    void replay(listener_t &listener) {
+        trade_t trade{};
+        uint64_t id = 0;
+        for (record_t const &record : fixture.records) {
+            trade.symbol = fixture.names[record.symbol];
+            trade.agg_trade_id = ++id;
+            trade.trade_time = start_ms + record.time_ms;
+            trade.price = record.price;
+            trade.quantity = record.quantity;
+            trade.is_buyer_maker = record.is_buyer_maker;
+            listener.on_trade(trade);
+        }
+    }
+
+    struct bar_counter_t {
+        double *sum;
+        void operator()(listeners::trade_bar_t const &bar) const { *sum += bar.vwap(); }
+    };
+
+    // Baseline: one node-based map per bar spec keyed by symbol string
+    struct map_time_bars_t {
+        struct bar_t {
+            uint64_t close_time = 0;
+            double open = 0., high = 0., low = 0., close = 0., volume = 0., quote_volume = 0., buy_volume = 0., sell_volume = 0.;
+            uint64_t trades = 0;
+        };
+
+        std::vector<uint64_t> intervals;
+        std::vector<std::unordered_map<std::string, bar_t>> bars;
+        double sum = 0.;
+
+        explicit map_time_bars_t(std::vector<uint64_t> intervals_ms) : intervals(std::move(intervals_ms)), bars(intervals.size()) {}
+
+        void on_trade(const trade_t &trade) {
+            for (size_t s = 0; s < intervals.size(); ++s) {
+                bar_t &bar = bars[s][std::string(trade.symbol)];
+                if (bar.trades && trade.trade_time >= bar.close_time) {
+                    sum += bar.quote_volume / bar.volume;
+                    bar = bar_t{};
+                }
+                if (!bar.trades) {
+                    bar.close_time = trade.trade_time - trade.trade_time % intervals[s] + intervals[s];
+                    bar.open = bar.high = bar.low = trade.price;
+                }
+                bar.high = std::max(bar.high, trade.price);
+                bar.low = std::min(bar.low, trade.price);
+                bar.close = trade.price;
+                bar.volume += trade.quantity;
+                bar.quote_volume += trade.price * trade.quantity;
+                (trade.is_buyer_maker ? bar.sell_volume : bar.buy_volume) += trade.quantity;
+                ++bar.trades;
+            }
+        }
+    };
+
+    struct noop_t {
+        void on_trade(const trade_t &trade) { benchmark::DoNotOptimize(trade); }
+    };
+}
+
+// ============================================================================
+// Full replay per iteration (items = trades)
+// ============================================================================
+
+static void bm_trade_bars_replay_only(benchmark::State &state) {
+    noop_t listener;
+    for (auto _ : state) replay(listener);
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * trade_count));
+}
+
+static void bm_trade_bars_1m(benchmark::State &state) {
+    const listeners::bar_spec_t specs[] = {{listeners::bar_kind_t::time, 60'000.}};
+    double sum = 0.;
+    for (auto _ : state) {
+        listeners::trade_bar_aggregator_t aggregator(specs, bar_counter_t{&sum}, symbol_count);
+        replay(aggregator);
+    }
+    benchmark::DoNotOptimize(sum);
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * trade_count));
+}
+
+static void bm_trade_bars_four_specs(benchmark::State &state) {
+    const listeners::bar_spec_t specs[] = {{listeners::bar_kind_t::time, 1'000.},
+                                           {listeners::bar_kind_t::time, 60'000.},
+                                           {listeners::bar_kind_t::volume, 100.},
+                                           {listeners::bar_kind_t::tick, 100.}};
+    double sum = 0.;
+    uint64_t emitted = 0;
+    for (auto _ : state) {
+        listeners::trade_bar_aggregator_t aggregator(specs, bar_counter_t{&sum}, symbol_count);
+        replay(aggregator);
+        emitted += aggregator.emitted();
+    }
+    benchmark::DoNotOptimize(sum);
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * trade_count));
+    state.counters["bars_per_replay"] = static_cast<double>(emitted) / static_cast<double>(state.iterations());
+}
+
+static void bm_trade_bars_std_map_1s_1m(benchmark::State &state) {
+    double sum = 0.;
+    for (auto _ : state) {
+        map_time_bars_t bars({1'000, 60'000});
+        replay(bars);
+        sum += bars.sum;
+    }
+    benchmark::DoNotOptimize(sum);
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * trade_count));
+}
+
+static void bm_trade_bars_1s_1m(benchmark::State &state) {
+    const listeners::bar_spec_t specs[] = {{listeners::bar_kind_t::time, 1'000.}, {listeners::bar_kind_t::time, 60'000.}};
+    double sum = 0.;
+    for (auto _ : state) {
+        listeners::trade_bar_aggregator_t aggregator(specs, bar_counter_t{&sum}, symbol_count);
+        replay(aggregator);
+    }
+    benchmark::DoNotOptimize(sum);
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * trade_count));
+}
+
+BENCHMARK(bm_trade_bars_replay_only)->Unit(benchmark::kMillisecond);
+BENCHMARK(bm_trade_bars_1m)->Unit(benchmark::kMillisecond);
+BENCHMARK(bm_trade_bars_1s_1m)->Unit(benchmark::kMillisecond);
+BENCHMARK(bm_trade_bars_std_map_1s_1m)->Unit(benchmark::kMillisecond);
+BENCHMARK(bm_trade_bars_four_specs)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,41 @@
+/**
+ * @file warm_benchmark.cpp
+ * @author Kevin Rodrigues
+ * @brief Cost of a warm() call, the budget it takes out of an idle period
+ * @version 1.0
+ * @date 16/10/2026
+ *
+ * Its effect on the first message after an idle period is measured by
+ * binance_latency_benchmarks --mode=cold --warm=discard|exact.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <faster_parser/binance/warm.h>
+
+using namespace core::faster_parser::binance;
+using namespace core::faster_parser::binance::types;
+
+namespace {
+    struct book_ticker_listener_t {
+        void on_book_ticker(const book_ticker_t &) {}
+    };
+
+    struct all_listener_t {
+        void on_book_ticker(const book_ticker_t &) {}
+        void on_trade(const trade_t &) {}
+        void on_ticker(const ticker_t &) {}
+        void on_depth_update(const depth_update_t &) {}
+    };
+}
+
+static void bm_warm_book_ticker(benchmark::State &state) {
+    for (auto _ : state) benchmark::DoNotOptimize(warm<book_ticker_listener_t>());
+}
+
+static void bm_warm_all_types(benchmark::State &state) {
+    for (auto _ : state) benchmark::DoNotOptimize(warm<all_listener_t>());
+}
+
+BENCHMARK(bm_warm_book_ticker);
+BENCHMARK(bm_warm_all_types);
@@ -0,0 +1,160 @@
+/**
+ * @file websocket_benchmark.cpp
+ * @author Kevin Rodrigues
+ * @brief Benchmarks for WebSocket frame decoding feeding the Binance parser
+ * @version 1.0
+ * @date 16/10/2026
+ */
+
+#include <chrono>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <benchmark/benchmark.h>
+
+#include <faster_parser/binance/websocket.h>
+#include <faster_parser/websocket/frame.h>
+
+using namespace core::faster_parser::binance;
+using namespace core::faster_parser::binance::types;
+using namespace core::faster_parser::websocket;
+
+class BenchmarkListener {
+public:
+    book_ticker_t last_book_ticker;
+    trade_t last_trade;
+    ticker_t last_ticker;
+
+    void on_book_ticker(const book_ticker_t& ticker) {
+        last_book_ticker = ticker;
+    }
+
+    void on_trade(const trade_t& trade) {
+        last_trade = trade;
+    }
+
+    void on_ticker(const ticker_t& ticker) {
+        last_ticker = ticker;
+    }
+};
+
+const std::vector<std::string> messages = {
+    R"({"e":"bookTicker","u":8822354685185,"s":"ASTERUSDT","b":"1.5822000","B":"457","a":"1.5823000","A":"112","T":1760083106579,"E":1760083106579})",
+    R"({"e":"aggTrade","E":123456789,"s":"BTCUSDT","a":5933014,"p":"0.001","q":"100","f":100,"l":105,"T":123456785,"m":true})",
+    R"({"e":"bookTicker","u":123456789,"s":"BTCUSDT","b":"45123.78900000","B":"10.5","a":"45124.12300000","A":"5.25","T":1234567890123,"E":1234567890123})",
+    R"({"e":"24hrTicker","E":123456789,"s":"BTCUSDT","p":"0.0015","P":"250.00","w":"0.0018","c":"0.0025","Q":"10","o":"0.0010","h":"0.0025","l":"0.0010","v":"10000","q":"18","O":0,"C":86400000,"F":0,"L":18150,"n":18151})",
+};
+
+constexpr size_t frames_per_buffer = 10'000;
+
+// Receive buffer holding frames_per_buffer unmasked server frames
+static std::string make_frames() {
+    std::string out;
+    for (size_t i = 0; i < frames_per_buffer; ++i) {
+        encode_frame(out, opcode_t::text, messages[i % messages.size()]);
+    }
+    return out;
+}
+
+// ============================================================================
+// Decode + parse vs parse only
+// ============================================================================
+
+static void bm_parse_only(benchmark::State &state) {
+    BenchmarkListener listener;
+    auto now = std::chrono::system_clock::now();
+    size_t bytes = 0;
+    for (size_t i = 0; i < frames_per_buffer; ++i) bytes += messages[i % messages.size()].size();
+
+    for (auto _ : state) {
+        for (size_t i = 0; i < frames_per_buffer; ++i) {
+            bool result = binance_future_parser_t::parse(now, messages[i % messages.size()], listener);
+            benchmark::DoNotOptimize(result);
+        }
+        benchmark::DoNotOptimize(listener.last_trade);
+    }
+
+    state.SetItemsProcessed(state.iterations() * frames_per_buffer);
+    state.SetBytesProcessed(state.iterations() * bytes);
+}
+
+static void bm_websocket_decode_parse(benchmark::State &state) {
+    std::string buffer = make_frames();
+    BenchmarkListener listener;
+    websocket_feed_t feed(listener);
+    auto now = std::chrono::system_clock::now();
+
+    for (auto _ : state) {
+        size_t consumed = feed.feed(now, std::span(buffer.data(), buffer.size()));
+        benchmark::DoNotOptimize(consumed);
+        benchmark::DoNotOptimize(listener.last_trade);
+    }
+
+    state.SetItemsProcessed(state.iterations() * frames_per_buffer);
+    state.SetBytesProcessed(state.iterations() * buffer.size());
+}
+
+// Masked frames are unmasked in place, so each iteration starts from a fresh copy (memcpy included)
+static void bm_websocket_decode_parse_masked(benchmark::State &state) {
+    std::string pristine;
+    for (size_t i = 0; i < frames_per_buffer; ++i) {
+        encode_frame(pristine, opcode_t::text, messages[i % messages.size()], 0x5A1B2C3D);
+    }
+    std::string buffer = pristine;
+    BenchmarkListener listener;
+    websocket_feed_t feed(listener);
+    auto now = std::chrono::system_clock::now();
+
+    for (auto _ : state) {
+        std::memcpy(buffer.data(), pristine.data(), pristine.size());
+        size_t consumed = feed.feed(now, std::span(buffer.data(), buffer.size()));
+        benchmark::DoNotOptimize(consumed);
+        benchmark::DoNotOptimize(listener.last_trade);
+    }
+
+    state.SetItemsProcessed(state.iterations() * frames_per_buffer);
+    state.SetBytesProcessed(state.iterations() * buffer.size());
+}
+
+// ============================================================================
+// Unmask: SIMD vs byte loop
+// ============================================================================
+
+static void bm_unmask_simd(benchmark::State &state) {
+    std::string data(static_cast<size_t>(state.range(0)), 'x');
+
+    for (auto _ : state) {
+        unmask(data.data(), data.size(), 0x5A1B2C3D);
+        benchmark::DoNotOptimize(data.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetBytesProcessed(state.iterations() * data.size());
+}
+
+static void bm_unmask_scalar(benchmark::State &state) {
+    std::string data(static_cast<size_t>(state.range(0)), 'x');
+    const uint8_t key[4] = {0x3D, 0x2C, 0x1B, 0x5A};
+
+    for (auto _ : state) {
+        char *ptr = data.data();
+        for (size_t i = 0; i < data.size(); ++i) {
+            ptr[i] = static_cast<char>(static_cast<uint8_t>(ptr[i]) ^ key[i & 3]);
+            benchmark::DoNotOptimize(ptr[i]);
+        }
+        benchmark::ClobberMemory();
+    }
+
+    state.SetBytesProcessed(state.iterations() * data.size());
+}
+
+// ============================================================================
+// Register Benchmarks
+// ============================================================================
+
+BENCHMARK(bm_parse_only);
+BENCHMARK(bm_websocket_decode_parse);
+BENCHMARK(bm_websocket_decode_parse_masked);
+
+BENCHMARK(bm_unmask_simd)->Arg(128)->Arg(64 << 10);
+BENCHMARK(bm_unmask_scalar)->Arg(128)->Arg(64 << 10);
@@ -0,0 +1,66 @@
+/**
+ * @file histogram_benchmark.cpp
+ * @author Kevin Rodrigues
+ * @brief Hot-path cost of the log-linear latency histogram: record, merge and percentile queries
+ * @version 1.0
+ * @date 16/10/2026
+ */
+
+#include <random>
+#include <vector>
+#include <benchmark/benchmark.h>
+
+#include <faster_parser/core/histogram.h>
+
+using namespace core::faster_parser;
+
+namespace {
+    // Latency-like values: mostly a few hundred, a long tail up to ~1 ms
+    std::vector<uint64_t> make_values(size_t count) {
+        std::mt19937_64 rng(3);
+        std::lognormal_distribution<double> latency(5.5, 0.8);
+        std::vector<uint64_t> values(count);
+        for (auto &value : values) value = static_cast<uint64_t>(latency(rng));
+        return values;
+    }
+
+    const std::vector<uint64_t> values = make_values(1 << 16);
+}
+
+static void bm_histogram_record(benchmark::State &state) {
+    latency_histogram_t histogram;
+    for (auto _ : state) {
+        for (uint64_t value : values) histogram.record(value);
+        benchmark::ClobberMemory();
+    }
+    benchmark::DoNotOptimize(histogram.count());
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * values.size()));
+}
+
+static void bm_histogram_merge(benchmark::State &state) {
+    latency_histogram_t source;
+    for (uint64_t value : values) source.record(value);
+    latency_histogram_t total;
+    for (auto _ : state) {
+        total.merge(source);
+        benchmark::ClobberMemory();
+    }
+    benchmark::DoNotOptimize(total.count());
+}
+
+static void bm_histogram_percentile(benchmark::State &state) {
+    latency_histogram_t histogram;
+    for (uint64_t value : values) histogram.record(value);
+    for (auto _ : state) benchmark::DoNotOptimize(histogram.percentile(99.9));
+}
+
+static void bm_histogram_to_json(benchmark::State &state) {
+    latency_histogram_t histogram;
+    for (uint64_t value : values) histogram.record(value);
+    for (auto _ : state) benchmark::DoNotOptimize(histogram.to_json());
+}
+
+BENCHMARK(bm_histogram_record);
+BENCHMARK(bm_histogram_merge);
+BENCHMARK(bm_histogram_percentile);
+BENCHMARK(bm_histogram_to_json);
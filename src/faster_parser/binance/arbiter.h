@@ -0,0 +1,183 @@
+/**
+ * @file arbiter.h
+ * @author Kevin Rodrigues
+ * @brief First-arrival arbitration across redundant feed connections, before full parsing
+ * @version 1.0
+ * @date 16/10/2026
+ */
+
+#ifndef FASTER_PARSER_ARBITER_H
+#define FASTER_PARSER_ARBITER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string_view>
+
+#include "faster_parser/binance/future.h"
+#include "faster_parser/binance/symbol_registry.h"
+
+namespace core::faster_parser::binance {
+    enum class arbitration_t : uint8_t {
+        accepted = 0,       // First copy: parsed and dispatched
+        duplicate = 1,      // Key at or below the high-water mark: skipped without parsing
+        rejected = 2        // Not dispatched by the parser (unhandled type, malformed)
+    };
+
+    // Stream a message belongs to, and its arbitration key
+    enum class arbitration_stream_t : uint8_t {
+        book_ticker = 0,    // u
+        trade = 1,          // a
+        ticker = 2,         // E
+        depth = 3,          // u
+        ticker_array = 4,   // E of the first element, one mark for the whole stream
+        none = 5            // No key found
+    };
+
+    struct arbitration_key_t {
+        arbitration_stream_t stream = arbitration_stream_t::none;
+        std::string_view symbol;
+        uint64_t key = 0;
+    };
+
+    /**
+     * @brief Extract the message type, symbol and sequence key, reading only the fields in front of them
+     * Keys: u for bookTicker and depthUpdate, a for aggTrade, E for 24hrTicker and ticker arrays.
+     * @return stream none if the message is of another type or truncated before its key
+     */
+    __attribute__((always_inline)) inline arbitration_key_t peek_arbitration_key(const char *ptr, const char *end) {
+        arbitration_key_t result;
+        if (end - ptr < 20) [[unlikely]] return result;
+
+        // Digits from `ptr` up to the first non-digit; nullptr if the value runs past `end`
+        auto read_key = [end](const char *value, uint64_t &out) -> const char * {
+            uint64_t key = 0;
+            const char *const start = value;
+            while (value < end && static_cast<unsigned>(*value - '0') < 10) {
+                key = key * 10 + static_cast<uint64_t>(*value - '0');
+                ++value;
+            }
+            if (value == start || value == end) return nullptr;
+            out = key;
+            return value;
+        };
+        auto read_symbol = [end](const char *at, std::string_view &out) -> const char * {
+            at = impl::find_char(at, end, 's');
+            if (!at || end - at < 4) return nullptr;
+            const char *value = at + 4;
+            const char *close = impl::find_char(value, end, '"');
+            if (!close) return nullptr;
+            out = std::string_view(value, static_cast<size_t>(close - value));
+            return close + 1;
+        };
+
+        arbitration_stream_t stream;
+        const char *at;
+        uint64_t key = 0;
+        if (impl::match_string(ptr, R"({"e":"bookTicker)", 16)) {
+            // {"e":"bookTicker","u":8822354685185,"s":"ASTERUSDT",...
+            stream = arbitration_stream_t::book_ticker;
+            if (!(at = impl::find_char(ptr + 16, end, 'u')) || !(at = read_key(at + 3, key)) || !read_symbol(at, result.symbol)) return result;
+        } else if (impl::match_string(ptr, R"({"e":"aggTrade",)", 16)) {
+            // {"e":"aggTrade","E":123456789,"s":"BTCUSDT","a":5933014,...
+            stream = arbitration_stream_t::trade;
+            if (!(at = read_symbol(ptr + 16, result.symbol)) || !(at = impl::find_char(at, end, 'a')) || !read_key(at + 3, key)) return result;
+        } else if (impl::match_string(ptr, R"({"e":"24hrTicker)", 16)) {
+            // {"e":"24hrTicker","E":123456789,"s":"BTCUSDT",...
+            stream = arbitration_stream_t::ticker;
+            if (!(at = impl::find_char(ptr + 16, end, 'E')) || !(at = read_key(at + 3, key)) || !read_symbol(at, result.symbol)) return result;
+        } else if (impl::match_string(ptr, R"([{"e":"24hrTicker)", 16)) {
+            stream = arbitration_stream_t::ticker_array;
+            if (!(at = impl::find_char(ptr + 16, end, 'E')) || !read_key(at + 3, key)) return result;
+        } else if (impl::match_string(ptr, R"({"e":"depthUpdat)", 16)) {
+            // {"e":"depthUpdate","E":1,"T":1,"s":"BTCUSDT","U":157,"u":160,...
+            stream = arbitration_stream_t::depth;
+            if (!(at = read_symbol(ptr + 18, result.symbol)) || !(at = impl::find_char(at, end, 'u')) || !read_key(at + 3, key)) return result;
+        } else {
+            return result;
+        }
+
+        result.stream = stream;
+        result.key = key;
+        return result;
+    }
+
+    /**
+     * @brief Merge two or more identical connections, parsing only the first copy of each message
+     * Every connection's messages go through the same arbiter, which peeks the message type,
+     * symbol and sequence key and compares the key with the symbol's high-water mark for that
+     * stream. Copies at or below the mark are dropped before the parser sees them; a new key
+     * is parsed, dispatched, and raises the mark once the parse succeeds. High-water marks
+     * live in a flat array indexed by interned symbol id, so a message older than one
+     * already delivered is dropped even if the connection that delivered first had missed
+     * it (the sequence checker reports such gaps). Messages without a key (other
+     * types, symbols beyond max_symbols) go straight to the parser.
+     * Single-threaded: read every connection from the same thread (or serialise calls).
+     */
+    class feed_arbiter_t {
+    public:
+        explicit feed_arbiter_t(size_t max_symbols = symbol_registry_t::default_max_symbols)
+            : registry_(max_symbols), marks_(std::make_unique<marks_t[]>(max_symbols)) {}
+
+        feed_arbiter_t(feed_arbiter_t const &) = delete;
+        feed_arbiter_t &operator=(feed_arbiter_t const &) = delete;
+
+        template<BinanceFutureListener listener_t>
+        __attribute__((always_inline)) arbitration_t parse(std::chrono::system_clock::time_point const &now, std::string_view raw, listener_t &listener) {
+            const arbitration_key_t key = peek_arbitration_key(raw.data(), raw.data() + raw.size());
+            uint64_t *mark = high_water_mark(key);
+            if (mark && key.key <= *mark) {
+                ++duplicates_;
+                return arbitration_t::duplicate;
+            }
+
+            if (!binance_future_parser_t::parse(now, raw, listener)) [[unlikely]] {
+                ++rejected_;
+                return arbitration_t::rejected;
+            }
+            if (mark) {
+                *mark = key.key;
+            } else {
+                ++unkeyed_;
+            }
+            ++accepted_;
+            return arbitration_t::accepted;
+        }
+
+        // High-water mark of a symbol's stream (0 if none); ticker arrays ignore the symbol
+        [[nodiscard]] uint64_t mark(std::string_view symbol, arbitration_stream_t stream) const {
+            if (stream == arbitration_stream_t::ticker_array) return ticker_array_mark_;
+            const symbol_id_t id = registry_.find(symbol);
+            if (id == invalid_symbol_id || stream == arbitration_stream_t::none) return 0;
+            return marks_[id].keys[static_cast<size_t>(stream)];
+        }
+
+        [[nodiscard]] uint64_t accepted() const { return accepted_; }
+        [[nodiscard]] uint64_t duplicates() const { return duplicates_; }
+        [[nodiscard]] uint64_t rejected() const { return rejected_; }
+        [[nodiscard]] uint64_t unkeyed() const { return unkeyed_; }                 // Accepted without a key check
+
+    private:
+        struct alignas(32) marks_t {
+            uint64_t keys[4] = {};                      // Indexed by arbitration_stream_t
+        };
+
+        __attribute__((always_inline)) uint64_t *high_water_mark(arbitration_key_t const &key) {
+            if (key.stream == arbitration_stream_t::none) [[unlikely]] return nullptr;
+            if (key.stream == arbitration_stream_t::ticker_array) return &ticker_array_mark_;
+            const symbol_id_t id = registry_.intern(key.symbol);
+            if (id == invalid_symbol_id) [[unlikely]] return nullptr;
+            return &marks_[id].keys[static_cast<size_t>(key.stream)];
+        }
+
+        symbol_registry_t registry_;
+        std::unique_ptr<marks_t[]> marks_;
+        uint64_t ticker_array_mark_ = 0;
+        uint64_t accepted_ = 0;
+        uint64_t duplicates_ = 0;
+        uint64_t rejected_ = 0;
+        uint64_t unkeyed_ = 0;
+    };
+} // namespace core::faster_parser::binance
+
+#endif //FASTER_PARSER_ARBITER_H
@@ -76,6 +76,48 @@ namespace core::faster_parser::binance::avx2 {
         return nullptr;
     }
 
+    // find_char() that gives up at the end of the line: nullptr if a '\n' comes first, so a
+    // truncated record of a newline-delimited stream cannot run into the next record
+    __attribute__((always_inline)) inline const char *find_char_in_line(const char *ptr, const char *end, char target) {
+        __m256i target_vec = _mm256_set1_epi8(target);
+        __m256i newline_vec = _mm256_set1_epi8('\n');
+
+        while (ptr + 32 <= end) {
+            __m256i data = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr));
+            __m256i cmp = _mm256_or_si256(_mm256_cmpeq_epi8(data, target_vec), _mm256_cmpeq_epi8(data, newline_vec));
+
+            int mask = _mm256_movemask_epi8(cmp);
+
+            if (mask != 0) {
+                ptr += __builtin_ctz(mask);
+                return *ptr == target ? ptr : nullptr;
+            }
+
+            ptr += 32;
+        }
+
+        if (ptr + 16 <= end) {
+            __m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr));
+            __m128i cmp = _mm_or_si128(_mm_cmpeq_epi8(data, _mm_set1_epi8(target)), _mm_cmpeq_epi8(data, _mm_set1_epi8('\n')));
+
+            int mask = _mm_movemask_epi8(cmp);
+
+            if (mask != 0) {
+                ptr += __builtin_ctz(mask);
+                return *ptr == target ? ptr : nullptr;
+            }
+
+            ptr += 16;
+        }
+
+        while (ptr < end) {
+            if (*ptr == target) return ptr;
+            if (*ptr == '\n') return nullptr;
+            ptr++;
+        }
+        return nullptr;
+    }
+
     // Find first occurrence of any character in a set (up to 4 characters)
     // Returns pointer to the found character and sets which_char to indicate which one was found (0-3)
     __attribute__((always_inline)) inline const char *find_char_set(const char *ptr, const char *end, const char *targets, size_t num_targets, int &which_char) {
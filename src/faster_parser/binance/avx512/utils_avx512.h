@@ -89,6 +89,56 @@ namespace core::faster_parser::binance::avx512 {
         return nullptr;
     }
 
+    // find_char() that gives up at the end of the line: nullptr if a '\n' comes first, so a
+    // truncated record of a newline-delimited stream cannot run into the next record
+    __attribute__((always_inline)) inline const char *find_char_in_line(const char *ptr, const char *end, char target) {
+        __m512i target_vec = _mm512_set1_epi8(target);
+        __m512i newline_vec = _mm512_set1_epi8('\n');
+
+        while (ptr + 64 <= end) {
+            __m512i data = _mm512_loadu_si512(reinterpret_cast<const __m512i*>(ptr));
+            __mmask64 cmp_mask = _mm512_cmpeq_epi8_mask(data, target_vec) | _mm512_cmpeq_epi8_mask(data, newline_vec);
+
+            if (cmp_mask != 0) {
+                ptr += __builtin_ctzll(cmp_mask);
+                return *ptr == target ? ptr : nullptr;
+            }
+
+            ptr += 64;
+        }
+
+        if (ptr + 32 <= end) {
+            __m256i data = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr));
+            __mmask32 cmp_mask = _mm256_cmpeq_epi8_mask(data, _mm256_set1_epi8(target)) | _mm256_cmpeq_epi8_mask(data, _mm256_set1_epi8('\n'));
+
+            if (cmp_mask != 0) {
+                ptr += __builtin_ctz(cmp_mask);
+                return *ptr == target ? ptr : nullptr;
+            }
+
+            ptr += 32;
+        }
+
+        if (ptr + 16 <= end) {
+            __m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr));
+            __mmask16 cmp_mask = _mm_cmpeq_epi8_mask(data, _mm_set1_epi8(target)) | _mm_cmpeq_epi8_mask(data, _mm_set1_epi8('\n'));
+
+            if (cmp_mask != 0) {
+                ptr += __builtin_ctz(cmp_mask);
+                return *ptr == target ? ptr : nullptr;
+            }
+
+            ptr += 16;
+        }
+
+        while (ptr < end) {
+            if (*ptr == target) return ptr;
+            if (*ptr == '\n') return nullptr;
+            ptr++;
+        }
+        return nullptr;
+    }
+
     // Find first occurrence of any character in a set (up to 4 characters)
     // Returns pointer to the found character and sets which_char to indicate which one was found (0-3)
     __attribute__((always_inline)) inline const char *find_char_set(const char *ptr, const char *end, const char *targets, size_t num_targets, int &which_char) {
@@ -12,32 +12,72 @@
 #include <concepts>
 
 #include "faster_parser/binance/types/book_ticker.h"
+#include "faster_parser/binance/types/depth.h"
+#include "faster_parser/binance/types/sequence.h"
 #include "faster_parser/binance/types/ticker.h"
 #include "faster_parser/binance/types/trade.h"
 
 namespace core::faster_parser::binance {
+    /**
+     * @brief Listener provides on_book_ticker for book ticker updates
+     */
+    template<typename T>
+    concept BookTickerListener = requires(T &listener, const types::book_ticker_t &book_ticker) {
+        { listener.on_book_ticker(book_ticker) } -> std::same_as<void>;
+    };
+
+    /**
+     * @brief Listener provides on_trade for aggregate trade data
+     */
+    template<typename T>
+    concept TradeListener = requires(T &listener, const types::trade_t &trade) {
+        { listener.on_trade(trade) } -> std::same_as<void>;
+    };
+
+    /**
+     * @brief Listener provides on_ticker for 24hr ticker statistics
+     */
+    template<typename T>
+    concept TickerListener = requires(T &listener, const types::ticker_t &ticker) {
+        { listener.on_ticker(ticker) } -> std::same_as<void>;
+    };
+
+    /**
+     * @brief Listener provides on_depth_update for diff depth updates
+     */
+    template<typename T>
+    concept DepthListener = requires(T &listener, const types::depth_update_t &update) {
+        { listener.on_depth_update(update) } -> std::same_as<void>;
+    };
+
+    /**
+     * @brief Listener provides on_sequence_event for gaps, duplicates and regressions
+     * Not a market data callback: reported by listeners::sequence_checker_t.
+     */
+    template<typename T>
+    concept SequenceListener = requires(T &listener, const types::sequence_event_t &event) {
+        { listener.on_sequence_event(event) } -> std::same_as<void>;
+    };
+
     /**
      * @brief Concept defining the requirements for a Binance Futures market data listener
      * @tparam T The type to be checked against the concept
      *
-     * A type satisfies BinanceFutureListener if it provides callback methods for various
-     * market data types. Currently supports:
+     * A type satisfies BinanceFutureListener if it provides at least one of the callback
+     * methods for the supported market data types:
      * - on_book_ticker: for book ticker updates
      * - on_trade: for aggregate trade data
      * - on_ticker: for 24hr ticker statistics
+     * - on_depth_update: for diff depth updates
+     *
+     * Every callback is optional. The parser only compiles in the message type checks and
+     * parsing routines for the callbacks the listener implements; other message types are
+     * rejected without being parsed.
      *
-     * Additional callback methods can be added in the future (e.g., on_depth, on_mark_price).
+     * Additional callback methods can be added in the future (e.g., on_mark_price).
      */
     template<typename T>
-    concept BinanceFutureListener = requires(T &listener,
-                                             const types::book_ticker_t &book_ticker,
-                                             const types::ticker_t &ticker,
-                                             const types::trade_t &trade)
-    {
-        { listener.on_book_ticker(book_ticker) } -> std::same_as<void>;
-        { listener.on_ticker(ticker) } -> std::same_as<void>;
-        { listener.on_trade(trade) } -> std::same_as<void>;
-    };
+    concept BinanceFutureListener = BookTickerListener<T> || TradeListener<T> || TickerListener<T> || DepthListener<T>;
 } // namespace core::faster_parser::binance
 
 #endif //FASTER_PARSER_CONCEPTS_H
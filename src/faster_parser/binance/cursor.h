@@ -0,0 +1,175 @@
+/**
+ * @file cursor.h
+ * @author Kevin Rodrigues
+ * @brief Pull-style cursor yielding parsed Binance events from a buffer of framed messages
+ * @version 1.0
+ * @date 16/10/2026
+ */
+
+#ifndef FASTER_PARSER_CURSOR_H
+#define FASTER_PARSER_CURSOR_H
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <string_view>
+#include <variant>
+#include <vector>
+
+#include "faster_parser/binance/future.h"
+
+namespace core::faster_parser::binance {
+    // One parsed event. Symbols reference the cursor buffer, which must outlive the event.
+    using event_t = std::variant<types::book_ticker_t, types::trade_t, types::ticker_t>;
+
+    enum class framing_t : uint8_t {
+        newline,        // One JSON message per line ('\n', optional '\r')
+        length_prefixed // 4-byte little-endian length followed by the message
+    };
+
+    /**
+     * @brief Pull API over a contiguous buffer of framed messages
+     * Each call to next() parses one frame with binance_future_parser_t and hands back the
+     * event; a ticker array yields one event per element. The frame following the current
+     * one is prefetched before parsing. Frames that do not parse are skipped and counted.
+     */
+    class message_cursor_t {
+    public:
+        message_cursor_t(std::string_view buffer, framing_t framing = framing_t::newline,
+                         std::chrono::system_clock::time_point now = std::chrono::system_clock::now())
+            : ptr_(buffer.data()), end_(buffer.data() + buffer.size()), now_(now), framing_(framing) {}
+
+        // Fetch the next event. Returns false once the buffer is exhausted.
+        __attribute__((always_inline)) bool next(event_t &event) {
+            if (pending_index_ < pending_.size()) [[unlikely]] {
+                event = pending_[pending_index_++];
+                return true;
+            }
+
+            std::string_view frame;
+            while (next_frame(frame)) {
+                capture_listener_t capture{&event, &pending_, false};
+                pending_.clear();
+                pending_index_ = 0;
+                if (binance_future_parser_t::parse(now_, frame, capture) && capture.captured) [[likely]] {
+                    return true;
+                }
+                ++skipped_;
+            }
+            return false;
+        }
+
+        // Set the reception time stamped on subsequent events
+        void set_time(std::chrono::system_clock::time_point now) { now_ = now; }
+
+        // Number of frames that failed to parse or carried no event
+        [[nodiscard]] size_t skipped() const { return skipped_; }
+
+        [[nodiscard]] bool done() const { return ptr_ >= end_ && pending_index_ >= pending_.size(); }
+
+        class iterator {
+        public:
+            using iterator_category = std::input_iterator_tag;
+            using value_type = event_t;
+            using difference_type = std::ptrdiff_t;
+
+            iterator() = default;
+            explicit iterator(message_cursor_t *cursor) : cursor_(cursor) { ++*this; }
+
+            const event_t &operator*() const { return event_; }
+            const event_t *operator->() const { return &event_; }
+
+            iterator &operator++() {
+                if (!cursor_->next(event_)) cursor_ = nullptr;
+                return *this;
+            }
+
+            void operator++(int) { ++*this; }
+
+            bool operator==(std::default_sentinel_t) const { return cursor_ == nullptr; }
+
+        private:
+            message_cursor_t *cursor_ = nullptr;
+            event_t event_;
+        };
+
+        iterator begin() { return iterator(this); }
+        std::default_sentinel_t end() { return {}; }
+
+    private:
+        struct capture_listener_t {
+            event_t *event;
+            std::vector<types::ticker_t> *overflow;
+            bool captured;
+
+            __attribute__((always_inline)) void on_book_ticker(const types::book_ticker_t &ticker) {
+                event->emplace<types::book_ticker_t>(ticker);
+                captured = true;
+            }
+
+            __attribute__((always_inline)) void on_trade(const types::trade_t &trade) {
+                event->emplace<types::trade_t>(trade);
+                captured = true;
+            }
+
+            __attribute__((always_inline)) void on_ticker(const types::ticker_t &ticker) {
+                if (captured) {
+                    overflow->push_back(ticker);
+                    return;
+                }
+                event->emplace<types::ticker_t>(ticker);
+                captured = true;
+            }
+        };
+
+        __attribute__((always_inline)) bool next_frame(std::string_view &frame) {
+            while (ptr_ < end_) {
+                const char *start = ptr_;
+                const char *stop;
+
+                if (framing_ == framing_t::newline) {
+                    stop = impl::find_char(start, end_, '\n');
+                    if (!stop) stop = end_;
+                    ptr_ = stop + (stop < end_);
+                    if (stop > start && stop[-1] == '\r') --stop;
+                } else {
+                    if (end_ - start < 4) [[unlikely]] {
+                        ptr_ = end_;
+                        return false;
+                    }
+                    uint32_t length;
+                    std::memcpy(&length, start, sizeof(length));
+                    start += 4;
+                    if (static_cast<size_t>(end_ - start) < length) [[unlikely]] {
+                        ptr_ = end_;
+                        return false;
+                    }
+                    stop = start + length;
+                    ptr_ = stop;
+                }
+
+                __builtin_prefetch(ptr_, 0, 3);
+                __builtin_prefetch(ptr_ + 64, 0, 3);
+                __builtin_prefetch(ptr_ + 128, 0, 3);
+
+                if (stop > start) [[likely]] {
+                    frame = std::string_view(start, stop - start);
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        const char *ptr_;
+        const char *end_;
+        std::chrono::system_clock::time_point now_;
+        framing_t framing_;
+        size_t skipped_ = 0;
+        std::vector<types::ticker_t> pending_;
+        size_t pending_index_ = 0;
+    };
+} // namespace core::faster_parser::binance
+
+#endif //FASTER_PARSER_CURSOR_H
@@ -10,9 +10,11 @@
 #define FASTER_PARSER_FUTURE_H
 
 #include <chrono>
+#include <cstddef>
 #include <string_view>
 
 #include "faster_parser/binance/concepts.h"
+#include "faster_parser/binance/trace.h"
 #include "faster_parser/core/fast_scalar_parser.h"
 
 #if defined(__AVX512F__)
@@ -30,206 +32,329 @@ namespace impl = core::faster_parser::binance::scalar;
 #endif
 
 namespace core::faster_parser::binance {
+    // Instruction set of the message scanning routines selected at compile time
+    inline constexpr std::string_view parser_isa =
+#if defined(__AVX512F__)
+        "avx512";
+#elif defined(__AVX2__)
+        "avx2";
+#elif defined(__aarch64__) || defined(__ARM_NEON)
+        "neon";
+#else
+        "scalar";
+#endif
+
     class binance_future_parser_t {
     public:
         template<BinanceFutureListener listener_t>
         static __attribute__((always_inline)) bool parse(std::chrono::system_clock::time_point const &now, std::string_view raw, listener_t &listener) {
+            return dispatch(now, raw, listener, [](trace_type_t) {});
+        }
+
+        /**
+         * @brief parse() with per-stage latency tracing (see trace.h)
+         * With a null_tracer_t (default_tracer_t unless built with FASTER_PARSER_TRACING) this is
+         * parse(now, raw, listener) and the tracer costs nothing. With a parse_tracer_t the
+         * timestamp counter is read at ingress, after type dispatch, before the listener call and
+         * after it returns, and the stage durations of delivered messages are recorded.
+         */
+        template<BinanceFutureListener listener_t, ParseTracer tracer_t>
+        static __attribute__((always_inline)) bool parse(std::chrono::system_clock::time_point const &now, std::string_view raw, listener_t &listener, tracer_t &tracer) {
+            if constexpr (!tracer_t::enabled) {
+                return parse(now, raw, listener);
+            } else {
+                traced_listener_t<listener_t> traced{listener};
+                traced.stamps.ingress = read_tsc();
+                trace_type_t type = trace_type_t::book_ticker;
+                bool recognised = false;
+                const bool delivered = dispatch(now, raw, traced, [&](trace_type_t dispatched) {
+                    traced.stamps.dispatched = read_tsc();
+                    type = dispatched;
+                    recognised = true;
+                });
+                if (delivered) [[likely]] {
+                    tracer.record(type, traced.stamps);
+                } else if (recognised) {
+                    tracer.record_failure();
+                }
+                return delivered;
+            }
+        }
+
+        // Message type dispatch of parse(); on_dispatch(trace_type_t) is called once the type is recognised
+        template<BinanceFutureListener listener_t, typename on_dispatch_t>
+        static __attribute__((always_inline)) bool dispatch(std::chrono::system_clock::time_point const &now, std::string_view raw, listener_t &listener,
+                                                            on_dispatch_t &&on_dispatch) {
             if (raw.size() < 20) {
                 return false;
             }
 
             // Check message type
             // Only check 16 char to fit the simd
-            if (impl::match_string(raw.data(), R"({"e":"bookTicker)", 16)) {
-                return process_book_ticker(now, raw, listener);
-            } else if (impl::match_string(raw.data(), R"({"e":"aggTrade",)", 16)) {
-                return process_agg_trade(now, raw, listener);
-            } else if (impl::match_string(raw.data(), R"({"e":"24hrTicker)", 16)) {
-                return process_ticker(now, raw, listener);
-            } else if (impl::match_string(raw.data(), R"([{"e":"24hrTicker)", 16)) {
-                return process_ticker_array(now, raw, listener);
+            // Types without a matching callback on the listener are compiled out, so a message
+            // the listener ignores is rejected after the prefix checks of the types it handles
+            if constexpr (BookTickerListener<listener_t>) {
+                if (impl::match_string(raw.data(), R"({"e":"bookTicker)", 16)) {
+                    on_dispatch(trace_type_t::book_ticker);
+                    return process_book_ticker(now, raw, listener);
+                }
+            }
+            if constexpr (TradeListener<listener_t>) {
+                if (impl::match_string(raw.data(), R"({"e":"aggTrade",)", 16)) {
+                    on_dispatch(trace_type_t::trade);
+                    return process_agg_trade(now, raw, listener);
+                }
+            }
+            if constexpr (TickerListener<listener_t>) {
+                if (impl::match_string(raw.data(), R"({"e":"24hrTicker)", 16)) {
+                    on_dispatch(trace_type_t::ticker);
+                    return process_ticker(now, raw, listener);
+                } else if (impl::match_string(raw.data(), R"([{"e":"24hrTicker)", 16)) {
+                    on_dispatch(trace_type_t::ticker_array);
+                    return process_ticker_array(now, raw, listener);
+                }
+            }
+            if constexpr (DepthListener<listener_t>) {
+                if (impl::match_string(raw.data(), R"({"e":"depthUpdat)", 16)) {
+                    on_dispatch(trace_type_t::depth);
+                    return process_depth_update(now, raw.data(), raw.data() + raw.size(), listener) != nullptr;
+                }
             }
 
             return false;
         }
 
+        /**
+         * @brief Parse every message of a buffer of concatenated records (NDJSON capture, socket reads)
+         * Message boundaries are found by the parse itself: each message ends where its last field
+         * ends, so well-formed records are scanned once. The field scans stop at a newline
+         * (find_char_in_line), so a truncated record fails within its own line instead of being
+         * completed with the fields of the next one. Records the listener has no callback for,
+         * or that fail to parse, are skipped up to the next newline.
+         * @return Number of bytes consumed. Less than buffer.size() when the buffer ends with an
+         * incomplete message, which starts at the returned offset and should be fed again once the
+         * rest of it has arrived.
+         */
         template<BinanceFutureListener listener_t>
+        static size_t parse_stream(std::chrono::system_clock::time_point const &now, std::string_view buffer, listener_t &listener) {
+            const char *const begin = buffer.data();
+            const char *const end = begin + buffer.size();
+            const char *ptr = begin;
+
+            while (true) {
+                // Skip record separators
+                while (ptr < end && (*ptr == '\n' || *ptr == '\r' || *ptr == ' ' || *ptr == '\t')) {
+                    ptr++;
+                }
+                if (ptr >= end) {
+                    return buffer.size();
+                }
+
+                const char *next = nullptr;
+                bool handled = false;
+                if (end - ptr >= 20) [[likely]] {
+                    next = parse_next(now, ptr, end, listener, handled);
+                }
+                if (next) [[likely]] {
+                    ptr = next;
+                    continue;
+                }
+
+                // Ignored or malformed record: drop its line. Without a newline, a record of a handled
+                // type failed by reaching the end and is kept for the next call, as is anything that
+                // may still be incomplete; a record of a type the listener ignores that ends with its
+                // closing brace is dropped, rather than carried by the caller forever
+                const char *newline = impl::find_char(ptr, end, '\n');
+                if (!newline) {
+                    const bool complete = (*ptr == '{' && end[-1] == '}') || (*ptr == '[' && end[-1] == ']');
+                    return !handled && end - ptr >= 20 && complete ? buffer.size() : static_cast<size_t>(ptr - begin);
+                }
+                ptr = newline + 1;
+            }
+        }
+
+        template<BookTickerListener listener_t>
         static __attribute__((always_inline)) bool process_book_ticker(std::chrono::system_clock::time_point const &now, std::string_view raw, listener_t &listener) {
+            return process_book_ticker(now, raw.data(), raw.data() + raw.size(), listener) != nullptr;
+        }
+
+        template<BookTickerListener listener_t>
+        static __attribute__((always_inline)) const char *process_book_ticker(std::chrono::system_clock::time_point const &now, const char *ptr, const char *end, listener_t &listener) {
             // Message example: {"e":"bookTicker","u":8822354685185,"s":"ASTERUSDT","b":"1.5822000","B":"457","a":"1.5823000","A":"112","T":1760083106579,"E":1760083106579}
             types::book_ticker_t ticker;
             ticker.time = now;
 
-            const char *ptr = raw.data();
-            const char *end = raw.data() + raw.size();
-
-            ptr = impl::find_char(ptr, end, 'u');
-            if (!ptr) return false;
+            ptr = impl::find_char_in_line(ptr, end, 'u');
+            if (!ptr) return nullptr;
             ptr += 3;
 
             const char *value_start = ptr;
-            ptr = impl::find_char(ptr, end, ',');
-            if (!ptr) return false;
+            ptr = impl::find_char_in_line(ptr, end, ',');
+            if (!ptr) return nullptr;
             uint64_t update_id = fast_scalar_parser::parse_uint64(std::string_view(value_start, ptr));
 
-            ptr = impl::find_char(ptr, end, 's');
-            if (!ptr) return false;
+            ptr = impl::find_char_in_line(ptr, end, 's');
+            if (!ptr) return nullptr;
             ptr += 4;
 
             value_start = ptr;
-            ptr = impl::find_char(ptr, end, '"');
-            if (!ptr) return false;
+            ptr = impl::find_char_in_line(ptr, end, '"');
+            if (!ptr) return nullptr;
             ticker.symbol = std::string_view(value_start, ptr - value_start);
             ptr++;
 
-            ptr = impl::find_char(ptr, end, 'b');
-            if (!ptr) return false;
+            ptr = impl::find_char_in_line(ptr, end, 'b');
+            if (!ptr) return nullptr;
             ptr += 4;
 
             value_start = ptr;
-            ptr = impl::find_char(ptr, end, '"');
-            if (!ptr) return false;
+            ptr = impl::find_char_in_line(ptr, end, '"');
+            if (!ptr) return nullptr;
             ticker.bid.price = fast_scalar_parser::parse_float(std::string_view(value_start, ptr));
             ptr++;
 
-            ptr = impl::find_char(ptr, end, 'B');
-            if (!ptr) return false;
+            ptr = impl::find_char_in_line(ptr, end, 'B');
+            if (!ptr) return nullptr;
             ptr += 4;
 
             value_start = ptr;
-            ptr = impl::find_char(ptr, end, '"');
-            if (!ptr) return false;
+            ptr = impl::find_char_in_line(ptr, end, '"');
+            if (!ptr) return nullptr;
             ticker.bid.volume = fast_scalar_parser::parse_float(std::string_view(value_start, ptr));
             ptr++;
 
-            ptr = impl::find_char(ptr, end, 'a');
-            if (!ptr) return false;
+            ptr = impl::find_char_in_line(ptr, end, 'a');
+            if (!ptr) return nullptr;
             ptr += 4;
 
             value_start = ptr;
-            ptr = impl::find_char(ptr, end, '"');
-            if (!ptr) return false;
+            ptr = impl::find_char_in_line(ptr, end, '"');
+            if (!ptr) return nullptr;
             ticker.ask.price = fast_scalar_parser::parse_float(std::string_view(value_start, ptr));
             ptr++;
 
-            ptr = impl::find_char(ptr, end, 'A');
-            if (!ptr) return false;
+            ptr = impl::find_char_in_line(ptr, end, 'A');
+            if (!ptr) return nullptr;
             ptr += 4;
 
             value_start = ptr;
-            ptr = impl::find_char(ptr, end, '"');
-            if (!ptr) return false;
+            ptr = impl::find_char_in_line(ptr, end, '"');
+            if (!ptr) return nullptr;
             ticker.ask.volume = fast_scalar_parser::parse_float(std::string_view(value_start, ptr));
             ptr++;
 
-            ptr = impl::find_char(ptr, end, 'T');
-            if (!ptr) return false;
-            ptr = impl::find_char(ptr, end, ',');
-            if (!ptr) return false;
+            ptr = impl::find_char_in_line(ptr, end, 'T');
+            if (!ptr) return nullptr;
+            ptr = impl::find_char_in_line(ptr, end, ',');
+            if (!ptr) return nullptr;
             ptr++;
 
-            ptr = impl::find_char(ptr, end, 'E');
-            if (!ptr) return false;
+            ptr = impl::find_char_in_line(ptr, end, 'E');
+            if (!ptr) return nullptr;
             ptr += 3;
 
             value_start = ptr;
-            ptr = impl::find_char(ptr, end, '}');
-            if (!ptr) return false;
+            ptr = impl::find_char_in_line(ptr, end, '}');
+            if (!ptr) return nullptr;
             ticker.exchange_timestamp = fast_scalar_parser::parse_uint64(std::string_view(value_start, ptr));
 
             ticker.bid.sequence = update_id;
             ticker.ask.sequence = update_id;
 
             listener.on_book_ticker(ticker);
-            return true;
+            return ptr + 1;
         }
 
-        template<BinanceFutureListener listener_t>
+        template<TradeListener listener_t>
         static __attribute__((always_inline)) bool process_agg_trade(std::chrono::system_clock::time_point const &now, std::string_view raw, listener_t &listener) {
+            return process_agg_trade(now, raw.data(), raw.data() + raw.size(), listener) != nullptr;
+        }
+
+        template<TradeListener listener_t>
+        static __attribute__((always_inline)) const char *process_agg_trade(std::chrono::system_clock::time_point const &now, const char *ptr, const char *end, listener_t &listener) {
             // Message example: {"e":"aggTrade","E":123456789,"s":"BTCUSDT","a":5933014,"p":"0.001","q":"100","f":100,"l":105,"T":123456785,"m":true}
             types::trade_t trade;
             trade.time = now;
 
-            const char *ptr = raw.data();
-            const char *end = raw.data() + raw.size();
-
-            ptr = impl::find_char(ptr, end, 'E');
-            if (!ptr) return false;
+            ptr = impl::find_char_in_line(ptr, end, 'E');
+            if (!ptr) return nullptr;
             ptr += 3;
 
             const char *value_start = ptr;
-            ptr = impl::find_char(ptr, end, ',');
-            if (!ptr) return false;
+            ptr = impl::find_char_in_line(ptr, end, ',');
+            if (!ptr) return nullptr;
             trade.event_time = fast_scalar_parser::parse_uint64(std::string_view(value_start, ptr - value_start));
 
-            ptr = impl::find_char(ptr, end, 's');
-            if (!ptr) return false;
+            ptr = impl::find_char_in_line(ptr, end, 's');
+            if (!ptr) return nullptr;
             ptr += 4;
 
             value_start = ptr;
-            ptr = impl::find_char(ptr, end, '"');
-            if (!ptr) return false;
+            ptr = impl::find_char_in_line(ptr, end, '"');
+            if (!ptr) return nullptr;
             trade.symbol = std::string_view(value_start, ptr - value_start);
             ptr++;
 
-            ptr = impl::find_char(ptr, end, 'a');
-            if (!ptr) return false;
+            ptr = impl::find_char_in_line(ptr, end, 'a');
+            if (!ptr) return nullptr;
             ptr += 3;
 
             value_start = ptr;
-            ptr = impl::find_char(ptr, end, ',');
-            if (!ptr) return false;
+            ptr = impl::find_char_in_line(ptr, end, ',');
+            if (!ptr) return nullptr;
             trade.agg_trade_id = fast_scalar_parser::parse_uint64(std::string_view(value_start, ptr - value_start));
 
-            ptr = impl::find_char(ptr, end, 'p');
-            if (!ptr) return false;
+            ptr = impl::find_char_in_line(ptr, end, 'p');
+            if (!ptr) return nullptr;
             ptr += 4;
 
             value_start = ptr;
-            ptr = impl::find_char(ptr, end, '"');
-            if (!ptr) return false;
+            ptr = impl::find_char_in_line(ptr, end, '"');
+            if (!ptr) return nullptr;
             trade.price = fast_scalar_parser::parse_float(std::string_view(value_start, ptr - value_start));
             ptr++;
 
-            ptr = impl::find_char(ptr, end, 'q');
-            if (!ptr) return false;
+            ptr = impl::find_char_in_line(ptr, end, 'q');
+            if (!ptr) return nullptr;
             ptr += 4;
 
             value_start = ptr;
-            ptr = impl::find_char(ptr, end, '"');
-            if (!ptr) return false;
+            ptr = impl::find_char_in_line(ptr, end, '"');
+            if (!ptr) return nullptr;
             trade.quantity = fast_scalar_parser::parse_float(std::string_view(value_start, ptr - value_start));
             ptr++;
 
-            ptr = impl::find_char(ptr, end, 'f');
-            if (!ptr) return false;
+            ptr = impl::find_char_in_line(ptr, end, 'f');
+            if (!ptr) return nullptr;
             ptr += 3;
 
             value_start = ptr;
-            ptr = impl::find_char(ptr, end, ',');
-            if (!ptr) return false;
+            ptr = impl::find_char_in_line(ptr, end, ',');
+            if (!ptr) return nullptr;
             trade.first_trade_id = fast_scalar_parser::parse_uint64(std::string_view(value_start, ptr - value_start));
 
-            ptr = impl::find_char(ptr, end, 'l');
-            if (!ptr) return false;
+            ptr = impl::find_char_in_line(ptr, end, 'l');
+            if (!ptr) return nullptr;
             ptr += 3;
 
             value_start = ptr;
-            ptr = impl::find_char(ptr, end, ',');
-            if (!ptr) return false;
+            ptr = impl::find_char_in_line(ptr, end, ',');
+            if (!ptr) return nullptr;
             trade.last_trade_id = fast_scalar_parser::parse_uint64(std::string_view(value_start, ptr - value_start));
 
-            ptr = impl::find_char(ptr, end, 'T');
-            if (!ptr) return false;
+            ptr = impl::find_char_in_line(ptr, end, 'T');
+            if (!ptr) return nullptr;
             ptr += 3;
 
             value_start = ptr;
-            ptr = impl::find_char(ptr, end, ',');
-            if (!ptr) return false;
+            ptr = impl::find_char_in_line(ptr, end, ',');
+            if (!ptr) return nullptr;
             trade.trade_time = fast_scalar_parser::parse_uint64(std::string_view(value_start, ptr - value_start));
 
-            ptr = impl::find_char(ptr, end, 'm');
-            if (!ptr) return false;
+            ptr = impl::find_char_in_line(ptr, end, 'm');
+            if (!ptr) return nullptr;
             ptr += 3;
+            if (ptr >= end) return nullptr;
 
             trade.is_buyer_maker = (*ptr == 't');
             // if (ptr + 4 <= end && std::string_view(ptr, 4) == "true") {
@@ -237,204 +362,386 @@ namespace core::faster_parser::binance {
             // } else if (ptr + 5 <= end && std::string_view(ptr, 5) == "false") {
                 // trade.is_buyer_maker = false;
             // } else {
-                // return false;
+                // return nullptr;
             // }
 
+            ptr = impl::find_char_in_line(ptr, end, '}');
+            if (!ptr) return nullptr;
+
             listener.on_trade(trade);
-            return true;
+            return ptr + 1;
+        }
+
+        template<BinanceFutureListener listener_t>
+        static __attribute__((always_inline)) const char *parse_next(std::chrono::system_clock::time_point const &now, const char *ptr, const char *end, listener_t &listener,
+                                                                     bool &handled) {
+            // Same dispatch as parse(), returns pointer after the message or nullptr; `handled` is
+            // set when the record is of a type the listener has a callback for
+            handled = true;
+            if constexpr (BookTickerListener<listener_t>) {
+                if (impl::match_string(ptr, R"({"e":"bookTicker)", 16)) {
+                    return process_book_ticker(now, ptr, end, listener);
+                }
+            }
+            if constexpr (TradeListener<listener_t>) {
+                if (impl::match_string(ptr, R"({"e":"aggTrade",)", 16)) {
+                    return process_agg_trade(now, ptr, end, listener);
+                }
+            }
+            if constexpr (TickerListener<listener_t>) {
+                if (impl::match_string(ptr, R"({"e":"24hrTicker)", 16)) {
+                    return process_ticker(now, ptr, end, listener);
+                } else if (impl::match_string(ptr, R"([{"e":"24hrTicker)", 16)) {
+                    // Tickers are dispatched as the array is walked, so only start once it is complete
+                    const char *array_end = impl::find_char_in_line(ptr, end, ']');
+                    if (!array_end) return nullptr;
+                    return process_ticker_array(now, ptr, array_end + 1, listener);
+                }
+            }
+            if constexpr (DepthListener<listener_t>) {
+                if (impl::match_string(ptr, R"({"e":"depthUpdat)", 16)) {
+                    return process_depth_update(now, ptr, end, listener);
+                }
+            }
+
+            handled = false;
+            return nullptr;
+        }
+
+        template<DepthListener listener_t>
+        static __attribute__((always_inline)) const char *process_depth_update(std::chrono::system_clock::time_point const &now, const char *ptr, const char *end, listener_t &listener) {
+            // Message example: {"e":"depthUpdate","E":123456789,"T":123456788,"s":"BTCUSDT","U":157,"u":160,"pu":149,"b":[["0.0024","10"]],"a":[["0.0026","100"]]}
+            // Levels are not parsed here: depth_levels_t converts them while the listener walks them
+            types::depth_update_t update;
+            update.time = now;
+            ptr += 18; // Past {"e":"depthUpdate"
+
+            ptr = impl::find_char_in_line(ptr, end, 'E');
+            if (!ptr) return nullptr;
+            ptr += 3;
+
+            const char *value_start = ptr;
+            ptr = impl::find_char_in_line(ptr, end, ',');
+            if (!ptr) return nullptr;
+            update.event_time = fast_scalar_parser::parse_uint64(std::string_view(value_start, ptr - value_start));
+
+            ptr = impl::find_char_in_line(ptr, end, 'T');
+            if (!ptr) return nullptr;
+            ptr += 3;
+
+            value_start = ptr;
+            ptr = impl::find_char_in_line(ptr, end, ',');
+            if (!ptr) return nullptr;
+            update.transaction_time = fast_scalar_parser::parse_uint64(std::string_view(value_start, ptr - value_start));
+
+            ptr = impl::find_char_in_line(ptr, end, 's');
+            if (!ptr) return nullptr;
+            ptr += 4;
+
+            value_start = ptr;
+            ptr = impl::find_char_in_line(ptr, end, '"');
+            if (!ptr) return nullptr;
+            update.symbol = std::string_view(value_start, ptr - value_start);
+            ptr++;
+
+            ptr = impl::find_char_in_line(ptr, end, 'U');
+            if (!ptr) return nullptr;
+            ptr += 3;
+
+            value_start = ptr;
+            ptr = impl::find_char_in_line(ptr, end, ',');
+            if (!ptr) return nullptr;
+            update.first_update_id = fast_scalar_parser::parse_uint64(std::string_view(value_start, ptr - value_start));
+
+            ptr = impl::find_char_in_line(ptr, end, 'u');
+            if (!ptr) return nullptr;
+            ptr += 3;
+
+            value_start = ptr;
+            ptr = impl::find_char_in_line(ptr, end, ',');
+            if (!ptr) return nullptr;
+            update.final_update_id = fast_scalar_parser::parse_uint64(std::string_view(value_start, ptr - value_start));
+
+            ptr = impl::find_char_in_line(ptr, end, 'p');
+            if (!ptr) return nullptr;
+            ptr += 4;
+
+            value_start = ptr;
+            ptr = impl::find_char_in_line(ptr, end, ',');
+            if (!ptr) return nullptr;
+            update.previous_update_id = fast_scalar_parser::parse_uint64(std::string_view(value_start, ptr - value_start));
+
+            ptr = impl::find_char_in_line(ptr, end, 'b');
+            if (!ptr) return nullptr;
+            ptr += 3;
+
+            value_start = ptr;
+            ptr = find_levels_end(ptr, end);
+            if (!ptr) return nullptr;
+            update.bids = types::depth_levels_t(std::string_view(value_start, ptr - value_start));
+
+            ptr = impl::find_char_in_line(ptr, end, 'a');
+            if (!ptr) return nullptr;
+            ptr += 3;
+
+            value_start = ptr;
+            ptr = find_levels_end(ptr, end);
+            if (!ptr) return nullptr;
+            update.asks = types::depth_levels_t(std::string_view(value_start, ptr - value_start));
+
+            ptr = impl::find_char_in_line(ptr, end, '}');
+            if (!ptr) return nullptr;
+
+            listener.on_depth_update(update);
+            return ptr + 1;
+        }
+
+        /**
+         * @brief Parse the body of a REST depth snapshot (GET /fapi/v1/depth)
+         * Cold path, called once per (re)synchronisation of an order book. The levels in
+         * `snapshot` point into `raw`.
+         * @return false if a field is missing or the body is truncated
+         */
+        static bool parse_depth_snapshot(std::string_view raw, types::depth_snapshot_t &snapshot) {
+            // Body example: {"lastUpdateId":1027024,"E":1589436922972,"T":1589436922959,"bids":[["4.00000000","431.00000000"]],"asks":[["4.00000200","12.00000000"]]}
+            const char *const end = raw.data() + raw.size();
+
+            auto number = [&](std::string_view key, uint64_t &out) {
+                const size_t at = raw.find(key);
+                if (at == std::string_view::npos) return false;
+                const char *value_start = raw.data() + at + key.size();
+                const char *value_end = value_start;
+                while (value_end < end && *value_end >= '0' && *value_end <= '9') ++value_end;
+                if (value_end == value_start || value_end == end) return false;
+                out = fast_scalar_parser::parse_uint64(std::string_view(value_start, value_end - value_start));
+                return true;
+            };
+            auto levels = [&](std::string_view key, types::depth_levels_t &out) {
+                const size_t at = raw.find(key);
+                if (at == std::string_view::npos) return false;
+                const char *value_start = raw.data() + at + key.size();
+                const char *value_end = find_levels_end(value_start, end);
+                if (!value_end) return false;
+                out = types::depth_levels_t(std::string_view(value_start, value_end - value_start));
+                return true;
+            };
+
+            if (!number(R"("lastUpdateId":)", snapshot.last_update_id)) return false;
+            // E and T are absent from some snapshot variants
+            if (!number(R"("E":)", snapshot.event_time)) snapshot.event_time = 0;
+            if (!number(R"("T":)", snapshot.transaction_time)) snapshot.transaction_time = 0;
+            return levels(R"("bids":)", snapshot.bids) && levels(R"("asks":)", snapshot.asks);
+        }
+
+        // `ptr` on the '[' of a level array; returns the pointer after its closing ']'
+        static __attribute__((always_inline)) const char *find_levels_end(const char *ptr, const char *end) {
+            if (ptr >= end || *ptr != '[') return nullptr;
+            if (ptr + 1 < end && ptr[1] == ']') return ptr + 2;
+            while (true) {
+                ptr = impl::find_char_in_line(ptr + 1, end, ']');
+                if (!ptr || ptr + 1 >= end) return nullptr;
+                if (ptr[1] == ']') return ptr + 2;
+            }
         }
 
         static __attribute__((always_inline)) const char* parse_single_ticker(const char *ptr, const char *end, std::chrono::system_clock::time_point const &now, types::ticker_t &ticker) {
             // Parse a single ticker object, returns pointer after '}' or nullptr on error
             ticker.time = now;
 
-            ptr = impl::find_char(ptr, end, 'E');
+            ptr = impl::find_char_in_line(ptr, end, 'E');
             if (!ptr) return nullptr;
             ptr += 3;
 
             const char *value_start = ptr;
-            ptr = impl::find_char(ptr, end, ',');
+            ptr = impl::find_char_in_line(ptr, end, ',');
             if (!ptr) return nullptr;
             ticker.event_time = fast_scalar_parser::parse_uint64(std::string_view(value_start, ptr - value_start));
 
-            ptr = impl::find_char(ptr, end, 's');
+            ptr = impl::find_char_in_line(ptr, end, 's');
             if (!ptr) return nullptr;
             ptr += 4;
 
             value_start = ptr;
-            ptr = impl::find_char(ptr, end, '"');
+            ptr = impl::find_char_in_line(ptr, end, '"');
             if (!ptr) return nullptr;
             ticker.symbol = std::string_view(value_start, ptr - value_start);
             ptr++;
 
-            ptr = impl::find_char(ptr, end, 'p');
+            ptr = impl::find_char_in_line(ptr, end, 'p');
             if (!ptr) return nullptr;
             ptr += 4;
 
             value_start = ptr;
-            ptr = impl::find_char(ptr, end, '"');
+            ptr = impl::find_char_in_line(ptr, end, '"');
             if (!ptr) return nullptr;
             ticker.price_change = fast_scalar_parser::parse_float(std::string_view(value_start, ptr - value_start));
             ptr++;
 
-            ptr = impl::find_char(ptr, end, 'P');
+            ptr = impl::find_char_in_line(ptr, end, 'P');
             if (!ptr) return nullptr;
             ptr += 4;
 
             value_start = ptr;
-            ptr = impl::find_char(ptr, end, '"');
+            ptr = impl::find_char_in_line(ptr, end, '"');
             if (!ptr) return nullptr;
             ticker.price_change_percent = fast_scalar_parser::parse_float(std::string_view(value_start, ptr - value_start));
             ptr++;
 
-            ptr = impl::find_char(ptr, end, 'w');
+            ptr = impl::find_char_in_line(ptr, end, 'w');
             if (!ptr) return nullptr;
             ptr += 4;
 
             value_start = ptr;
-            ptr = impl::find_char(ptr, end, '"');
+            ptr = impl::find_char_in_line(ptr, end, '"');
             if (!ptr) return nullptr;
             ticker.weighted_avg_price = fast_scalar_parser::parse_float(std::string_view(value_start, ptr - value_start));
             ptr++;
 
-            ptr = impl::find_char(ptr, end, 'c');
+            ptr = impl::find_char_in_line(ptr, end, 'c');
             if (!ptr) return nullptr;
             ptr += 4;
 
             value_start = ptr;
-            ptr = impl::find_char(ptr, end, '"');
+            ptr = impl::find_char_in_line(ptr, end, '"');
             if (!ptr) return nullptr;
             ticker.last_price = fast_scalar_parser::parse_float(std::string_view(value_start, ptr - value_start));
             ptr++;
 
-            ptr = impl::find_char(ptr, end, 'Q');
+            ptr = impl::find_char_in_line(ptr, end, 'Q');
             if (!ptr) return nullptr;
             ptr += 4;
 
             value_start = ptr;
-            ptr = impl::find_char(ptr, end, '"');
+            ptr = impl::find_char_in_line(ptr, end, '"');
             if (!ptr) return nullptr;
             ticker.last_quantity = fast_scalar_parser::parse_float(std::string_view(value_start, ptr - value_start));
             ptr++;
 
-            ptr = impl::find_char(ptr, end, 'o');
+            ptr = impl::find_char_in_line(ptr, end, 'o');
             if (!ptr) return nullptr;
             ptr += 4;
 
             value_start = ptr;
-            ptr = impl::find_char(ptr, end, '"');
+            ptr = impl::find_char_in_line(ptr, end, '"');
             if (!ptr) return nullptr;
             ticker.open_price = fast_scalar_parser::parse_float(std::string_view(value_start, ptr - value_start));
             ptr++;
 
-            ptr = impl::find_char(ptr, end, 'h');
+            ptr = impl::find_char_in_line(ptr, end, 'h');
             if (!ptr) return nullptr;
             ptr += 4;
 
             value_start = ptr;
-            ptr = impl::find_char(ptr, end, '"');
+            ptr = impl::find_char_in_line(ptr, end, '"');
             if (!ptr) return nullptr;
             ticker.high_price = fast_scalar_parser::parse_float(std::string_view(value_start, ptr - value_start));
             ptr++;
 
-            ptr = impl::find_char(ptr, end, 'l');
+            ptr = impl::find_char_in_line(ptr, end, 'l');
             if (!ptr) return nullptr;
             ptr += 4;
 
             value_start = ptr;
-            ptr = impl::find_char(ptr, end, '"');
+            ptr = impl::find_char_in_line(ptr, end, '"');
             if (!ptr) return nullptr;
             ticker.low_price = fast_scalar_parser::parse_float(std::string_view(value_start, ptr - value_start));
             ptr++;
 
-            ptr = impl::find_char(ptr, end, 'v');
+            ptr = impl::find_char_in_line(ptr, end, 'v');
             if (!ptr) return nullptr;
             ptr += 4;
 
             value_start = ptr;
-            ptr = impl::find_char(ptr, end, '"');
+            ptr = impl::find_char_in_line(ptr, end, '"');
             if (!ptr) return nullptr;
             ticker.total_traded_base_volume = fast_scalar_parser::parse_float(std::string_view(value_start, ptr - value_start));
             ptr++;
 
-            ptr = impl::find_char(ptr, end, 'q');
+            ptr = impl::find_char_in_line(ptr, end, 'q');
             if (!ptr) return nullptr;
             ptr += 4;
 
             value_start = ptr;
-            ptr = impl::find_char(ptr, end, '"');
+            ptr = impl::find_char_in_line(ptr, end, '"');
             if (!ptr) return nullptr;
             ticker.total_traded_quote_volume = fast_scalar_parser::parse_float(std::string_view(value_start, ptr - value_start));
             ptr++;
 
-            ptr = impl::find_char(ptr, end, 'O');
+            ptr = impl::find_char_in_line(ptr, end, 'O');
             if (!ptr) return nullptr;
             ptr += 3;
 
             value_start = ptr;
-            ptr = impl::find_char(ptr, end, ',');
+            ptr = impl::find_char_in_line(ptr, end, ',');
             if (!ptr) return nullptr;
             ticker.statistics_open_time = fast_scalar_parser::parse_uint64(std::string_view(value_start, ptr - value_start));
 
-            ptr = impl::find_char(ptr, end, 'C');
+            ptr = impl::find_char_in_line(ptr, end, 'C');
             if (!ptr) return nullptr;
             ptr += 3;
 
             value_start = ptr;
-            ptr = impl::find_char(ptr, end, ',');
+            ptr = impl::find_char_in_line(ptr, end, ',');
             if (!ptr) return nullptr;
             ticker.statistics_close_time = fast_scalar_parser::parse_uint64(std::string_view(value_start, ptr - value_start));
 
-            ptr = impl::find_char(ptr, end, 'F');
+            ptr = impl::find_char_in_line(ptr, end, 'F');
             if (!ptr) return nullptr;
             ptr += 3;
 
             value_start = ptr;
-            ptr = impl::find_char(ptr, end, ',');
+            ptr = impl::find_char_in_line(ptr, end, ',');
             if (!ptr) return nullptr;
             ticker.first_trade_id = fast_scalar_parser::parse_uint64(std::string_view(value_start, ptr - value_start));
 
-            ptr = impl::find_char(ptr, end, 'L');
+            ptr = impl::find_char_in_line(ptr, end, 'L');
             if (!ptr) return nullptr;
             ptr += 3;
 
             value_start = ptr;
-            ptr = impl::find_char(ptr, end, ',');
+            ptr = impl::find_char_in_line(ptr, end, ',');
             if (!ptr) return nullptr;
             ticker.last_trade_id = fast_scalar_parser::parse_uint64(std::string_view(value_start, ptr - value_start));
 
-            ptr = impl::find_char(ptr, end, 'n');
+            ptr = impl::find_char_in_line(ptr, end, 'n');
             if (!ptr) return nullptr;
             ptr += 3;
 
             value_start = ptr;
-            ptr = impl::find_char(ptr, end, '}');
+            ptr = impl::find_char_in_line(ptr, end, '}');
             if (!ptr) return nullptr;
             ticker.total_trades = fast_scalar_parser::parse_uint64(std::string_view(value_start, ptr - value_start));
 
             return ptr + 1; // Return pointer after '}'
         }
 
-        template<BinanceFutureListener listener_t>
+        template<TickerListener listener_t>
         static __attribute__((always_inline)) bool process_ticker(std::chrono::system_clock::time_point const &now, std::string_view raw, listener_t &listener) {
+            return process_ticker(now, raw.data(), raw.data() + raw.size(), listener) != nullptr;
+        }
+
+        template<TickerListener listener_t>
+        static __attribute__((always_inline)) const char *process_ticker(std::chrono::system_clock::time_point const &now, const char *ptr, const char *end, listener_t &listener) {
             // Message example: {"e":"24hrTicker","E":123456789,"s":"BTCUSDT","p":"0.0015","P":"250.00","w":"0.0018","c":"0.0025","Q":"10","o":"0.0010","h":"0.0025","l":"0.0010","v":"10000","q":"18","O":0,"C":86400000,"F":0,"L":18150,"n":18151}
             types::ticker_t ticker;
-            const char *result = parse_single_ticker(raw.data(), raw.data() + raw.size(), now, ticker);
-            if (!result) return false;
+            const char *result = parse_single_ticker(ptr, end, now, ticker);
+            if (!result) return nullptr;
 
             listener.on_ticker(ticker);
-            return true;
+            return result;
         }
 
-        template<BinanceFutureListener listener_t>
+        template<TickerListener listener_t>
         static __attribute__((always_inline)) bool process_ticker_array(std::chrono::system_clock::time_point const &now, std::string_view raw, listener_t &listener) {
-            // Message example: [{"e":"24hrTicker",...},{"e":"24hrTicker",...},...]
-            const char *ptr = raw.data();
-            const char *end = raw.data() + raw.size();
+            return process_ticker_array(now, raw.data(), raw.data() + raw.size(), listener) != nullptr;
+        }
 
+        template<TickerListener listener_t>
+        static __attribute__((always_inline)) const char *process_ticker_array(std::chrono::system_clock::time_point const &now, const char *ptr, const char *end, listener_t &listener) {
+            // Message example: [{"e":"24hrTicker",...},{"e":"24hrTicker",...},...]
             // Find start of array
-            ptr = impl::find_char(ptr, end, '[');
-            if (!ptr) return false;
+            ptr = impl::find_char_in_line(ptr, end, '[');
+            if (!ptr) return nullptr;
             ptr++;
 
             while (ptr < end) {
@@ -444,23 +751,26 @@ namespace core::faster_parser::binance {
                 }
 
                 // Check for end of array
-                if (ptr >= end || *ptr == ']') {
+                if (ptr >= end) {
                     break;
                 }
+                if (*ptr == ']') {
+                    return ptr + 1;
+                }
 
                 // Expect start of object
                 if (*ptr != '{') {
-                    return false;
+                    return nullptr;
                 }
 
                 types::ticker_t ticker;
                 ptr = parse_single_ticker(ptr, end, now, ticker);
-                if (!ptr) return false;
+                if (!ptr) return nullptr;
 
                 listener.on_ticker(ticker);
             }
 
-            return true;
+            return ptr;
         }
     };
 } // core::faster_parser::binance
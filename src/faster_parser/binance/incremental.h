@@ -0,0 +1,169 @@
+/**
+ * @file incremental.h
+ * @author Kevin Rodrigues
+ * @brief Resumable parser for ticker array frames received across several reads
+ * @version 1.0
+ * @date 16/10/2026
+ */
+
+#ifndef FASTER_PARSER_INCREMENTAL_H
+#define FASTER_PARSER_INCREMENTAL_H
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#include "faster_parser/binance/future.h"
+
+namespace core::faster_parser::binance {
+    /**
+     * @brief State machine parsing a [{"e":"24hrTicker",...},...] frame chunk by chunk
+     * Each ticker is dispatched as soon as its closing '}' has been fed. Elements fully inside
+     * a chunk are parsed in place in a single pass; only an element split across chunks is
+     * copied, into a small carry buffer, and parsed once its end arrives. Call reset() before
+     * the next frame.
+     */
+    class ticker_array_stream_t {
+    public:
+        // Tickers are ~350 bytes: with less than this left in the chunk, look for the end of the element before parsing
+        static constexpr size_t tail_size = 512;
+
+        // An element larger than this is treated as malformed input
+        static constexpr size_t max_element_size = 4096;
+
+        ticker_array_stream_t() { carry_.reserve(1024); }
+
+        /**
+         * @brief Consume the next chunk of the frame
+         * @return false once the input is malformed; true otherwise, including after the frame
+         * is complete (bytes following the closing ']' are ignored)
+         */
+        template<TickerListener listener_t>
+        bool feed(std::chrono::system_clock::time_point const &now, std::string_view chunk, listener_t &listener) {
+            const char *ptr = chunk.data();
+            const char *const end = chunk.data() + chunk.size();
+
+            while (ptr < end) {
+                switch (state_) {
+                    case state_t::start:
+                        while (ptr < end && is_space(*ptr)) ptr++;
+                        if (ptr >= end) break;
+                        if (*ptr != '[') return fail();
+                        ptr++;
+                        state_ = state_t::between;
+                        break;
+
+                    case state_t::between: {
+                        // Skip whitespace and commas
+                        while (ptr < end && (is_space(*ptr) || *ptr == ',')) ptr++;
+                        if (ptr >= end) break;
+
+                        if (*ptr == ']') {
+                            state_ = state_t::done;
+                            return true;
+                        }
+                        if (*ptr != '{') return fail();
+
+                        // Elements well inside the chunk are parsed in place; near the end of the
+                        // chunk, check first that the closing '}' has arrived
+                        const char *close = nullptr;
+                        if (static_cast<size_t>(end - ptr) < tail_size) {
+                            close = impl::find_char(ptr, end, '}');
+                            if (!close) {
+                                // Element continues in the next chunk
+                                carry_.assign(ptr, end);
+                                state_ = state_t::element;
+                                ptr = end;
+                                break;
+                            }
+                        }
+
+                        types::ticker_t ticker;
+                        const char *next = binance_future_parser_t::parse_single_ticker(ptr, close ? close + 1 : end, now, ticker);
+                        if (!next) return fail();
+                        listener.on_ticker(ticker);
+                        ++emitted_;
+                        ptr = next;
+                        break;
+                    }
+
+                    case state_t::element: {
+                        const char *close = impl::find_char(ptr, end, '}');
+                        if (!close) {
+                            if (carry_.size() + static_cast<size_t>(end - ptr) > max_element_size) return fail();
+                            carry_.append(ptr, end);
+                            ptr = end;
+                            break;
+                        }
+
+                        carry_.append(ptr, close + 1);
+                        if (!emit(now, carry_.data(), carry_.data() + carry_.size(), listener)) return fail();
+                        carry_.clear();
+                        ptr = close + 1;
+                        state_ = state_t::between;
+                        break;
+                    }
+
+                    case state_t::done:
+                        return true;
+
+                    case state_t::error:
+                        return false;
+                }
+            }
+
+            return state_ != state_t::error;
+        }
+
+        // Forget any partial element and wait for the next frame
+        void reset() {
+            state_ = state_t::start;
+            carry_.clear();
+            emitted_ = 0;
+        }
+
+        // The closing ']' has been consumed
+        [[nodiscard]] bool done() const { return state_ == state_t::done; }
+
+        [[nodiscard]] bool failed() const { return state_ == state_t::error; }
+
+        // Number of tickers dispatched since the last reset()
+        [[nodiscard]] size_t emitted() const { return emitted_; }
+
+    private:
+        enum class state_t : uint8_t {
+            start,   // Waiting for '['
+            between, // Between elements
+            element, // Inside an element split across chunks, head held in carry_
+            done,
+            error
+        };
+
+        static bool is_space(char c) {
+            return c == ' ' || c == '\n' || c == '\r' || c == '\t';
+        }
+
+        template<TickerListener listener_t>
+        __attribute__((always_inline)) bool emit(std::chrono::system_clock::time_point const &now, const char *begin, const char *end, listener_t &listener) {
+            types::ticker_t ticker;
+            if (!binance_future_parser_t::parse_single_ticker(begin, end, now, ticker)) return false;
+            listener.on_ticker(ticker);
+            ++emitted_;
+            return true;
+        }
+
+        bool fail() {
+            state_ = state_t::error;
+            carry_.clear();
+            return false;
+        }
+
+        state_t state_ = state_t::start;
+        std::string carry_;
+        size_t emitted_ = 0;
+    };
+} // namespace core::faster_parser::binance
+
+#endif //FASTER_PARSER_INCREMENTAL_H
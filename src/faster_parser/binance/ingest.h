@@ -0,0 +1,253 @@
+/**
+ * @file ingest.h
+ * @author Kevin Rodrigues
+ * @brief io_uring receive loop parsing straight from a pool of kernel-provided buffers
+ * @version 1.0
+ * @date 16/10/2026
+ */
+
+#ifndef FASTER_PARSER_BINANCE_INGEST_H
+#define FASTER_PARSER_BINANCE_INGEST_H
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "faster_parser/binance/future.h"
+#include "faster_parser/core/io_uring.h"
+
+namespace core::faster_parser::binance {
+    /**
+     * @brief Consumes a received byte stream. Returns how many bytes it consumed; the rest is
+     * the start of a message that has not fully arrived. Both parse_stream (newline-delimited)
+     * and websocket_feed_t::feed (WebSocket frames) fit.
+     */
+    template<typename T>
+    concept StreamConsumer = requires(T &consumer, std::span<char> buffer) {
+        { consumer(buffer) } -> std::convertible_to<size_t>;
+    };
+
+    struct uring_ingest_options_t {
+        unsigned buffer_count = 64;            // Power of two
+        unsigned buffer_size = 64 * 1024;
+        size_t max_message_size = 1 << 20;     // A longer incomplete message is a stream error
+    };
+
+    /**
+     * @brief Owns a connected socket and receives from it with io_uring multishot recv
+     * The kernel picks a buffer from a pool of padded buffers (a provided buffer ring) for every
+     * receive; the consumer runs over that buffer in place and the buffer goes back to the pool
+     * as soon as the consumer returns. Only a message split across two buffers is copied, into a
+     * small carry buffer, and only up to the end of that message.
+     * Requires Linux 6.0+ (multishot recv); open() returns false where io_uring is unavailable.
+     */
+    class uring_ingest_t {
+    public:
+        // Zero bytes after every buffer, for SIMD loads past the end of a receive
+        static constexpr size_t padding = 64;
+
+        using options_t = uring_ingest_options_t;
+
+        uring_ingest_t() = default;
+        uring_ingest_t(uring_ingest_t const &) = delete;
+        uring_ingest_t &operator=(uring_ingest_t const &) = delete;
+
+        ~uring_ingest_t() { close(); }
+
+        /**
+         * @brief Take ownership of a connected socket and arm the first receive
+         * @return false if io_uring or provided buffer rings are unavailable; the socket is then
+         * left open and still owned by the caller
+         */
+        bool open(int fd, options_t options = {}) {
+            close();
+            if (options.buffer_count == 0 || (options.buffer_count & (options.buffer_count - 1)) != 0) return false;
+            if (options.buffer_count > 32768 || options.buffer_size == 0) return false;
+
+            options_ = options;
+            stride_ = options.buffer_size + padding;
+            pool_size_ = stride_ * options.buffer_count;
+            void *pool = ::mmap(nullptr, pool_size_, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_POPULATE, -1, 0);
+            if (pool == MAP_FAILED) return false;
+            pool_ = static_cast<char *>(pool);
+
+            if (!ring_.init(64) || !ring_.setup_buffer_ring(options.buffer_count, buffer_group)) {
+                release_pool();
+                ring_.close();
+                return false;
+            }
+            for (unsigned i = 0; i < options.buffer_count; ++i) {
+                ring_.add_buffer(buffer(static_cast<uint16_t>(i)), options.buffer_size, static_cast<uint16_t>(i));
+            }
+            ring_.publish_buffers();
+
+            fd_ = fd;
+            carry_.clear();
+            carry_.reserve(options.buffer_size);
+            eof_ = false;
+            error_ = 0;
+            bytes_received_ = 0;
+            return arm();
+        }
+
+        void close() {
+            ring_.close();
+            release_pool();
+            if (fd_ >= 0) ::close(fd_);
+            fd_ = -1;
+            armed_ = false;
+        }
+
+        /**
+         * @brief Process the receives that have completed, waiting for at least one if `wait`
+         * @return false once the peer has closed the connection (eof()) or on error (error())
+         */
+        template<StreamConsumer consumer_t>
+        bool poll(consumer_t &consumer, bool wait = true) {
+            if (fd_ < 0 || eof_ || error_) return false;
+            if (!armed_ && !arm()) return false;
+            if (!ring_.submit(wait ? 1 : 0)) {
+                error_ = errno;
+                return false;
+            }
+
+            bool recycled = false;
+            ring_.for_each_cqe([&](io_uring_cqe const &cqe) {
+                if (!(cqe.flags & IORING_CQE_F_MORE)) armed_ = false;
+
+                if (cqe.res > 0) [[likely]] {
+                    const auto id = static_cast<uint16_t>(cqe.flags >> IORING_CQE_BUFFER_SHIFT);
+                    bytes_received_ += static_cast<size_t>(cqe.res);
+                    if (!error_) consume(buffer(id), static_cast<size_t>(cqe.res), consumer);
+                    ring_.add_buffer(buffer(id), options_.buffer_size, id);
+                    recycled = true;
+                } else if (cqe.res == 0) {
+                    eof_ = true;
+                } else if (cqe.res != -ENOBUFS) {
+                    // ENOBUFS: every buffer was in use; re-armed below once they are recycled
+                    error_ = -cqe.res;
+                }
+            });
+            if (recycled) ring_.publish_buffers();
+
+            return !eof_ && !error_;
+        }
+
+        // Receive and consume until the peer closes the connection. Returns false on error.
+        template<StreamConsumer consumer_t>
+        bool run(consumer_t &consumer) {
+            while (poll(consumer)) {}
+            return error_ == 0;
+        }
+
+        /**
+         * @brief Receive newline-delimited Binance messages until the connection closes
+         * Each buffer is parsed with binance_future_parser_t::parse_stream, time-stamped when it
+         * is handed to the parser.
+         */
+        template<BinanceFutureListener listener_t>
+        bool run_ndjson(listener_t &listener) {
+            auto consumer = [&listener](std::span<char> buffer) {
+                return binance_future_parser_t::parse_stream(std::chrono::system_clock::now(),
+                                                             std::string_view(buffer.data(), buffer.size()), listener);
+            };
+            return run(consumer);
+        }
+
+        [[nodiscard]] bool eof() const { return eof_; }
+
+        // errno of the failed receive, or EMSGSIZE if an incomplete message outgrew max_message_size
+        [[nodiscard]] int error() const { return error_; }
+
+        [[nodiscard]] size_t bytes_received() const { return bytes_received_; }
+
+        // Bytes of an incomplete message waiting for the next receive
+        [[nodiscard]] size_t pending() const { return carry_.size(); }
+
+    private:
+        static constexpr uint16_t buffer_group = 0;
+
+        char *buffer(uint16_t id) const { return pool_ + static_cast<size_t>(id) * stride_; }
+
+        bool arm() {
+            io_uring_sqe *sqe = ring_.get_sqe();
+            if (!sqe) return false;
+            sqe->opcode = IORING_OP_RECV;
+            sqe->fd = fd_;
+            sqe->ioprio = IORING_RECV_MULTISHOT;
+            sqe->flags = IOSQE_BUFFER_SELECT;
+            sqe->buf_group = buffer_group;
+            armed_ = true;
+            return true;
+        }
+
+        template<StreamConsumer consumer_t>
+        __attribute__((always_inline)) void consume(char *data, size_t length, consumer_t &consumer) {
+            size_t offset = 0;
+
+            if (!carry_.empty()) [[unlikely]] {
+                // Finish the message left over from the previous buffer, copying in growing steps
+                // so that a short tail costs a short copy
+                size_t prefix = carry_.size();
+                size_t taken = 0;
+                while (true) {
+                    const size_t step = std::min(length - taken, std::max<size_t>(prefix, 512));
+                    carry_.append(data + taken, step);
+                    taken += step;
+
+                    const size_t consumed = consumer(std::span<char>(carry_.data(), carry_.size()));
+                    if (consumed >= prefix) {
+                        offset = consumed - prefix;
+                        carry_.clear();
+                        break;
+                    }
+
+                    carry_.erase(0, consumed);
+                    prefix = carry_.size() - taken;
+                    if (taken == length) {
+                        if (carry_.size() > options_.max_message_size) error_ = EMSGSIZE;
+                        return;
+                    }
+                }
+            }
+
+            const size_t remaining = length - offset;
+            const size_t consumed = consumer(std::span<char>(data + offset, remaining));
+            if (consumed < remaining) {
+                if (remaining - consumed > options_.max_message_size) {
+                    error_ = EMSGSIZE;
+                    return;
+                }
+                carry_.assign(data + offset + consumed, remaining - consumed);
+            }
+        }
+
+        void release_pool() {
+            if (pool_) ::munmap(pool_, pool_size_);
+            pool_ = nullptr;
+        }
+
+        io_uring_t ring_;
+        options_t options_;
+        int fd_ = -1;
+        char *pool_ = nullptr;
+        size_t pool_size_ = 0;
+        size_t stride_ = 0;
+        std::string carry_;
+        bool armed_ = false;
+        bool eof_ = false;
+        int error_ = 0;
+        size_t bytes_received_ = 0;
+    };
+} // namespace core::faster_parser::binance
+
+#endif //FASTER_PARSER_BINANCE_INGEST_H
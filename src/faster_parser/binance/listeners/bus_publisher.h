@@ -0,0 +1,67 @@
+/**
+ * @file bus_publisher.h
+ * @author Kevin Rodrigues
+ * @brief Listener publishing parsed events to a shared-memory bus read by other processes
+ * @version 1.0
+ * @date 16/10/2026
+ */
+
+#ifndef FASTER_PARSER_BUS_PUBLISHER_H
+#define FASTER_PARSER_BUS_PUBLISHER_H
+
+#include <concepts>
+#include <cstdint>
+
+#include "faster_parser/binance/types/book_ticker.h"
+#include "faster_parser/binance/types/event_slot.h"
+#include "faster_parser/binance/types/ticker.h"
+#include "faster_parser/binance/types/trade.h"
+#include "faster_parser/core/shm_ring.h"
+
+namespace core::faster_parser::binance::listeners {
+    using event_bus_writer_t = shm_ring_writer_t<types::event_slot_t>;
+    using event_bus_reader_t = shm_ring_reader_t<types::event_slot_t>;
+    using book_trade_bus_writer_t = shm_ring_writer_t<types::book_trade_slot_t>;
+    using book_trade_bus_reader_t = shm_ring_reader_t<types::book_trade_slot_t>;
+
+    /**
+     * @brief BinanceFutureListener writing every event into a shared-memory ring of event slots
+     * One process parses the feed and publishes; strategy processes open a reader of the same
+     * slot type on the same name and read the slots, with no parsing of their own. A bus of
+     * book_trade_slot_t carries no tickers and takes three cache lines per event instead of
+     * four. Publishing never blocks on readers.
+     */
+    template<typename slot_t>
+    class basic_event_bus_publisher_t {
+    public:
+        using bus_t = shm_ring_writer_t<slot_t>;
+
+        explicit basic_event_bus_publisher_t(bus_t &bus) : bus_(&bus) {}
+
+        __attribute__((always_inline)) void on_book_ticker(const types::book_ticker_t &ticker) { write(ticker); }
+
+        __attribute__((always_inline)) void on_trade(const types::trade_t &trade) { write(trade); }
+
+        __attribute__((always_inline)) void on_ticker(const types::ticker_t &ticker)
+            requires std::same_as<slot_t, types::event_slot_t> {
+            write(ticker);
+        }
+
+        [[nodiscard]] uint64_t published() const { return published_; }
+
+    private:
+        template<typename event_t>
+        __attribute__((always_inline)) void write(event_t const &event) {
+            bus_->publish([&event](slot_t &slot) { slot.assign(event); });
+            ++published_;
+        }
+
+        bus_t *bus_;
+        uint64_t published_ = 0;
+    };
+
+    using event_bus_publisher_t = basic_event_bus_publisher_t<types::event_slot_t>;
+    using book_trade_bus_publisher_t = basic_event_bus_publisher_t<types::book_trade_slot_t>;
+} // namespace core::faster_parser::binance::listeners
+
+#endif //FASTER_PARSER_BUS_PUBLISHER_H
@@ -0,0 +1,193 @@
+/**
+ * @file conflation.h
+ * @author Kevin Rodrigues
+ * @brief Per-symbol conflation: producers overwrite the latest event, consumers drain dirty symbols
+ * @version 1.0
+ * @date 16/10/2026
+ */
+
+#ifndef FASTER_PARSER_CONFLATION_H
+#define FASTER_PARSER_CONFLATION_H
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string_view>
+
+#include "faster_parser/binance/symbol_registry.h"
+#include "faster_parser/binance/types/book_ticker.h"
+#include "faster_parser/binance/types/compact.h"
+#include "faster_parser/binance/types/symbol.h"
+#include "faster_parser/binance/types/ticker.h"
+
+namespace core::faster_parser::binance::listeners {
+    /**
+     * @brief Latest value per symbol id plus a dirty bitmap, one writer and one drainer
+     * write() overwrites the slot in place under a per-slot seqlock, then sets the slot's dirty
+     * bit with an atomic OR. drain() takes the dirty bits 64 symbols at a time with one
+     * exchange and delivers a consistent copy of each dirty slot. The OR is done on every
+     * write, even when the bit looks set: a plain load of the bit could be reordered before
+     * the slot's release store (StoreLoad, allowed even on x86), so an update could be skipped
+     * just as drain() takes the bit and reads the previous value. With the read-modify-write,
+     * either drain() takes the bit after the OR and sees the update, or the OR sets the bit
+     * again for the next drain: the consumer always converges on the latest value.
+     */
+    template<typename value_t>
+    class conflation_table_t {
+    public:
+        // Consistent copy of a slot as handed to the drain callback
+        struct entry_t {
+            value_t value;
+            int64_t receive_time;                       // system_clock ticks
+            uint64_t updates;                           // Updates written to the slot so far
+        };
+
+        explicit conflation_table_t(size_t max_ids)
+            : slots_(std::make_unique<slot_t[]>(max_ids)),
+              dirty_(std::make_unique<std::atomic<uint64_t>[]>((max_ids + 63) / 64)),
+              words_((max_ids + 63) / 64) {}
+
+        // Producer: fill the slot of `id` with fn(value_t &)
+        template<typename fn_t>
+        __attribute__((always_inline)) void write(symbol_id_t id, int64_t receive_time, fn_t &&fn) {
+            slot_t &slot = slots_[id];
+            const uint64_t sequence = slot.sequence.load(std::memory_order_relaxed);
+            slot.sequence.store(sequence + 1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+            fn(slot.entry.value);
+            slot.entry.receive_time = receive_time;
+            ++slot.entry.updates;
+            slot.sequence.store(sequence + 2, std::memory_order_release);
+
+            std::atomic<uint64_t> &word = dirty_[id / 64];
+            const uint64_t bit = uint64_t{1} << (id % 64);
+            word.fetch_or(bit, std::memory_order_release);
+        }
+
+        /**
+         * @brief Consumer: call fn(symbol_id_t, entry_t const &) once per dirty slot, lowest id first
+         * @return Number of slots delivered
+         */
+        template<typename fn_t>
+        size_t drain(fn_t &&fn) {
+            size_t count = 0;
+            entry_t copy;
+            for (size_t w = 0; w < words_; ++w) {
+                if (dirty_[w].load(std::memory_order_relaxed) == 0) continue;
+                uint64_t bits = dirty_[w].exchange(0, std::memory_order_acquire);
+                while (bits) {
+                    const auto id = static_cast<symbol_id_t>(w * 64 + static_cast<size_t>(std::countr_zero(bits)));
+                    bits &= bits - 1;
+                    read(id, copy);
+                    fn(id, static_cast<entry_t const &>(copy));
+                    ++count;
+                }
+            }
+            return count;
+        }
+
+        // Any thread: consistent copy of a slot, whether dirty or not
+        __attribute__((always_inline)) void read(symbol_id_t id, entry_t &out) const {
+            slot_t const &slot = slots_[id];
+            while (true) {
+                const uint64_t before = slot.sequence.load(std::memory_order_acquire);
+                if (before & 1) [[unlikely]] continue;
+                std::memcpy(static_cast<void *>(&out), &slot.entry, sizeof(entry_t));
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (slot.sequence.load(std::memory_order_relaxed) == before) [[likely]] return;
+            }
+        }
+
+        [[nodiscard]] bool dirty(symbol_id_t id) const {
+            return dirty_[id / 64].load(std::memory_order_relaxed) & (uint64_t{1} << (id % 64));
+        }
+
+    private:
+        struct alignas(64) slot_t {
+            std::atomic<uint64_t> sequence{0};          // Odd while the producer writes
+            entry_t entry{};
+        };
+
+        std::unique_ptr<slot_t[]> slots_;
+        std::unique_ptr<std::atomic<uint64_t>[]> dirty_;
+        size_t words_;
+    };
+
+    /**
+     * @brief Listener conflating book tickers and 24hr tickers per symbol for slow consumers
+     * The parsing thread overwrites the latest compact book ticker / ticker of the symbol and
+     * marks it dirty; it never allocates, locks or waits on the consumer. A consumer (risk,
+     * UI) calls drain_book_tickers() / drain_tickers() at its own pace and receives only the
+     * symbols updated since its previous call, each with its latest value. One consumer per
+     * event type.
+     */
+    class conflating_cache_t {
+    public:
+        using book_ticker_entry_t = conflation_table_t<types::book_ticker_compact_t>::entry_t;
+        using ticker_entry_t = conflation_table_t<types::ticker_compact_t>::entry_t;
+
+        explicit conflating_cache_t(size_t max_symbols = symbol_registry_t::default_max_symbols)
+            : registry_(max_symbols), book_tickers_(max_symbols), tickers_(max_symbols),
+              symbols_(std::make_unique<types::symbol_t[]>(max_symbols)) {}
+
+        conflating_cache_t(conflating_cache_t const &) = delete;
+        conflating_cache_t &operator=(conflating_cache_t const &) = delete;
+
+        __attribute__((always_inline)) void on_book_ticker(const types::book_ticker_t &ticker) {
+            const symbol_id_t id = intern(ticker.symbol);
+            if (id == invalid_symbol_id) [[unlikely]] {
+                ++dropped_;
+                return;
+            }
+            book_tickers_.write(id, ticker.time.time_since_epoch().count(),
+                                [&ticker](types::book_ticker_compact_t &value) { value = types::book_ticker_compact_t(ticker); });
+        }
+
+        __attribute__((always_inline)) void on_ticker(const types::ticker_t &ticker) {
+            const symbol_id_t id = intern(ticker.symbol);
+            if (id == invalid_symbol_id) [[unlikely]] {
+                ++dropped_;
+                return;
+            }
+            tickers_.write(id, ticker.time.time_since_epoch().count(),
+                           [&ticker](types::ticker_compact_t &value) { value = types::ticker_compact_t(ticker); });
+        }
+
+        // Producer thread (or setup): id of a symbol, assigned on first sight
+        symbol_id_t intern(std::string_view symbol) {
+            const symbol_id_t id = registry_.intern(symbol);
+            if (id != invalid_symbol_id && id >= count_.load(std::memory_order_relaxed)) {
+                symbols_[id] = registry_.symbol(id);
+                count_.store(id + 1, std::memory_order_release);
+            }
+            return id;
+        }
+
+        // fn(symbol_id_t, book_ticker_entry_t const &) for every symbol updated since the last call
+        template<typename fn_t>
+        size_t drain_book_tickers(fn_t &&fn) { return book_tickers_.drain(fn); }
+
+        // fn(symbol_id_t, ticker_entry_t const &) for every symbol updated since the last call
+        template<typename fn_t>
+        size_t drain_tickers(fn_t &&fn) { return tickers_.drain(fn); }
+
+        [[nodiscard]] types::symbol_t const &symbol(symbol_id_t id) const { return symbols_[id]; }
+        [[nodiscard]] size_t size() const { return count_.load(std::memory_order_acquire); }
+
+        // Events for symbols beyond max_symbols (producer-side counter)
+        [[nodiscard]] uint64_t dropped() const { return dropped_; }
+
+    private:
+        symbol_registry_t registry_;
+        conflation_table_t<types::book_ticker_compact_t> book_tickers_;
+        conflation_table_t<types::ticker_compact_t> tickers_;
+        std::unique_ptr<types::symbol_t[]> symbols_;
+        std::atomic<symbol_id_t> count_{0};
+        uint64_t dropped_ = 0;
+    };
+} // namespace core::faster_parser::binance::listeners
+
+#endif //FASTER_PARSER_CONFLATION_H
@@ -0,0 +1,123 @@
+/**
+ * @file latency_recorder.h
+ * @author Kevin Rodrigues
+ * @brief Exchange-to-local latency histograms per message type, between the parser and a listener
+ * @version 1.0
+ * @date 16/10/2026
+ */
+
+#ifndef FASTER_PARSER_LATENCY_RECORDER_H
+#define FASTER_PARSER_LATENCY_RECORDER_H
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "faster_parser/binance/concepts.h"
+#include "faster_parser/binance/trace.h"
+#include "faster_parser/core/histogram.h"
+
+namespace core::faster_parser::binance::listeners {
+    /**
+     * @brief Listener adaptor recording `time - exchange timestamp` of every message in ns
+     * time is the `now` given to the parser; the exchange timestamp is E (event time) for
+     * every type, in milliseconds, so values carry up to 1 ms of truncation on top of the
+     * clock offset between the exchange and this host. Messages stamped ahead of local time
+     * (clock skew) are recorded as 0 and counted in ahead(). Ticker array elements are
+     * recorded as tickers. Only the callbacks listener_t implements are exposed. One
+     * recorder per parsing thread; merge() them for reporting.
+     */
+    template<typename listener_t>
+    class latency_recorder_t {
+    public:
+        explicit latency_recorder_t(listener_t &listener)
+            : listener_(listener), histograms_(std::make_unique<latency_histogram_t[]>(trace_type_count)) {}
+
+        latency_recorder_t(latency_recorder_t const &) = delete;
+        latency_recorder_t &operator=(latency_recorder_t const &) = delete;
+
+        __attribute__((always_inline)) void on_book_ticker(const types::book_ticker_t &ticker)
+            requires BookTickerListener<listener_t> {
+            record(trace_type_t::book_ticker, ticker.time, ticker.exchange_timestamp);
+            listener_.on_book_ticker(ticker);
+        }
+
+        __attribute__((always_inline)) void on_trade(const types::trade_t &trade)
+            requires TradeListener<listener_t> {
+            record(trace_type_t::trade, trade.time, trade.event_time);
+            listener_.on_trade(trade);
+        }
+
+        __attribute__((always_inline)) void on_ticker(const types::ticker_t &ticker)
+            requires TickerListener<listener_t> {
+            record(trace_type_t::ticker, ticker.time, ticker.event_time);
+            listener_.on_ticker(ticker);
+        }
+
+        __attribute__((always_inline)) void on_depth_update(const types::depth_update_t &update)
+            requires DepthListener<listener_t> {
+            record(trace_type_t::depth, update.time, update.event_time);
+            listener_.on_depth_update(update);
+        }
+
+        [[nodiscard]] latency_histogram_t const &histogram(trace_type_t type) const { return histograms_[static_cast<size_t>(type)]; }
+        [[nodiscard]] uint64_t ahead() const { return ahead_.load(std::memory_order_relaxed); }
+
+        // Add another thread's recorder (see latency_histogram_t::merge)
+        template<typename other_listener_t>
+        void merge(latency_recorder_t<other_listener_t> const &other) {
+            for (size_t i = 0; i < trace_type_count; ++i) histograms_[i].merge(other.histogram(static_cast<trace_type_t>(i)));
+            ahead_.store(ahead() + other.ahead(), std::memory_order_relaxed);
+        }
+
+        void reset() {
+            for (size_t i = 0; i < trace_type_count; ++i) histograms_[i].reset();
+            ahead_.store(0, std::memory_order_relaxed);
+        }
+
+        // One line per type with messages, in µs: "trade count=... p50=... us"
+        [[nodiscard]] std::string to_text() const {
+            std::string out;
+            for (size_t i = 0; i < trace_type_count; ++i) {
+                if (histograms_[i].count() == 0) continue;
+                out += histograms_[i].to_text(trace_type_names[i], 1e-3, "us");
+                out += '\n';
+            }
+            return out;
+        }
+
+        // {"book_ticker":{...},"trade":{...}} in µs, types with messages only
+        [[nodiscard]] std::string to_json() const {
+            std::string out = "{";
+            for (size_t i = 0; i < trace_type_count; ++i) {
+                if (histograms_[i].count() == 0) continue;
+                if (out.size() > 1) out += ',';
+                out += '"';
+                out += trace_type_names[i];
+                out += "\":";
+                out += histograms_[i].to_json(1e-3);
+            }
+            out += '}';
+            return out;
+        }
+
+    private:
+        __attribute__((always_inline)) void record(trace_type_t type, std::chrono::system_clock::time_point time, uint64_t exchange_ms) {
+            const auto local_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(time.time_since_epoch()).count();
+            const int64_t latency = local_ns - static_cast<int64_t>(exchange_ms) * 1'000'000;
+            if (latency < 0) [[unlikely]] {
+                ahead_.store(ahead() + 1, std::memory_order_relaxed);
+            }
+            histograms_[static_cast<size_t>(type)].record(latency < 0 ? 0 : static_cast<uint64_t>(latency));
+        }
+
+        listener_t &listener_;
+        std::unique_ptr<latency_histogram_t[]> histograms_;
+        std::atomic<uint64_t> ahead_ = 0;
+    };
+} // namespace core::faster_parser::binance::listeners
+
+#endif //FASTER_PARSER_LATENCY_RECORDER_H
@@ -0,0 +1,91 @@
+/**
+ * @file ring_writer.h
+ * @author Kevin Rodrigues
+ * @brief Listener writing parsed events straight into the slots of an SPSC ring
+ * @version 1.0
+ * @date 16/10/2026
+ */
+
+#ifndef FASTER_PARSER_RING_WRITER_H
+#define FASTER_PARSER_RING_WRITER_H
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+
+#include "faster_parser/binance/types/book_ticker.h"
+#include "faster_parser/binance/types/event_slot.h"
+#include "faster_parser/binance/types/ticker.h"
+#include "faster_parser/binance/types/trade.h"
+#include "faster_parser/core/spsc_ring.h"
+
+namespace core::faster_parser::binance::listeners {
+    using event_ring_t = spsc_ring_t<types::event_slot_t>;
+    using book_trade_ring_t = spsc_ring_t<types::book_trade_slot_t>;
+
+    /**
+     * @brief BinanceFutureListener producing into an SPSC ring of event slots from the parsing thread
+     * Each event is converted to its compact layout directly inside the next free slot; with
+     * book_trade_slot_t the listener has no ticker callback, so tickers are not parsed. Slots
+     * are published every `batch_size` events; with a batch larger than one, call flush()
+     * after each parse call (e.g. after parse_stream over a receive buffer) so the tail of the
+     * batch does not wait for the next read. The parser thread never blocks: when the
+     * consumer falls a whole ring behind, events are dropped and counted in dropped().
+     */
+    template<typename slot_t>
+    class basic_event_ring_writer_t {
+    public:
+        using ring_t = spsc_ring_t<slot_t>;
+
+        explicit basic_event_ring_writer_t(ring_t &ring, size_t batch_size = 1)
+            : ring_(&ring), batch_size_(batch_size ? batch_size : 1) {}
+
+        __attribute__((always_inline)) void on_book_ticker(const types::book_ticker_t &ticker) { write(ticker); }
+
+        __attribute__((always_inline)) void on_trade(const types::trade_t &trade) { write(trade); }
+
+        __attribute__((always_inline)) void on_ticker(const types::ticker_t &ticker)
+            requires std::same_as<slot_t, types::event_slot_t> {
+            write(ticker);
+        }
+
+        // Publish the events of a partial batch
+        __attribute__((always_inline)) void flush() {
+            if (pending_) {
+                ring_->publish();
+                pending_ = 0;
+            }
+        }
+
+        [[nodiscard]] uint64_t written() const { return written_; }
+        [[nodiscard]] uint64_t dropped() const { return dropped_; }
+
+    private:
+        template<typename event_t>
+        __attribute__((always_inline)) void write(event_t const &event) {
+            slot_t *slot = ring_->next_slot();
+            if (!slot) [[unlikely]] {
+                ++dropped_;
+                return;
+            }
+            slot->assign(event);
+            ring_->commit();
+            ++written_;
+            if (++pending_ >= batch_size_) {
+                ring_->publish();
+                pending_ = 0;
+            }
+        }
+
+        ring_t *ring_;
+        size_t batch_size_;
+        size_t pending_ = 0;
+        uint64_t written_ = 0;
+        uint64_t dropped_ = 0;
+    };
+
+    using event_ring_writer_t = basic_event_ring_writer_t<types::event_slot_t>;
+    using book_trade_ring_writer_t = basic_event_ring_writer_t<types::book_trade_slot_t>;
+} // namespace core::faster_parser::binance::listeners
+
+#endif //FASTER_PARSER_RING_WRITER_H
@@ -0,0 +1,181 @@
+/**
+ * @file sequence_checker.h
+ * @author Kevin Rodrigues
+ * @brief Per-symbol sequence continuity checks between the parser and a listener
+ * @version 1.0
+ * @date 16/10/2026
+ */
+
+#ifndef FASTER_PARSER_SEQUENCE_CHECKER_H
+#define FASTER_PARSER_SEQUENCE_CHECKER_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string_view>
+
+#include "faster_parser/binance/concepts.h"
+#include "faster_parser/binance/symbol_registry.h"
+#include "faster_parser/binance/types/sequence.h"
+
+namespace core::faster_parser::binance::listeners {
+    /**
+     * @brief Listener adaptor checking sequence ids per symbol before forwarding to `listener_t`
+     * Sits between the parser and the listener, so the checks run inside the parse call on
+     * the fields that were just parsed. Last ids live in a flat array indexed by interned
+     * symbol id; a check is one registry probe plus one compare.
+     * - aggTrade: agg trade ids (a) are contiguous per symbol, so skipped ids are gaps.
+     * - bookTicker: update ids (u) only increase, so only duplicates and regressions.
+     * - depthUpdate: pu must equal the previous u.
+     * Each break is reported to listener_t::on_sequence_event when it implements it
+     * (SequenceListener) and counted. Duplicates and regressions are still forwarded unless
+     * drop_stale is set. Only the callbacks listener_t implements are exposed, so message
+     * types the listener ignores stay compiled out of the parser.
+     */
+    template<typename listener_t>
+    class sequence_checker_t {
+    public:
+        explicit sequence_checker_t(listener_t &listener, size_t max_symbols = symbol_registry_t::default_max_symbols,
+                                    bool drop_stale = false)
+            : listener_(listener), registry_(max_symbols), entries_(std::make_unique<entry_t[]>(max_symbols)),
+              max_symbols_(max_symbols), drop_stale_(drop_stale) {}
+
+        sequence_checker_t(sequence_checker_t const &) = delete;
+        sequence_checker_t &operator=(sequence_checker_t const &) = delete;
+
+        __attribute__((always_inline)) void on_book_ticker(const types::book_ticker_t &ticker)
+            requires BookTickerListener<listener_t> {
+            const symbol_id_t id = registry_.intern(ticker.symbol);
+            if (id == invalid_symbol_id) [[unlikely]] {
+                ++dropped_;
+            } else if (!check<types::sequence_stream_t::book_ticker, false>(entries_[id].book_update_id, id, ticker.symbol, ticker.bid.sequence)) {
+                return;
+            }
+            listener_.on_book_ticker(ticker);
+        }
+
+        __attribute__((always_inline)) void on_trade(const types::trade_t &trade)
+            requires TradeListener<listener_t> {
+            const symbol_id_t id = registry_.intern(trade.symbol);
+            if (id == invalid_symbol_id) [[unlikely]] {
+                ++dropped_;
+            } else if (!check<types::sequence_stream_t::trade, true>(entries_[id].agg_trade_id, id, trade.symbol, trade.agg_trade_id)) {
+                return;
+            }
+            listener_.on_trade(trade);
+        }
+
+        // 24hr tickers carry no sequence id: forwarded unchecked
+        __attribute__((always_inline)) void on_ticker(const types::ticker_t &ticker)
+            requires TickerListener<listener_t> {
+            listener_.on_ticker(ticker);
+        }
+
+        __attribute__((always_inline)) void on_depth_update(const types::depth_update_t &update)
+            requires DepthListener<listener_t> {
+            const symbol_id_t id = registry_.intern(update.symbol);
+            if (id == invalid_symbol_id) [[unlikely]] {
+                ++dropped_;
+                listener_.on_depth_update(update);
+                return;
+            }
+
+            uint64_t &last = entries_[id].depth_update_id;
+            const uint64_t previous = last;
+            if (update.final_update_id > previous) [[likely]] {
+                last = update.final_update_id;
+                if (previous != 0 && update.previous_update_id != previous) [[unlikely]] {
+                    ++gaps_;
+                    report(types::sequence_issue_t::gap, types::sequence_stream_t::depth, id, update.symbol,
+                           previous, update.previous_update_id);
+                }
+            } else {
+                stale(types::sequence_stream_t::depth, id, update.symbol, previous, update.final_update_id);
+                if (drop_stale_) return;
+            }
+            listener_.on_depth_update(update);
+        }
+
+        // Forget every last id, e.g. after a reconnect where a gap is expected
+        void reset() {
+            std::fill_n(entries_.get(), max_symbols_, entry_t{});
+        }
+
+        // Last id seen on a symbol's stream, 0 if none
+        [[nodiscard]] uint64_t last(std::string_view symbol, types::sequence_stream_t stream) const {
+            const symbol_id_t id = registry_.find(symbol);
+            if (id == invalid_symbol_id) return 0;
+            entry_t const &entry = entries_[id];
+            switch (stream) {
+                case types::sequence_stream_t::book_ticker: return entry.book_update_id;
+                case types::sequence_stream_t::trade: return entry.agg_trade_id;
+                case types::sequence_stream_t::depth: return entry.depth_update_id;
+            }
+            return 0;
+        }
+
+        [[nodiscard]] uint64_t gaps() const { return gaps_; }
+        [[nodiscard]] uint64_t missing() const { return missing_; }           // Agg trade ids skipped in gaps
+        [[nodiscard]] uint64_t duplicates() const { return duplicates_; }
+        [[nodiscard]] uint64_t regressions() const { return regressions_; }
+        [[nodiscard]] uint64_t dropped() const { return dropped_; }           // Unchecked: beyond max_symbols
+
+    private:
+        struct alignas(32) entry_t {
+            uint64_t book_update_id = 0;
+            uint64_t agg_trade_id = 0;
+            uint64_t depth_update_id = 0;
+        };
+
+        // Advance `last` to `received`; false if the message is stale and must be dropped
+        template<types::sequence_stream_t stream, bool contiguous>
+        __attribute__((always_inline)) bool check(uint64_t &last, symbol_id_t id, std::string_view symbol, uint64_t received) {
+            const uint64_t previous = last;
+            if (received > previous) [[likely]] {
+                last = received;
+                if (contiguous && previous != 0 && received != previous + 1) [[unlikely]] {
+                    ++gaps_;
+                    missing_ += received - previous - 1;
+                    report(types::sequence_issue_t::gap, stream, id, symbol, previous + 1, received);
+                }
+                return true;
+            }
+            stale(stream, id, symbol, previous, received);
+            return !drop_stale_;
+        }
+
+        // Cold path: `received` is not newer than `previous`
+        __attribute__((noinline)) void stale(types::sequence_stream_t stream, symbol_id_t id, std::string_view symbol,
+                                             uint64_t previous, uint64_t received) {
+            const bool duplicate = received == previous;
+            if (duplicate) {
+                ++duplicates_;
+            } else {
+                ++regressions_;
+            }
+            report(duplicate ? types::sequence_issue_t::duplicate : types::sequence_issue_t::regression,
+                   stream, id, symbol, previous + 1, received);
+        }
+
+        __attribute__((always_inline)) void report(types::sequence_issue_t issue, types::sequence_stream_t stream, symbol_id_t id,
+                                                   std::string_view symbol, uint64_t expected, uint64_t received) {
+            if constexpr (SequenceListener<listener_t>) {
+                listener_.on_sequence_event(types::sequence_event_t{issue, stream, id, symbol, expected, received});
+            }
+        }
+
+        listener_t &listener_;
+        symbol_registry_t registry_;
+        std::unique_ptr<entry_t[]> entries_;
+        size_t max_symbols_;
+        bool drop_stale_;
+        uint64_t gaps_ = 0;
+        uint64_t missing_ = 0;
+        uint64_t duplicates_ = 0;
+        uint64_t regressions_ = 0;
+        uint64_t dropped_ = 0;
+    };
+} // namespace core::faster_parser::binance::listeners
+
+#endif //FASTER_PARSER_SEQUENCE_CHECKER_H
@@ -0,0 +1,181 @@
+/**
+ * @file top_of_book.h
+ * @author Kevin Rodrigues
+ * @brief Latest best bid/ask per symbol in a flat seqlock-protected table
+ * @version 1.0
+ * @date 16/10/2026
+ */
+
+#ifndef FASTER_PARSER_TOP_OF_BOOK_H
+#define FASTER_PARSER_TOP_OF_BOOK_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string_view>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+#include "faster_parser/binance/symbol_registry.h"
+#include "faster_parser/binance/types/book_ticker.h"
+#include "faster_parser/binance/types/symbol.h"
+
+namespace core::faster_parser::binance::listeners {
+    // Consistent copy of one symbol's top of book
+    struct top_of_book_t {
+        double bid_price = 0.;
+        double bid_volume = 0.;
+        double ask_price = 0.;
+        double ask_volume = 0.;
+        uint64_t update_id = 0;                         // Order book update id (u)
+        uint64_t exchange_timestamp = 0;                // Exchange timestamp (E)
+        int64_t receive_time = 0;                       // Reception time, system_clock ticks
+    };
+
+    /**
+     * @brief BookTickerListener keeping the latest top of book of every symbol
+     * One cache line per symbol, indexed by the dense id the table assigns on first sight
+     * of a symbol: a sequence word followed by the entry. The parsing thread is the only
+     * writer; any number of threads read with snapshot(), which retries while an update of
+     * that symbol is in progress and never blocks the writer. An update whose update id is
+     * older than the stored one (replayed or reordered tickers) is ignored.
+     */
+    class top_of_book_table_t {
+    public:
+        explicit top_of_book_table_t(size_t max_symbols = symbol_registry_t::default_max_symbols)
+            : registry_(max_symbols),
+              entries_(std::make_unique<entry_t[]>(max_symbols)),
+              symbols_(std::make_unique<types::symbol_t[]>(max_symbols)) {}
+
+        top_of_book_table_t(top_of_book_table_t const &) = delete;
+        top_of_book_table_t &operator=(top_of_book_table_t const &) = delete;
+
+        // ====================================================================
+        // Writer (parsing thread)
+        // ====================================================================
+
+        __attribute__((always_inline)) void on_book_ticker(const types::book_ticker_t &ticker) {
+            const symbol_id_t id = intern(ticker.symbol);
+            if (id == invalid_symbol_id) [[unlikely]] {
+                ++dropped_;
+                return;
+            }
+
+            entry_t &entry = entries_[id];
+            const uint64_t sequence = entry.sequence.load(std::memory_order_relaxed);
+            if (sequence != 0 && ticker.bid.sequence < entry.data.update_id) [[unlikely]] {
+                ++stale_;
+                return;
+            }
+
+            entry.sequence.store(sequence + 1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+            entry.data.bid_price = ticker.bid.price;
+            entry.data.bid_volume = ticker.bid.volume;
+            entry.data.ask_price = ticker.ask.price;
+            entry.data.ask_volume = ticker.ask.volume;
+            entry.data.update_id = ticker.bid.sequence;
+            entry.data.exchange_timestamp = ticker.exchange_timestamp;
+            entry.data.receive_time = ticker.time.time_since_epoch().count();
+            entry.sequence.store(sequence + 2, std::memory_order_release);
+        }
+
+        /**
+         * @brief Id of a symbol, assigning one on first sight
+         * Writer thread only; readers that need ids before the symbol has traded can have
+         * them assigned here during setup, before the feed starts.
+         */
+        symbol_id_t intern(std::string_view symbol) {
+            const symbol_id_t id = registry_.intern(symbol);
+            if (id != invalid_symbol_id && id >= count_.load(std::memory_order_relaxed)) {
+                symbols_[id] = registry_.symbol(id);
+                count_.store(id + 1, std::memory_order_release);
+            }
+            return id;
+        }
+
+        // ====================================================================
+        // Readers (any thread)
+        // ====================================================================
+
+        // Id of a symbol the writer has already seen, or invalid_symbol_id
+        [[nodiscard]] symbol_id_t find(std::string_view symbol) const {
+            const types::symbol_t key = types::symbol_t::from(symbol);
+            const symbol_id_t count = count_.load(std::memory_order_acquire);
+            for (symbol_id_t id = 0; id < count; ++id) {
+                if (symbols_[id] == key) return id;
+            }
+            return invalid_symbol_id;
+        }
+
+        /**
+         * @brief Copy the top of book of `id`, consistent with a single update
+         * @return false if the id is unknown or no book ticker has arrived for it yet
+         */
+        __attribute__((always_inline)) bool snapshot(symbol_id_t id, top_of_book_t &out) const {
+            if (id >= count_.load(std::memory_order_acquire)) [[unlikely]] return false;
+            entry_t const &entry = entries_[id];
+            while (true) {
+                const uint64_t before = entry.sequence.load(std::memory_order_acquire);
+                if (before == 0) return false;
+                if (before & 1) [[unlikely]] {
+                    relax();
+                    continue;
+                }
+                std::memcpy(static_cast<void *>(&out), &entry.data, sizeof(top_of_book_t));
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (entry.sequence.load(std::memory_order_relaxed) == before) [[likely]] return true;
+            }
+        }
+
+        // Latest update id of `id` (0 if none), for cheap staleness checks without a full copy
+        [[nodiscard]] uint64_t update_id(symbol_id_t id) const {
+            top_of_book_t book;
+            return snapshot(id, book) ? book.update_id : 0;
+        }
+
+        // Number of updates applied to `id` so far; changes whenever the entry does
+        [[nodiscard]] uint64_t version(symbol_id_t id) const {
+            if (id >= count_.load(std::memory_order_acquire)) return 0;
+            return entries_[id].sequence.load(std::memory_order_acquire) / 2;
+        }
+
+        [[nodiscard]] types::symbol_t const &symbol(symbol_id_t id) const { return symbols_[id]; }
+        [[nodiscard]] size_t size() const { return count_.load(std::memory_order_acquire); }
+        [[nodiscard]] size_t max_symbols() const { return registry_.max_symbols(); }
+
+        // Writer-side counters: tickers beyond max_symbols, and out-of-order tickers ignored
+        [[nodiscard]] uint64_t dropped() const { return dropped_; }
+        [[nodiscard]] uint64_t stale() const { return stale_; }
+
+    private:
+        // Sequence word is odd while the writer updates the entry
+        struct alignas(64) entry_t {
+            std::atomic<uint64_t> sequence{0};
+            top_of_book_t data;
+        };
+
+        static_assert(sizeof(entry_t) == 64);
+
+        static __attribute__((always_inline)) void relax() {
+#if defined(__x86_64__) || defined(__i386__)
+            _mm_pause();
+#elif defined(__aarch64__)
+            asm volatile("yield");
+#endif
+        }
+
+        symbol_registry_t registry_;
+        std::unique_ptr<entry_t[]> entries_;
+        std::unique_ptr<types::symbol_t[]> symbols_;
+        std::atomic<symbol_id_t> count_{0};
+        uint64_t dropped_ = 0;
+        uint64_t stale_ = 0;
+    };
+} // namespace core::faster_parser::binance::listeners
+
+#endif //FASTER_PARSER_TOP_OF_BOOK_H
@@ -0,0 +1,213 @@
+/**
+ * @file trade_bars.h
+ * @author Kevin Rodrigues
+ * @brief Incremental time, volume and tick bars (OHLCV, VWAP, buy/sell volume) from aggregate trades
+ * @version 1.0
+ * @date 16/10/2026
+ */
+
+#ifndef FASTER_PARSER_TRADE_BARS_H
+#define FASTER_PARSER_TRADE_BARS_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <span>
+#include <utility>
+
+#include "faster_parser/binance/symbol_registry.h"
+#include "faster_parser/binance/types/symbol.h"
+#include "faster_parser/binance/types/trade.h"
+
+namespace core::faster_parser::binance::listeners {
+    enum class bar_kind_t : uint8_t {
+        time = 0,           // threshold: interval in ms, aligned on the epoch, by trade time (T)
+        volume = 1,         // threshold: base quantity; the trade reaching it closes the bar
+        tick = 2            // threshold: number of aggregate trades
+    };
+
+    struct bar_spec_t {
+        bar_kind_t kind = bar_kind_t::time;
+        double threshold = 60'000.;
+    };
+
+    struct trade_bar_t {
+        types::symbol_t symbol;
+        uint32_t spec = 0;                              // Index of the bar_spec_t that produced it
+        uint32_t trades = 0;                            // Aggregate trades in the bar
+        uint64_t open_time = 0;                         // Time bars: interval start; others: first trade time (ms)
+        uint64_t close_time = 0;                        // Time bars: interval end; others: last trade time (ms)
+        double open = 0.;
+        double high = 0.;
+        double low = 0.;
+        double close = 0.;
+        double volume = 0.;                             // Base quantity
+        double quote_volume = 0.;                       // Sum of price * quantity
+        double buy_volume = 0.;                         // Taker buys (is_buyer_maker false)
+        double sell_volume = 0.;                        // Taker sells (is_buyer_maker true)
+        uint64_t first_agg_trade_id = 0;
+        uint64_t last_agg_trade_id = 0;
+
+        [[nodiscard]] double vwap() const { return volume > 0. ? quote_volume / volume : 0.; }
+    };
+
+    /**
+     * @brief TradeListener building bars for every symbol and every bar_spec_t at once
+     * State is one trade_bar_t per (symbol, spec) in a flat array indexed by interned symbol
+     * id, so a trade updates a few doubles in place and never allocates. Completed bars are
+     * passed to callback(trade_bar_t const &). Time bars close when a trade of a later
+     * interval arrives (intervals without trades produce no bar), or on close_expired() for
+     * callers that want bars on time without waiting for the next trade; flush() emits every
+     * open bar, e.g. at the end of a replay. Thresholds are clamped on construction: time
+     * intervals to whole milliseconds of at least 1, tick counts to at least 1 and volumes
+     * (including 0, negative or NaN) to a positive value, so spec() may differ from the input.
+     */
+    template<typename callback_t>
+    class trade_bar_aggregator_t {
+    public:
+        trade_bar_aggregator_t(std::span<const bar_spec_t> specs, callback_t callback,
+                               size_t max_symbols = symbol_registry_t::default_max_symbols)
+            : callback_(std::move(callback)), registry_(max_symbols), spec_count_(specs.size()),
+              specs_(std::make_unique<bar_spec_t[]>(specs.size())),
+              bars_(std::make_unique<trade_bar_t[]>(max_symbols * specs.size())) {
+            std::transform(specs.begin(), specs.end(), specs_.get(), clamp);
+        }
+
+        trade_bar_aggregator_t(trade_bar_aggregator_t const &) = delete;
+        trade_bar_aggregator_t &operator=(trade_bar_aggregator_t const &) = delete;
+
+        __attribute__((always_inline)) void on_trade(const types::trade_t &trade) {
+            const symbol_id_t id = registry_.intern(trade.symbol);
+            if (id == invalid_symbol_id) [[unlikely]] {
+                ++dropped_;
+                return;
+            }
+
+            trade_bar_t *bars = &bars_[id * spec_count_];
+            const double notional = trade.price * trade.quantity;
+            for (size_t s = 0; s < spec_count_; ++s) {
+                bar_spec_t const &spec = specs_[s];
+                trade_bar_t &bar = bars[s];
+
+                if (spec.kind == bar_kind_t::time && bar.trades != 0 && trade.trade_time >= bar.close_time) [[unlikely]] {
+                    emit(bar);
+                }
+                if (bar.trades == 0) [[unlikely]] {
+                    open(bar, id, static_cast<uint32_t>(s), spec, trade);
+                }
+
+                bar.high = std::max(bar.high, trade.price);
+                bar.low = std::min(bar.low, trade.price);
+                bar.close = trade.price;
+                bar.volume += trade.quantity;
+                bar.quote_volume += notional;
+                (trade.is_buyer_maker ? bar.sell_volume : bar.buy_volume) += trade.quantity;
+                bar.last_agg_trade_id = trade.agg_trade_id;
+                ++bar.trades;
+
+                if (spec.kind != bar_kind_t::time) {
+                    bar.close_time = trade.trade_time;
+                    const double progress = spec.kind == bar_kind_t::volume ? bar.volume : static_cast<double>(bar.trades);
+                    if (progress >= spec.threshold) [[unlikely]] emit(bar);
+                }
+            }
+        }
+
+        // Emit the time bars whose interval ended at or before `time_ms`; returns how many
+        size_t close_expired(uint64_t time_ms) {
+            size_t emitted = 0;
+            for_each_open([&](trade_bar_t &bar) {
+                if (specs_[bar.spec].kind == bar_kind_t::time && bar.close_time <= time_ms) {
+                    emit(bar);
+                    ++emitted;
+                }
+            });
+            return emitted;
+        }
+
+        // Emit every open bar, complete or not; returns how many
+        size_t flush() {
+            size_t emitted = 0;
+            for_each_open([&](trade_bar_t &bar) {
+                emit(bar);
+                ++emitted;
+            });
+            return emitted;
+        }
+
+        // Open (incomplete) bar of a symbol for a spec, or nullptr if none
+        [[nodiscard]] trade_bar_t const *current(std::string_view symbol, size_t spec) const {
+            const symbol_id_t id = registry_.find(symbol);
+            if (id == invalid_symbol_id) return nullptr;
+            trade_bar_t const &bar = bars_[id * spec_count_ + spec];
+            return bar.trades ? &bar : nullptr;
+        }
+
+        [[nodiscard]] bar_spec_t const &spec(size_t index) const { return specs_[index]; }
+        [[nodiscard]] uint64_t emitted() const { return emitted_; }
+        [[nodiscard]] uint64_t dropped() const { return dropped_; }          // Trades beyond max_symbols
+        [[nodiscard]] callback_t &callback() { return callback_; }
+
+    private:
+        // Smallest valid threshold for out-of-range ones: an interval of 0 ms would divide by zero
+        // in open(), and a NaN threshold would never close a bar
+        static bar_spec_t clamp(bar_spec_t spec) {
+            constexpr double max_interval = 1ULL << 62;
+            switch (spec.kind) {
+                case bar_kind_t::time:
+                    spec.threshold = spec.threshold >= 1. ? std::floor(std::min(spec.threshold, max_interval)) : 1.;
+                    break;
+                case bar_kind_t::tick:
+                    spec.threshold = spec.threshold >= 1. ? spec.threshold : 1.;
+                    break;
+                case bar_kind_t::volume:
+                    spec.threshold = spec.threshold > 0. ? spec.threshold : std::numeric_limits<double>::min();
+                    break;
+            }
+            return spec;
+        }
+
+        __attribute__((always_inline)) void open(trade_bar_t &bar, symbol_id_t id, uint32_t spec_index, bar_spec_t const &spec,
+                                                 const types::trade_t &trade) {
+            bar.symbol = registry_.symbol(id);
+            bar.spec = spec_index;
+            if (spec.kind == bar_kind_t::time) {
+                const auto interval = static_cast<uint64_t>(spec.threshold);
+                bar.open_time = trade.trade_time - trade.trade_time % interval;
+                bar.close_time = bar.open_time + interval;
+            } else {
+                bar.open_time = trade.trade_time;
+            }
+            bar.open = bar.high = bar.low = trade.price;
+            bar.first_agg_trade_id = trade.agg_trade_id;
+        }
+
+        void emit(trade_bar_t &bar) {
+            callback_(static_cast<trade_bar_t const &>(bar));
+            ++emitted_;
+            bar.trades = 0;
+            bar.volume = bar.quote_volume = bar.buy_volume = bar.sell_volume = 0.;
+        }
+
+        template<typename fn_t>
+        void for_each_open(fn_t &&fn) {
+            const size_t count = registry_.size() * spec_count_;
+            for (size_t i = 0; i < count; ++i) {
+                if (bars_[i].trades) fn(bars_[i]);
+            }
+        }
+
+        callback_t callback_;
+        symbol_registry_t registry_;
+        size_t spec_count_;
+        std::unique_ptr<bar_spec_t[]> specs_;
+        std::unique_ptr<trade_bar_t[]> bars_;
+        uint64_t emitted_ = 0;
+        uint64_t dropped_ = 0;
+    };
+} // namespace core::faster_parser::binance::listeners
+
+#endif //FASTER_PARSER_TRADE_BARS_H
@@ -0,0 +1,123 @@
+/**
+ * @file trade_columns.h
+ * @author Kevin Rodrigues
+ * @brief Structure-of-arrays sink collecting aggregate trades into arena-backed columns
+ * @version 1.0
+ * @date 16/10/2026
+ */
+
+#ifndef FASTER_PARSER_TRADE_COLUMNS_H
+#define FASTER_PARSER_TRADE_COLUMNS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include "faster_parser/binance/concepts.h"
+#include "faster_parser/binance/symbol_registry.h"
+#include "faster_parser/binance/types/trade.h"
+#include "faster_parser/core/arena.h"
+
+namespace core::faster_parser::binance::listeners {
+    /**
+     * @brief BinanceFutureListener appending every aggTrade field to its own contiguous column
+     * Symbols are interned into dense ids (see symbol_registry()). Column storage comes from
+     * an arena that is kept across clear() calls, so after a reserve() sized for a whole
+     * capture file, parsing it performs no per-event allocation. Only aggTrade is handled:
+     * the parser rejects every other message type after its prefix check.
+     */
+    class trade_columns_t {
+    public:
+        explicit trade_columns_t(size_t capacity_hint = 0, size_t max_symbols = symbol_registry_t::default_max_symbols)
+            : registry_(max_symbols),
+              price_(arena_), quantity_(arena_), agg_trade_id_(arena_), first_trade_id_(arena_),
+              last_trade_id_(arena_), event_time_(arena_), trade_time_(arena_), is_buyer_maker_(arena_),
+              symbol_id_(arena_) {
+            reserve(capacity_hint);
+        }
+
+        trade_columns_t(trade_columns_t const &) = delete;
+        trade_columns_t &operator=(trade_columns_t const &) = delete;
+
+        __attribute__((always_inline)) void on_trade(const types::trade_t &trade) {
+            price_.push_back(trade.price);
+            quantity_.push_back(trade.quantity);
+            agg_trade_id_.push_back(trade.agg_trade_id);
+            first_trade_id_.push_back(trade.first_trade_id);
+            last_trade_id_.push_back(trade.last_trade_id);
+            event_time_.push_back(trade.event_time);
+            trade_time_.push_back(trade.trade_time);
+            is_buyer_maker_.push_back(trade.is_buyer_maker);
+            symbol_id_.push_back(registry_.intern(trade.symbol));
+        }
+
+        // Capacity hint: make the next `count` trades fit without growing any column
+        void reserve(size_t count) {
+            if (count == 0) return;
+            price_.reserve(count);
+            quantity_.reserve(count);
+            agg_trade_id_.reserve(count);
+            first_trade_id_.reserve(count);
+            last_trade_id_.reserve(count);
+            event_time_.reserve(count);
+            trade_time_.reserve(count);
+            is_buyer_maker_.reserve(count);
+            symbol_id_.reserve(count);
+        }
+
+        // Drop the rows but keep the arena memory (and the symbol ids) for the next file
+        void clear() {
+            size_t capacity = price_.capacity();
+            arena_.reset();
+            for_each_column([](auto &column) { column.release(); });
+            reserve(capacity);
+        }
+
+        [[nodiscard]] size_t size() const { return price_.size(); }
+        [[nodiscard]] bool empty() const { return price_.empty(); }
+
+        [[nodiscard]] std::span<const double> price() const { return price_.span(); }
+        [[nodiscard]] std::span<const double> quantity() const { return quantity_.span(); }
+        [[nodiscard]] std::span<const uint64_t> agg_trade_id() const { return agg_trade_id_.span(); }
+        [[nodiscard]] std::span<const uint64_t> first_trade_id() const { return first_trade_id_.span(); }
+        [[nodiscard]] std::span<const uint64_t> last_trade_id() const { return last_trade_id_.span(); }
+        [[nodiscard]] std::span<const uint64_t> event_time() const { return event_time_.span(); }
+        [[nodiscard]] std::span<const uint64_t> trade_time() const { return trade_time_.span(); }
+        [[nodiscard]] std::span<const uint8_t> is_buyer_maker() const { return is_buyer_maker_.span(); }
+        [[nodiscard]] std::span<const symbol_id_t> symbol_id() const { return symbol_id_.span(); }
+
+        [[nodiscard]] symbol_registry_t const &symbol_registry() const { return registry_; }
+
+    private:
+        template<typename fn_t>
+        void for_each_column(fn_t &&fn) {
+            fn(price_);
+            fn(quantity_);
+            fn(agg_trade_id_);
+            fn(first_trade_id_);
+            fn(last_trade_id_);
+            fn(event_time_);
+            fn(trade_time_);
+            fn(is_buyer_maker_);
+            fn(symbol_id_);
+        }
+
+        arena_t arena_;
+        symbol_registry_t registry_;
+        arena_column_t<double> price_;
+        arena_column_t<double> quantity_;
+        arena_column_t<uint64_t> agg_trade_id_;
+        arena_column_t<uint64_t> first_trade_id_;
+        arena_column_t<uint64_t> last_trade_id_;
+        arena_column_t<uint64_t> event_time_;
+        arena_column_t<uint64_t> trade_time_;
+        arena_column_t<uint8_t> is_buyer_maker_;
+        arena_column_t<symbol_id_t> symbol_id_;
+    };
+
+    static_assert(TradeListener<trade_columns_t>);
+    static_assert(!BookTickerListener<trade_columns_t>);
+    static_assert(!TickerListener<trade_columns_t>);
+} // namespace core::faster_parser::binance::listeners
+
+#endif //FASTER_PARSER_TRADE_COLUMNS_H
@@ -62,6 +62,34 @@ namespace core::faster_parser::binance::neon {
         return nullptr;
     }
 
+    // find_char() that gives up at the end of the line: nullptr if a '\n' comes first, so a
+    // truncated record of a newline-delimited stream cannot run into the next record
+    __attribute__((always_inline)) inline const char *find_char_in_line(const char *ptr, const char *end, char target) {
+        uint8x16_t target_vec = vdupq_n_u8(target);
+        uint8x16_t newline_vec = vdupq_n_u8('\n');
+
+        while (ptr + 16 <= end) {
+            uint8x16_t data = vld1q_u8(reinterpret_cast<const uint8_t*>(ptr));
+            uint8x16_t cmp = vorrq_u8(vceqq_u8(data, target_vec), vceqq_u8(data, newline_vec));
+
+            uint64x2_t cmp_u64 = vreinterpretq_u64_u8(cmp);
+            if ((vgetq_lane_u64(cmp_u64, 0) | vgetq_lane_u64(cmp_u64, 1)) != 0) {
+                for (int i = 0; i < 16; i++) {
+                    if (ptr[i] == target) return &ptr[i];
+                    if (ptr[i] == '\n') return nullptr;
+                }
+            }
+            ptr += 16;
+        }
+
+        while (ptr < end) {
+            if (*ptr == target) return ptr;
+            if (*ptr == '\n') return nullptr;
+            ptr++;
+        }
+        return nullptr;
+    }
+
     // Find first occurrence of any character in a set (up to 4 characters)
     // Returns pointer to the found character and sets which_char to indicate which one was found (0-3)
     __attribute__((always_inline)) inline const char *find_char_set(const char *ptr, const char *end, const char *targets, size_t num_targets, int &which_char) {
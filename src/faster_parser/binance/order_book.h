@@ -0,0 +1,300 @@
+/**
+ * @file order_book.h
+ * @author Kevin Rodrigues
+ * @brief L2 order book on sorted flat arrays, synchronised from a depth snapshot and diff updates
+ * @version 1.0
+ * @date 16/10/2026
+ */
+
+#ifndef FASTER_PARSER_ORDER_BOOK_H
+#define FASTER_PARSER_ORDER_BOOK_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "faster_parser/binance/types/depth.h"
+
+namespace core::faster_parser::binance {
+    enum class book_side_t : uint8_t {
+        bid = 0,
+        ask = 1
+    };
+
+    enum class book_status_t : uint8_t {
+        applied = 0,        // Applied to the synchronised book
+        buffered = 1,       // Kept until the next snapshot
+        stale = 2,          // Older than the book, ignored
+        gap = 3             // Sequence break: the book was cleared and needs a new snapshot
+    };
+
+    struct book_level_t {
+        int64_t price = 0;                              // Price in ticks
+        double quantity = 0.;
+    };
+
+    struct vwap_t {
+        double price = 0.;                              // Volume-weighted average price, 0 if nothing filled
+        double filled = 0.;                             // Quantity available up to the requested size
+    };
+
+    /**
+     * @brief One symbol's L2 book, fed by parsed depth updates (DepthListener)
+     * Prices are integer ticks. Each side is a flat array sorted so that the best level is
+     * at the back: bids ascending, asks descending. Diff updates cluster around the top of
+     * the book, so inserting or erasing a level moves only the few levels above it, and
+     * top-N and VWAP walks read contiguous memory.
+     *
+     * Synchronisation follows the Binance Futures procedure: updates are buffered until
+     * apply_snapshot(); buffered updates older than the snapshot are dropped, the first one
+     * applied must satisfy U <= lastUpdateId <= u, and every later one must have pu equal to
+     * the previous update's u. A break clears the book and buffers again until the next
+     * snapshot (see synced()).
+     */
+    class order_book_t {
+    public:
+        explicit order_book_t(double tick_size, size_t depth_hint = 1024)
+            : tick_size_(tick_size), inverse_tick_(1. / tick_size) {
+            bids_.reserve(depth_hint);
+            asks_.reserve(depth_hint);
+        }
+
+        // ====================================================================
+        // Feed
+        // ====================================================================
+
+        __attribute__((always_inline)) void on_depth_update(const types::depth_update_t &update) {
+            apply(update);
+        }
+
+        book_status_t apply(const types::depth_update_t &update) {
+            if (!synced_) {
+                buffer(update);
+                return book_status_t::buffered;
+            }
+
+            if (update.final_update_id < last_update_id_) [[unlikely]] {
+                return book_status_t::stale;
+            }
+            const bool bridges = bridge_pending_
+                ? update.first_update_id <= last_update_id_
+                : update.previous_update_id == last_update_id_;
+            if (!bridges) [[unlikely]] {
+                if (!bridge_pending_ && update.final_update_id <= last_update_id_) return book_status_t::stale;
+                ++gaps_;
+                desync();
+                buffer(update);
+                return book_status_t::gap;
+            }
+
+            apply_levels(update.bids, update.asks);
+            last_update_id_ = update.final_update_id;
+            bridge_pending_ = false;
+            ++updates_;
+            return book_status_t::applied;
+        }
+
+        /**
+         * @brief Load a REST snapshot and replay the updates buffered since the stream started
+         * @return true if the book is synchronised. false if the buffered updates do not
+         * connect to the snapshot (it is older than the first buffered update, or updates
+         * are missing): fetch a newer snapshot and call again.
+         */
+        bool apply_snapshot(const types::depth_snapshot_t &snapshot) {
+            bids_.clear();
+            asks_.clear();
+            snapshot.bids.for_each([&](types::depth_level_t const &level) {
+                if (level.quantity != 0.) bids_.push_back({to_ticks(level.price), level.quantity});
+            });
+            snapshot.asks.for_each([&](types::depth_level_t const &level) {
+                if (level.quantity != 0.) asks_.push_back({to_ticks(level.price), level.quantity});
+            });
+            std::sort(bids_.begin(), bids_.end(), [](auto const &a, auto const &b) { return a.price < b.price; });
+            std::sort(asks_.begin(), asks_.end(), [](auto const &a, auto const &b) { return a.price > b.price; });
+
+            last_update_id_ = snapshot.last_update_id;
+            synced_ = true;
+            bridge_pending_ = true;
+
+            for (pending_t const &pending : pending_) {
+                if (pending.final_update_id < last_update_id_) continue;
+                const bool bridges = bridge_pending_
+                    ? pending.first_update_id <= last_update_id_
+                    : pending.previous_update_id == last_update_id_;
+                if (!bridges) {
+                    ++gaps_;
+                    bids_.clear();
+                    asks_.clear();
+                    synced_ = false;
+                    return false;
+                }
+                for (size_t i = 0; i < pending.bid_count; ++i) {
+                    update_level<true>(bids_, pending_levels_[pending.offset + i]);
+                }
+                for (size_t i = 0; i < pending.ask_count; ++i) {
+                    update_level<false>(asks_, pending_levels_[pending.offset + pending.bid_count + i]);
+                }
+                last_update_id_ = pending.final_update_id;
+                bridge_pending_ = false;
+                ++updates_;
+            }
+
+            pending_.clear();
+            pending_levels_.clear();
+            return true;
+        }
+
+        // Drop the book and buffer updates until the next snapshot
+        void desync() {
+            bids_.clear();
+            asks_.clear();
+            synced_ = false;
+            bridge_pending_ = false;
+        }
+
+        // ====================================================================
+        // Queries
+        // ====================================================================
+
+        [[nodiscard]] __attribute__((always_inline)) int64_t to_ticks(double price) const {
+            return std::llround(price * inverse_tick_);
+        }
+
+        [[nodiscard]] __attribute__((always_inline)) double to_price(int64_t ticks) const {
+            return static_cast<double>(ticks) * tick_size_;
+        }
+
+        // Best level of a side; quantity 0 when the side is empty
+        [[nodiscard]] book_level_t best(book_side_t side) const {
+            auto const &levels = side == book_side_t::bid ? bids_ : asks_;
+            return levels.empty() ? book_level_t{} : levels.back();
+        }
+
+        [[nodiscard]] book_level_t best_bid() const { return best(book_side_t::bid); }
+        [[nodiscard]] book_level_t best_ask() const { return best(book_side_t::ask); }
+
+        // Copy the best out.size() levels of a side, best first; returns how many were copied
+        size_t top(book_side_t side, std::span<book_level_t> out) const {
+            auto const &levels = side == book_side_t::bid ? bids_ : asks_;
+            const size_t count = std::min(out.size(), levels.size());
+            std::copy_n(levels.rbegin(), count, out.begin());
+            return count;
+        }
+
+        /**
+         * @brief Average price of taking `size` from a side (asks for a buy, bids for a sell)
+         * When the side holds less than `size`, the result covers what is there (see filled).
+         */
+        [[nodiscard]] vwap_t vwap_to_size(book_side_t side, double size) const {
+            auto const &levels = side == book_side_t::bid ? bids_ : asks_;
+            double notional = 0.;
+            double filled = 0.;
+            for (auto it = levels.rbegin(); it != levels.rend() && filled < size; ++it) {
+                const double take = std::min(it->quantity, size - filled);
+                notional += take * static_cast<double>(it->price);
+                filled += take;
+            }
+            return filled > 0. ? vwap_t{notional / filled * tick_size_, filled} : vwap_t{};
+        }
+
+        // Quantity resting at a price, 0 if the level is empty
+        [[nodiscard]] double quantity_at(book_side_t side, int64_t price) const {
+            if (side == book_side_t::bid) {
+                auto it = std::lower_bound(bids_.begin(), bids_.end(), price, [](auto const &l, int64_t p) { return l.price < p; });
+                return it != bids_.end() && it->price == price ? it->quantity : 0.;
+            }
+            auto it = std::lower_bound(asks_.begin(), asks_.end(), price, [](auto const &l, int64_t p) { return l.price > p; });
+            return it != asks_.end() && it->price == price ? it->quantity : 0.;
+        }
+
+        [[nodiscard]] size_t depth(book_side_t side) const { return side == book_side_t::bid ? bids_.size() : asks_.size(); }
+        [[nodiscard]] bool synced() const { return synced_; }
+        [[nodiscard]] uint64_t last_update_id() const { return last_update_id_; }
+        [[nodiscard]] size_t buffered() const { return pending_.size(); }
+        [[nodiscard]] double tick_size() const { return tick_size_; }
+
+        // Updates applied, and sequence breaks detected, since construction
+        [[nodiscard]] uint64_t updates() const { return updates_; }
+        [[nodiscard]] uint64_t gaps() const { return gaps_; }
+
+    private:
+        static constexpr size_t top_probe = 8;          // Levels scanned linearly before binary search
+
+        // Buffered update; its levels live in pending_levels_ (bids, then asks) so buffering
+        // reuses two vectors instead of allocating per update
+        struct pending_t {
+            uint64_t first_update_id;
+            uint64_t final_update_id;
+            uint64_t previous_update_id;
+            size_t offset;
+            size_t bid_count;
+            size_t ask_count;
+        };
+
+        void buffer(const types::depth_update_t &update) {
+            pending_t pending{update.first_update_id, update.final_update_id, update.previous_update_id,
+                              pending_levels_.size(), 0, 0};
+            update.bids.for_each([&](types::depth_level_t const &level) {
+                pending_levels_.push_back({to_ticks(level.price), level.quantity});
+                ++pending.bid_count;
+            });
+            update.asks.for_each([&](types::depth_level_t const &level) {
+                pending_levels_.push_back({to_ticks(level.price), level.quantity});
+                ++pending.ask_count;
+            });
+            pending_.push_back(pending);
+        }
+
+        __attribute__((always_inline)) void apply_levels(types::depth_levels_t const &bids, types::depth_levels_t const &asks) {
+            bids.for_each([this](types::depth_level_t const &level) {
+                update_level<true>(bids_, {to_ticks(level.price), level.quantity});
+            });
+            asks.for_each([this](types::depth_level_t const &level) {
+                update_level<false>(asks_, {to_ticks(level.price), level.quantity});
+            });
+        }
+
+        // Sorted ascending (bids) or descending (asks); quantity 0 removes the level
+        template<bool ascending>
+        static __attribute__((always_inline)) void update_level(std::vector<book_level_t> &levels, book_level_t level) {
+            auto below = [](book_level_t const &l, int64_t p) { return ascending ? l.price < p : l.price > p; };
+
+            // Most updates land within a few levels of the top: probe those linearly from the
+            // back (predictable branches, same cache lines) before binary searching the rest
+            auto it = levels.end();
+            const auto probe_end = levels.size() > top_probe ? levels.end() - top_probe : levels.begin();
+            while (it != probe_end && !below(*(it - 1), level.price)) --it;
+            if (it == probe_end && it != levels.begin() && !below(*(it - 1), level.price)) {
+                it = std::lower_bound(levels.begin(), it, level.price, below);
+            }
+            if (it != levels.end() && it->price == level.price) {
+                if (level.quantity == 0.) {
+                    levels.erase(it);
+                } else {
+                    it->quantity = level.quantity;
+                }
+            } else if (level.quantity != 0.) {
+                levels.insert(it, level);
+            }
+        }
+
+        double tick_size_;
+        double inverse_tick_;
+        std::vector<book_level_t> bids_;
+        std::vector<book_level_t> asks_;
+
+        std::vector<pending_t> pending_;
+        std::vector<book_level_t> pending_levels_;
+
+        uint64_t last_update_id_ = 0;
+        bool synced_ = false;
+        bool bridge_pending_ = false;       // Next update must straddle the snapshot's lastUpdateId
+        uint64_t updates_ = 0;
+        uint64_t gaps_ = 0;
+    };
+} // namespace core::faster_parser::binance
+
+#endif //FASTER_PARSER_ORDER_BOOK_H
@@ -0,0 +1,194 @@
+/**
+ * @file replay.h
+ * @author Kevin Rodrigues
+ * @brief Multi-core replay of newline-delimited capture files
+ * @version 1.0
+ * @date 16/10/2026
+ */
+
+#ifndef FASTER_PARSER_REPLAY_H
+#define FASTER_PARSER_REPLAY_H
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <queue>
+#include <span>
+#include <string_view>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <variant>
+#include <vector>
+
+#include "faster_parser/binance/future.h"
+
+namespace core::faster_parser::binance {
+    /**
+     * @brief Split a buffer into `count` chunks of roughly equal size, each ending on a newline
+     * Concatenating the chunks gives back the buffer. Fewer chunks are returned when the
+     * buffer has fewer lines than requested chunks.
+     */
+    inline std::vector<std::string_view> split_lines(std::string_view buffer, size_t count) {
+        std::vector<std::string_view> chunks;
+        if (buffer.empty() || count == 0) return chunks;
+        chunks.reserve(count);
+
+        const char *ptr = buffer.data();
+        const char *const end = buffer.data() + buffer.size();
+        const size_t target = (buffer.size() + count - 1) / count;
+
+        while (ptr < end) {
+            const char *cut = end;
+            if (static_cast<size_t>(end - ptr) > target && chunks.size() + 1 < count) {
+                cut = impl::find_char(ptr + target, end, '\n');
+                cut = cut ? cut + 1 : end;
+            }
+            chunks.emplace_back(ptr, static_cast<size_t>(cut - ptr));
+            ptr = cut;
+        }
+        return chunks;
+    }
+
+    /**
+     * @brief Parse a capture buffer on several threads, one listener per thread
+     * The buffer is split into listeners.size() newline-aligned chunks and chunk i is parsed
+     * with parse_stream into listeners[i] on its own thread (chunk 0 on the calling thread).
+     * Events therefore reach each listener in file order, but listeners see disjoint parts of
+     * the file: merge their results afterwards, or use replay_ordered().
+     * @return Number of bytes consumed; less than buffer.size() if the file ends with an
+     * incomplete message.
+     */
+    template<BinanceFutureListener listener_t>
+    size_t replay_parallel(std::string_view buffer, std::span<listener_t> listeners,
+                           std::chrono::system_clock::time_point now = std::chrono::system_clock::now()) {
+        std::vector<std::string_view> chunks = split_lines(buffer, listeners.size());
+        std::vector<size_t> consumed(chunks.size(), 0);
+
+        {
+            std::vector<std::jthread> workers;
+            workers.reserve(chunks.size());
+            for (size_t i = 1; i < chunks.size(); ++i) {
+                workers.emplace_back([&, i] {
+                    consumed[i] = binance_future_parser_t::parse_stream(now, chunks[i], listeners[i]);
+                });
+            }
+            if (!chunks.empty()) {
+                consumed[0] = binance_future_parser_t::parse_stream(now, chunks[0], listeners[0]);
+            }
+        }
+
+        size_t total = 0;
+        for (size_t i = 0; i < chunks.size(); ++i) {
+            total += consumed[i];
+            // Only the last chunk can end with an incomplete message
+            if (consumed[i] != chunks[i].size()) break;
+        }
+        return total;
+    }
+
+    namespace replay_detail {
+        using owned_event_t = std::variant<types::book_ticker_owned_t, types::trade_owned_t, types::ticker_owned_t>;
+
+        inline uint64_t timestamp(owned_event_t const &event) {
+            switch (event.index()) {
+                case 0: return std::get<0>(event).exchange_timestamp;
+                case 1: return std::get<1>(event).event_time;
+                default: return std::get<2>(event).event_time;
+            }
+        }
+
+        // Collects owned copies of the event types the target listener handles
+        template<typename target_t>
+        struct collector_t {
+            std::vector<owned_event_t> events;
+
+            void on_book_ticker(const types::book_ticker_t &ticker) requires BookTickerListener<target_t> {
+                events.emplace_back(std::in_place_index<0>, ticker);
+            }
+
+            void on_trade(const types::trade_t &trade) requires TradeListener<target_t> {
+                events.emplace_back(std::in_place_index<1>, trade);
+            }
+
+            void on_ticker(const types::ticker_t &ticker) requires TickerListener<target_t> {
+                events.emplace_back(std::in_place_index<2>, ticker);
+            }
+        };
+    } // namespace replay_detail
+
+    /**
+     * @brief Parse a capture buffer on `threads` threads and deliver every event to one listener
+     * in exchange time order (exchange_timestamp for book tickers, event_time otherwise).
+     * Each worker copies its chunk's events into owned events and stable-sorts them; the sorted
+     * runs are then k-way merged on the calling thread. Events with equal timestamps keep their
+     * file order. Memory use is proportional to the number of events in the file.
+     * @return Number of bytes consumed, as replay_parallel().
+     */
+    template<BinanceFutureListener listener_t>
+    size_t replay_ordered(std::string_view buffer, size_t threads, listener_t &listener,
+                          std::chrono::system_clock::time_point now = std::chrono::system_clock::now()) {
+        using collector_t = replay_detail::collector_t<listener_t>;
+        std::vector<std::string_view> chunks = split_lines(buffer, std::max<size_t>(threads, 1));
+        std::vector<collector_t> collectors(chunks.size());
+        std::vector<size_t> consumed(chunks.size(), 0);
+
+        auto work = [&](size_t i) {
+            consumed[i] = binance_future_parser_t::parse_stream(now, chunks[i], collectors[i]);
+            std::stable_sort(collectors[i].events.begin(), collectors[i].events.end(),
+                             [](auto const &lhs, auto const &rhs) {
+                                 return replay_detail::timestamp(lhs) < replay_detail::timestamp(rhs);
+                             });
+        };
+
+        {
+            std::vector<std::jthread> workers;
+            workers.reserve(chunks.size());
+            for (size_t i = 1; i < chunks.size(); ++i) {
+                workers.emplace_back(work, i);
+            }
+            if (!chunks.empty()) work(0);
+        }
+
+        // Heap entries: (timestamp, chunk, position). Ties resolve to the earlier chunk.
+        using entry_t = std::tuple<uint64_t, size_t, size_t>;
+        std::priority_queue<entry_t, std::vector<entry_t>, std::greater<>> heap;
+        for (size_t i = 0; i < collectors.size(); ++i) {
+            if (!collectors[i].events.empty()) {
+                heap.emplace(replay_detail::timestamp(collectors[i].events[0]), i, 0);
+            }
+        }
+
+        while (!heap.empty()) {
+            auto [ts, chunk, position] = heap.top();
+            heap.pop();
+
+            auto const &events = collectors[chunk].events;
+            std::visit([&](auto const &event) {
+                using owned_t = std::decay_t<decltype(event)>;
+                if constexpr (std::is_same_v<owned_t, types::book_ticker_owned_t>) {
+                    if constexpr (BookTickerListener<listener_t>) listener.on_book_ticker(event.view());
+                } else if constexpr (std::is_same_v<owned_t, types::trade_owned_t>) {
+                    if constexpr (TradeListener<listener_t>) listener.on_trade(event.view());
+                } else {
+                    if constexpr (TickerListener<listener_t>) listener.on_ticker(event.view());
+                }
+            }, events[position]);
+
+            if (position + 1 < events.size()) {
+                heap.emplace(replay_detail::timestamp(events[position + 1]), chunk, position + 1);
+            }
+        }
+
+        size_t total = 0;
+        for (size_t i = 0; i < chunks.size(); ++i) {
+            total += consumed[i];
+            if (consumed[i] != chunks[i].size()) break;
+        }
+        return total;
+    }
+} // namespace core::faster_parser::binance
+
+#endif //FASTER_PARSER_REPLAY_H
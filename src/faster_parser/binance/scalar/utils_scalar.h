@@ -25,6 +25,17 @@ namespace core::faster_parser::binance::scalar {
         return nullptr;
     }
 
+    // find_char() that gives up at the end of the line: nullptr if a '\n' comes first, so a
+    // truncated record of a newline-delimited stream cannot run into the next record
+    __attribute__((always_inline)) inline const char* find_char_in_line(const char* ptr, const char* end, char target) {
+        while (ptr < end) {
+            if (*ptr == target) return ptr;
+            if (*ptr == '\n') return nullptr;
+            ptr++;
+        }
+        return nullptr;
+    }
+
     // Find first occurrence of any character in a set (up to 4 characters)
     // Returns pointer to the found character and sets which_char to indicate which one was found (0-3)
     __attribute__((always_inline)) inline const char *find_char_set(const char *ptr, const char *end, const char *targets, size_t num_targets, int &which_char) {
@@ -0,0 +1,309 @@
+/**
+ * @file sharded.h
+ * @author Kevin Rodrigues
+ * @brief Routes raw messages to worker cores by symbol; the workers run the full parse
+ * @version 1.0
+ * @date 16/10/2026
+ */
+
+#ifndef FASTER_PARSER_BINANCE_SHARDED_H
+#define FASTER_PARSER_BINANCE_SHARDED_H
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <pthread.h>
+#include <sched.h>
+
+#include "faster_parser/binance/future.h"
+#include "faster_parser/binance/types/symbol.h"
+#include "faster_parser/core/spsc_ring.h"
+
+namespace core::faster_parser::binance {
+    /**
+     * @brief Find the value of the "s" (symbol) field without parsing the message
+     * @return The symbol, or an empty view if the message has no complete "s" field
+     */
+    __attribute__((always_inline)) inline std::string_view peek_symbol(const char *ptr, const char *end) {
+        const char *begin = ptr;
+        while ((ptr = impl::find_char(ptr, end, 's')) != nullptr) {
+            if (ptr > begin && end - ptr > 4 && ptr[-1] == '"' && ptr[1] == '"' && ptr[2] == ':' && ptr[3] == '"') {
+                const char *value = ptr + 4;
+                const char *close = impl::find_char(value, end, '"');
+                if (!close) return {};
+                return {value, static_cast<size_t>(close - value)};
+            }
+            ptr++;
+        }
+        return {};
+    }
+
+    /**
+     * @brief One chunk of a raw message in flight to a worker: reception time, length and bytes
+     * Eight cache lines. A message longer than max_size (a depth update with many levels) spans
+     * consecutive slots: the first carries its reception time and total size, the following
+     * ones the next max_size bytes each, and the worker reassembles it before parsing.
+     */
+    struct alignas(64) frame_slot_t {
+        static constexpr size_t max_size = 512 - 16;
+
+        int64_t receive_time;                           // system_clock ticks, first slot only
+        uint32_t size;                                  // Whole message, first slot only
+        char data[max_size];
+    };
+
+    static_assert(sizeof(frame_slot_t) == 512);
+
+    struct sharded_pipeline_options_t {
+        size_t queue_capacity = 4096;           // Slots per worker queue
+        size_t batch_size = 16;                 // Messages per publish; route_stream() and flush() publish the rest
+        std::vector<int> worker_cores;          // Optional: pin worker i to worker_cores[i]
+    };
+
+    /**
+     * @brief Symbol-sharded parsing pipeline: one routing thread, one worker thread per listener
+     * The routing thread (the caller of route()/route_stream()) only locates message boundaries
+     * and the "s" field, hashes the symbol to a worker and copies the raw message into that
+     * worker's SPSC queue. Each worker parses its queue with binance_future_parser_t into its own
+     * listener, so all events of a symbol reach the same listener in arrival order. Ticker
+     * arrays are split into their elements and each element is routed on its own.
+     * Messages longer than frame_slot_t::max_size take several consecutive slots of the queue.
+     * When a worker queue is full the router waits for it (counted in stalls()): nothing is
+     * dropped except messages without a symbol.
+     * Listeners must not be touched by the caller until stop() has returned.
+     */
+    template<BinanceFutureListener listener_t>
+    class sharded_pipeline_t {
+    public:
+        using options_t = sharded_pipeline_options_t;
+
+        explicit sharded_pipeline_t(std::span<listener_t> listeners, options_t const &options = {})
+            : batch_size_(options.batch_size ? options.batch_size : 1) {
+            shards_.reserve(listeners.size());
+            for (size_t i = 0; i < listeners.size(); ++i) {
+                shards_.push_back(std::make_unique<shard_t>(options.queue_capacity));
+            }
+            workers_.reserve(listeners.size());
+            for (size_t i = 0; i < listeners.size(); ++i) {
+                workers_.emplace_back([this, i, &listener = listeners[i]] { work(*shards_[i], listener); });
+                if (i < options.worker_cores.size()) pin(workers_.back(), options.worker_cores[i]);
+            }
+        }
+
+        sharded_pipeline_t(sharded_pipeline_t const &) = delete;
+        sharded_pipeline_t &operator=(sharded_pipeline_t const &) = delete;
+
+        ~sharded_pipeline_t() { stop(); }
+
+        /**
+         * @brief Route one complete message (a WebSocket text frame, a capture line)
+         * Does not publish a partial batch: call flush() when no more messages are coming soon.
+         * @return false if the message was dropped (no symbol, or stopped)
+         */
+        bool route(std::chrono::system_clock::time_point const &now, std::string_view message) {
+            if (stopped_ || shards_.empty()) [[unlikely]] return false;
+
+            if (!message.empty() && message.front() == '[') [[unlikely]] {
+                return route_array(now, message);
+            }
+            return route_one(now, message);
+        }
+
+        /**
+         * @brief Route every newline-terminated message of a buffer and publish them
+         * @return Number of bytes consumed; the rest is an unterminated message to feed again
+         */
+        size_t route_stream(std::chrono::system_clock::time_point const &now, std::string_view buffer) {
+            const char *const begin = buffer.data();
+            const char *const end = begin + buffer.size();
+            const char *ptr = begin;
+
+            while (true) {
+                while (ptr < end && (*ptr == '\n' || *ptr == '\r' || *ptr == ' ' || *ptr == '\t')) {
+                    ptr++;
+                }
+                if (ptr >= end) break;
+
+                const char *newline = impl::find_char(ptr, end, '\n');
+                if (!newline) break;
+
+                const char *line_end = newline;
+                if (line_end[-1] == '\r') line_end--;
+                route(now, std::string_view(ptr, static_cast<size_t>(line_end - ptr)));
+                ptr = newline + 1;
+            }
+
+            flush();
+            return static_cast<size_t>(ptr - begin);
+        }
+
+        // Publish the partial batch of every worker queue
+        void flush() {
+            for (auto &shard : shards_) {
+                if (shard->pending) {
+                    shard->ring.publish();
+                    shard->pending = 0;
+                }
+            }
+        }
+
+        // Flush, let the workers drain their queues and join them. Idempotent.
+        void stop() {
+            if (stopped_) return;
+            flush();
+            stopped_ = true;
+            stopping_.store(true, std::memory_order_release);
+            workers_.clear();
+        }
+
+        [[nodiscard]] size_t shard_of(std::string_view symbol) const {
+            return types::symbol_t::from(symbol).hash() % shards_.size();
+        }
+
+        [[nodiscard]] size_t shards() const { return shards_.size(); }
+
+        [[nodiscard]] uint64_t routed() const { return routed_; }
+
+        [[nodiscard]] uint64_t dropped() const { return dropped_; }
+
+        // Times the router found a worker queue full and had to wait
+        [[nodiscard]] uint64_t stalls() const { return stalls_; }
+
+    private:
+        struct shard_t {
+            explicit shard_t(size_t capacity) : ring(capacity) {}
+
+            spsc_ring_t<frame_slot_t> ring;
+            size_t pending = 0;             // Router side: committed, not yet published
+        };
+
+        bool route_one(std::chrono::system_clock::time_point const &now, std::string_view message) {
+            std::string_view symbol = peek_symbol(message.data(), message.data() + message.size());
+            if (symbol.empty() || message.size() > UINT32_MAX) [[unlikely]] {
+                ++dropped_;
+                return false;
+            }
+
+            shard_t &shard = *shards_[shard_of(symbol)];
+            frame_slot_t *slot = claim(shard);
+            slot->receive_time = now.time_since_epoch().count();
+            slot->size = static_cast<uint32_t>(message.size());
+
+            // Long message: the remaining chunks follow in the next slots
+            size_t offset = 0;
+            while (message.size() - offset > frame_slot_t::max_size) [[unlikely]] {
+                std::memcpy(slot->data, message.data() + offset, frame_slot_t::max_size);
+                shard.ring.commit();
+                offset += frame_slot_t::max_size;
+                slot = claim(shard);
+            }
+            std::memcpy(slot->data, message.data() + offset, message.size() - offset);
+            shard.ring.commit();
+            ++routed_;
+
+            if (++shard.pending >= batch_size_) {
+                shard.ring.publish();
+                shard.pending = 0;
+            }
+            return true;
+        }
+
+        // Next free slot of a worker queue; publishes what is pending and waits when it is full
+        frame_slot_t *claim(shard_t &shard) {
+            frame_slot_t *slot = shard.ring.next_slot();
+            if (!slot) [[unlikely]] {
+                ++stalls_;
+                shard.ring.publish();
+                shard.pending = 0;
+                while (!(slot = shard.ring.next_slot())) std::this_thread::yield();
+            }
+            return slot;
+        }
+
+        // [{"e":"24hrTicker",...},{"e":"24hrTicker",...}]: each element is a standalone ticker message
+        bool route_array(std::chrono::system_clock::time_point const &now, std::string_view message) {
+            const char *ptr = message.data();
+            const char *const end = ptr + message.size();
+            bool all = true;
+            while ((ptr = impl::find_char(ptr, end, '{')) != nullptr) {
+                const char *close = impl::find_char(ptr, end, '}');
+                if (!close) {
+                    ++dropped_;
+                    return false;
+                }
+                all &= route_one(now, std::string_view(ptr, static_cast<size_t>(close + 1 - ptr)));
+                ptr = close + 1;
+            }
+            return all;
+        }
+
+        void work(shard_t &shard, listener_t &listener) {
+            // Reassembly of a message spanning several slots; its chunks may arrive in separate
+            // publishes, so the state outlives a consume() call
+            std::string long_message;
+            int64_t long_receive_time = 0;
+            size_t long_missing = 0;
+
+            auto parse = [&](frame_slot_t const &slot) {
+                if (long_missing == 0) [[likely]] {
+                    if (slot.size <= frame_slot_t::max_size) [[likely]] {
+                        const std::chrono::system_clock::time_point time{std::chrono::system_clock::duration(slot.receive_time)};
+                        binance_future_parser_t::parse(time, std::string_view(slot.data, slot.size), listener);
+                        return;
+                    }
+                    long_message.assign(slot.data, frame_slot_t::max_size);
+                    long_receive_time = slot.receive_time;
+                    long_missing = slot.size - frame_slot_t::max_size;
+                    return;
+                }
+
+                const size_t chunk = long_missing < frame_slot_t::max_size ? long_missing : frame_slot_t::max_size;
+                long_message.append(slot.data, chunk);
+                long_missing -= chunk;
+                if (long_missing == 0) {
+                    const std::chrono::system_clock::time_point time{std::chrono::system_clock::duration(long_receive_time)};
+                    binance_future_parser_t::parse(time, long_message, listener);
+                }
+            };
+
+            while (true) {
+                if (shard.ring.consume(parse) != 0) continue;
+                if (stopping_.load(std::memory_order_acquire)) {
+                    // Everything was published before stopping_ was set
+                    while (shard.ring.consume(parse) != 0) {}
+                    return;
+                }
+                std::this_thread::yield();
+            }
+        }
+
+        static void pin(std::jthread &thread, int core) {
+            if (core < 0 || core >= CPU_SETSIZE) return;
+            cpu_set_t set;
+            CPU_ZERO(&set);
+            CPU_SET(core, &set);
+            pthread_setaffinity_np(thread.native_handle(), sizeof(set), &set);
+        }
+
+        size_t batch_size_;
+        std::vector<std::unique_ptr<shard_t>> shards_;
+        std::vector<std::jthread> workers_;
+        std::atomic<bool> stopping_{false};
+        bool stopped_ = false;
+
+        uint64_t routed_ = 0;
+        uint64_t dropped_ = 0;
+        uint64_t stalls_ = 0;
+    };
+} // namespace core::faster_parser::binance
+
+#endif //FASTER_PARSER_BINANCE_SHARDED_H
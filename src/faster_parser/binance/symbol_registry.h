@@ -0,0 +1,97 @@
+/**
+ * @file symbol_registry.h
+ * @author Kevin Rodrigues
+ * @brief Flat symbol interning table mapping Binance symbols to dense integer ids
+ * @version 1.0
+ * @date 16/10/2026
+ */
+
+#ifndef FASTER_PARSER_SYMBOL_REGISTRY_H
+#define FASTER_PARSER_SYMBOL_REGISTRY_H
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+#include "faster_parser/binance/types/symbol.h"
+
+namespace core::faster_parser::binance {
+    using symbol_id_t = uint32_t;
+
+    constexpr symbol_id_t invalid_symbol_id = UINT32_MAX;
+
+    /**
+     * @brief Interns symbols into dense ids [0, max_symbols) with an open-addressing table
+     * All storage is allocated in the constructor: lookups and inserts never allocate,
+     * so per-symbol state can live in flat arrays indexed by the returned id.
+     * Not thread-safe: intern from the parsing thread only.
+     */
+    class symbol_registry_t {
+    public:
+        static constexpr size_t default_max_symbols = 1024;
+
+        explicit symbol_registry_t(size_t max_symbols = default_max_symbols)
+            : max_symbols_(max_symbols),
+              mask_(std::bit_ceil(max_symbols * 2) - 1),
+              slots_(mask_ + 1, invalid_symbol_id) {
+            symbols_.reserve(max_symbols);
+        }
+
+        // Return the id of the symbol, assigning the next free id on first sight.
+        // Returns invalid_symbol_id when the registry is full.
+        __attribute__((always_inline)) symbol_id_t intern(std::string_view symbol) {
+            return intern(types::symbol_t::from(symbol));
+        }
+
+        __attribute__((always_inline)) symbol_id_t intern(types::symbol_t const &symbol) {
+            size_t slot = symbol.hash() & mask_;
+            while (true) {
+                symbol_id_t id = slots_[slot];
+                if (id == invalid_symbol_id) [[unlikely]] {
+                    if (symbols_.size() == max_symbols_) return invalid_symbol_id;
+                    id = static_cast<symbol_id_t>(symbols_.size());
+                    symbols_.push_back(symbol);
+                    slots_[slot] = id;
+                    return id;
+                }
+                if (symbols_[id] == symbol) [[likely]] {
+                    return id;
+                }
+                slot = (slot + 1) & mask_;
+            }
+        }
+
+        // Return the id of an already interned symbol, or invalid_symbol_id
+        [[nodiscard]] symbol_id_t find(std::string_view symbol) const {
+            types::symbol_t key = types::symbol_t::from(symbol);
+            size_t slot = key.hash() & mask_;
+            while (true) {
+                symbol_id_t id = slots_[slot];
+                if (id == invalid_symbol_id || symbols_[id] == key) return id;
+                slot = (slot + 1) & mask_;
+            }
+        }
+
+        [[nodiscard]] types::symbol_t const &symbol(symbol_id_t id) const {
+            return symbols_[id];
+        }
+
+        [[nodiscard]] size_t size() const {
+            return symbols_.size();
+        }
+
+        [[nodiscard]] size_t max_symbols() const {
+            return max_symbols_;
+        }
+
+    private:
+        size_t max_symbols_;
+        size_t mask_;
+        std::vector<symbol_id_t> slots_;
+        std::vector<types::symbol_t> symbols_;
+    };
+} // namespace core::faster_parser::binance
+
+#endif //FASTER_PARSER_SYMBOL_REGISTRY_H
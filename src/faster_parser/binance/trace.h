@@ -0,0 +1,218 @@
+/**
+ * @file trace.h
+ * @author Kevin Rodrigues
+ * @brief Per-stage parse latency tracing with the timestamp counter, compiled out when disabled
+ * @version 1.0
+ * @date 16/10/2026
+ */
+
+#ifndef FASTER_PARSER_TRACE_H
+#define FASTER_PARSER_TRACE_H
+
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include "faster_parser/binance/concepts.h"
+#include "faster_parser/core/histogram.h"
+#include "faster_parser/core/tsc.h"
+
+namespace core::faster_parser::binance {
+    enum class trace_type_t : uint8_t {
+        book_ticker = 0,
+        trade = 1,
+        ticker = 2,
+        ticker_array = 3,
+        depth = 4
+    };
+
+    enum class trace_stage_t : uint8_t {
+        dispatch = 0,       // ingress -> message type recognised
+        extract = 1,        // type recognised -> fields parsed, listener about to be called
+        listener = 2,       // listener call(s)
+        total = 3           // ingress -> listener returned
+    };
+
+    inline constexpr size_t trace_type_count = 5;
+    inline constexpr size_t trace_stage_count = 4;
+
+    inline constexpr std::string_view trace_type_names[trace_type_count] = {"book_ticker", "trade", "ticker", "ticker_array", "depth"};
+    inline constexpr std::string_view trace_stage_names[trace_stage_count] = {"dispatch", "extract", "listener", "total"};
+
+    // Timestamp counter values taken by the parser for one message. For ticker arrays,
+    // extracted is taken before the first element's callback and delivered after the last.
+    struct parse_stamps_t {
+        uint64_t ingress = 0;
+        uint64_t dispatched = 0;
+        uint64_t extracted = 0;
+        uint64_t delivered = 0;
+    };
+
+    /**
+     * @brief Tracer that disables tracing: parse(now, raw, listener, tracer) is then parse(now, raw, listener)
+     */
+    struct null_tracer_t {
+        static constexpr bool enabled = false;
+    };
+
+    /**
+     * @brief Per-message-type histograms of the time spent in each parse stage, in counter ticks
+     * Passed to binance_future_parser_t::parse(now, raw, listener, tracer), which reads the
+     * timestamp counter at ingress, after type dispatch, before the listener call and after it
+     * returns, and records the stage durations of every message it delivers. Histograms hold
+     * raw ticks (one subtraction per stage on the hot path); percentile_ns() and the exports
+     * convert with the calibrated clock. One tracer per parsing thread, merged for reporting.
+     */
+    class parse_tracer_t {
+    public:
+        static constexpr bool enabled = true;
+
+        explicit parse_tracer_t(tsc_clock_t const &clock = tsc_clock_t::calibrate())
+            : clock_(clock), histograms_(std::make_unique<latency_histogram_t[]>(trace_type_count * trace_stage_count)) {}
+
+        parse_tracer_t(parse_tracer_t const &) = delete;
+        parse_tracer_t &operator=(parse_tracer_t const &) = delete;
+
+        __attribute__((always_inline)) void record(trace_type_t type, parse_stamps_t const &stamps) {
+            latency_histogram_t *histograms = &histograms_[static_cast<size_t>(type) * trace_stage_count];
+            histograms[static_cast<size_t>(trace_stage_t::dispatch)].record(stamps.dispatched - stamps.ingress);
+            histograms[static_cast<size_t>(trace_stage_t::extract)].record(stamps.extracted - stamps.dispatched);
+            histograms[static_cast<size_t>(trace_stage_t::listener)].record(stamps.delivered - stamps.extracted);
+            histograms[static_cast<size_t>(trace_stage_t::total)].record(stamps.delivered - stamps.ingress);
+        }
+
+        // Messages recognised but not delivered (malformed after the type prefix)
+        __attribute__((always_inline)) void record_failure() {
+            failures_.store(failures_.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        }
+
+        [[nodiscard]] latency_histogram_t const &histogram(trace_type_t type, trace_stage_t stage) const {
+            return histograms_[static_cast<size_t>(type) * trace_stage_count + static_cast<size_t>(stage)];
+        }
+
+        [[nodiscard]] uint64_t percentile_ns(trace_type_t type, trace_stage_t stage, double percentile) const {
+            return clock_.to_ns(histogram(type, stage).percentile(percentile));
+        }
+
+        [[nodiscard]] uint64_t messages(trace_type_t type) const { return histogram(type, trace_stage_t::total).count(); }
+        [[nodiscard]] uint64_t failures() const { return failures_.load(std::memory_order_relaxed); }
+        [[nodiscard]] tsc_clock_t const &clock() const { return clock_; }
+
+        // Add another thread's tracer (see latency_histogram_t::merge)
+        void merge(parse_tracer_t const &other) {
+            for (size_t i = 0; i < trace_type_count * trace_stage_count; ++i) histograms_[i].merge(other.histograms_[i]);
+            failures_.store(failures() + other.failures(), std::memory_order_relaxed);
+        }
+
+        void reset() {
+            for (size_t i = 0; i < trace_type_count * trace_stage_count; ++i) histograms_[i].reset();
+            failures_.store(0, std::memory_order_relaxed);
+        }
+
+        // One line per traced type and stage, in ns: "book_ticker.extract count=... p50=... ns"
+        [[nodiscard]] std::string to_text() const {
+            std::string out;
+            for_each_traced([&](size_t type, size_t stage, latency_histogram_t const &histogram) {
+                std::string name(trace_type_names[type]);
+                name += '.';
+                name += trace_stage_names[stage];
+                out += histogram.to_text(name, clock_.ns_per_tick(), "ns");
+                out += '\n';
+            });
+            return out;
+        }
+
+        // {"book_ticker":{"dispatch":{...},...},...} in ns, traced types only
+        [[nodiscard]] std::string to_json() const {
+            std::string out = "{";
+            for_each_traced([&](size_t type, size_t stage, latency_histogram_t const &histogram) {
+                if (stage == 0) {
+                    if (out.size() > 1) out += "},";
+                    out += '"';
+                    out += trace_type_names[type];
+                    out += "\":{";
+                } else {
+                    out += ',';
+                }
+                out += '"';
+                out += trace_stage_names[stage];
+                out += "\":";
+                out += histogram.to_json(clock_.ns_per_tick());
+            });
+            if (out.size() > 1) out += '}';
+            out += '}';
+            return out;
+        }
+
+    private:
+        template<typename fn_t>
+        void for_each_traced(fn_t &&fn) const {
+            for (size_t type = 0; type < trace_type_count; ++type) {
+                if (histograms_[type * trace_stage_count + static_cast<size_t>(trace_stage_t::total)].count() == 0) continue;
+                for (size_t stage = 0; stage < trace_stage_count; ++stage) fn(type, stage, histograms_[type * trace_stage_count + stage]);
+            }
+        }
+
+        tsc_clock_t clock_;
+        std::unique_ptr<latency_histogram_t[]> histograms_;
+        std::atomic<uint64_t> failures_ = 0;
+    };
+
+    /**
+     * @brief Tracer type selected by the build: parse_tracer_t with -DFASTER_PARSER_TRACING
+     * (CMake option FASTER_PARSER_TRACING), null_tracer_t otherwise
+     */
+#if defined(FASTER_PARSER_TRACING)
+    using default_tracer_t = parse_tracer_t;
+#else
+    using default_tracer_t = null_tracer_t;
+#endif
+
+    template<typename T>
+    concept ParseTracer = requires { { T::enabled } -> std::convertible_to<bool>; };
+
+    /**
+     * @brief Listener wrapper stamping the counter around the wrapped listener's callbacks
+     * Provides exactly the callbacks of listener_t, so the parser compiles in the same types.
+     */
+    template<typename listener_t>
+    struct traced_listener_t {
+        listener_t &listener;
+        parse_stamps_t stamps{};
+
+        void on_book_ticker(const types::book_ticker_t &ticker) requires BookTickerListener<listener_t> {
+            enter();
+            listener.on_book_ticker(ticker);
+            stamps.delivered = read_tsc();
+        }
+
+        void on_trade(const types::trade_t &trade) requires TradeListener<listener_t> {
+            enter();
+            listener.on_trade(trade);
+            stamps.delivered = read_tsc();
+        }
+
+        void on_ticker(const types::ticker_t &ticker) requires TickerListener<listener_t> {
+            enter();
+            listener.on_ticker(ticker);
+            stamps.delivered = read_tsc();
+        }
+
+        void on_depth_update(const types::depth_update_t &update) requires DepthListener<listener_t> {
+            enter();
+            listener.on_depth_update(update);
+            stamps.delivered = read_tsc();
+        }
+
+    private:
+        __attribute__((always_inline)) void enter() {
+            if (stamps.extracted == 0) stamps.extracted = read_tsc();
+        }
+    };
+} // namespace core::faster_parser::binance
+
+#endif //FASTER_PARSER_TRACE_H
@@ -11,6 +11,9 @@
 
 #include <chrono>
 #include <string_view>
+#include <type_traits>
+
+#include "faster_parser/binance/types/symbol.h"
 
 namespace core::faster_parser::binance::types {
 
@@ -45,6 +48,38 @@ namespace core::faster_parser::binance::types {
         level_data_t ask;                               // Best ask level
     };
 
+    /**
+     * @brief Self-contained book ticker with the symbol stored inline
+     * Same fields as book_ticker_t but trivially copyable and independent of the receive
+     * buffer, so it can be queued to another thread as-is (80 bytes).
+     */
+    struct book_ticker_owned_t {
+        book_ticker_owned_t() = default;
+
+        explicit book_ticker_owned_t(book_ticker_t const &ticker)
+            : symbol(symbol_t::from(ticker.symbol)), time(ticker.time),
+              exchange_timestamp(ticker.exchange_timestamp), bid(ticker.bid), ask(ticker.ask) {}
+
+        [[nodiscard]] book_ticker_t view() const {
+            book_ticker_t ticker;
+            ticker.time = time;
+            ticker.symbol = symbol.view();
+            ticker.exchange_timestamp = exchange_timestamp;
+            ticker.bid = bid;
+            ticker.ask = ask;
+            return ticker;
+        }
+
+        symbol_t symbol;                                // Symbol (inline copy)
+        std::chrono::system_clock::time_point time;     // Reception time
+        uint64_t exchange_timestamp = 0;                // Exchange timestamp (E)
+        level_data_t bid;                               // Best bid level
+        level_data_t ask;                               // Best ask level
+    };
+
+    static_assert(std::is_trivially_copyable_v<book_ticker_owned_t>);
+    static_assert(sizeof(book_ticker_owned_t) == 80);
+
 } // namespace core::faster_parser::binance::types
 
 #endif //FASTER_PARSER_BOOK_TICKER_H
\ No newline at end of file
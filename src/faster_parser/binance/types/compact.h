@@ -0,0 +1,158 @@
+/**
+ * @file compact.h
+ * @author Kevin Rodrigues
+ * @brief Cache-line packed layouts of the Binance Futures events
+ * @version 1.0
+ * @date 16/10/2026
+ */
+
+#ifndef FASTER_PARSER_COMPACT_H
+#define FASTER_PARSER_COMPACT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "faster_parser/binance/types/book_ticker.h"
+#include "faster_parser/binance/types/symbol.h"
+#include "faster_parser/binance/types/ticker.h"
+#include "faster_parser/binance/types/trade.h"
+
+namespace core::faster_parser::binance::types {
+    constexpr size_t cache_line_size = 64;
+
+    /**
+     * @brief Book ticker packed in a single cache line
+     * Fields are ordered by access frequency and the update id is stored once
+     * (book_ticker_t duplicates it in bid.sequence and ask.sequence).
+     * The reception time is not carried: it is known by whoever dequeues the event.
+     */
+    struct alignas(cache_line_size) book_ticker_compact_t {
+        book_ticker_compact_t() = default;
+
+        explicit book_ticker_compact_t(book_ticker_t const &ticker)
+            : bid_price(ticker.bid.price), ask_price(ticker.ask.price),
+              bid_volume(ticker.bid.volume), ask_volume(ticker.ask.volume),
+              update_id(ticker.bid.sequence), exchange_timestamp(ticker.exchange_timestamp),
+              symbol(symbol_t::from(ticker.symbol)) {}
+
+        double bid_price = 0.;                          // Best bid price (b)
+        double ask_price = 0.;                          // Best ask price (a)
+        double bid_volume = 0.;                         // Best bid quantity (B)
+        double ask_volume = 0.;                         // Best ask quantity (A)
+        uint64_t update_id = 0;                         // Order book update id (u)
+        uint64_t exchange_timestamp = 0;                // Exchange timestamp (E)
+        symbol_t symbol;                                // Symbol (inline copy)
+    };
+
+    /**
+     * @brief Aggregate trade packed in a single cache line
+     * The event time is stored as a delta from the trade time, and the trade count
+     * (last - first) shares a word with the buyer-maker flag.
+     */
+    struct alignas(cache_line_size) trade_compact_t {
+        trade_compact_t() = default;
+
+        explicit trade_compact_t(trade_t const &trade)
+            : price(trade.price), quantity(trade.quantity), agg_trade_id(trade.agg_trade_id),
+              trade_time(trade.trade_time), first_trade_id(trade.first_trade_id),
+              event_time_delta(static_cast<int32_t>(trade.event_time - trade.trade_time)),
+              trade_span_and_side(static_cast<uint32_t>((trade.last_trade_id - trade.first_trade_id) & span_mask) |
+                                  (trade.is_buyer_maker ? buyer_maker_bit : 0U)),
+              symbol(symbol_t::from(trade.symbol)) {}
+
+        [[nodiscard]] uint64_t event_time() const {
+            return trade_time + static_cast<int64_t>(event_time_delta);
+        }
+
+        [[nodiscard]] uint64_t last_trade_id() const {
+            return first_trade_id + (trade_span_and_side & span_mask);
+        }
+
+        [[nodiscard]] bool is_buyer_maker() const {
+            return (trade_span_and_side & buyer_maker_bit) != 0;
+        }
+
+        static constexpr uint32_t buyer_maker_bit = 1U << 31;
+        static constexpr uint32_t span_mask = buyer_maker_bit - 1;
+
+        double price = 0.;                              // Price (p)
+        double quantity = 0.;                           // Quantity (q)
+        uint64_t agg_trade_id = 0;                      // Aggregate trade ID (a)
+        uint64_t trade_time = 0;                        // Trade time (T)
+        uint64_t first_trade_id = 0;                    // First trade ID (f)
+        int32_t event_time_delta = 0;                   // Event time (E) - trade time (T)
+        uint32_t trade_span_and_side = 0;               // Last - first trade ID | buyer maker (m) in bit 31
+        symbol_t symbol;                                // Symbol (inline copy)
+    };
+
+    /**
+     * @brief 24hr ticker packed in two cache lines instead of three
+     * Prices live in the first line, volumes and bookkeeping in the second. The close time is
+     * stored as a delta from the event time, the open time as the window length before it and
+     * the first trade id as its distance to the last one. n is kept on its own: it does not
+     * always equal L - F + 1 (a symbol without trades has n = 0 with F = L).
+     */
+    struct alignas(cache_line_size) ticker_compact_t {
+        ticker_compact_t() = default;
+
+        explicit ticker_compact_t(ticker_t const &ticker)
+            : last_price(ticker.last_price), last_quantity(ticker.last_quantity),
+              price_change(ticker.price_change), price_change_percent(ticker.price_change_percent),
+              weighted_avg_price(ticker.weighted_avg_price), open_price(ticker.open_price),
+              high_price(ticker.high_price), low_price(ticker.low_price),
+              total_traded_base_volume(ticker.total_traded_base_volume),
+              total_traded_quote_volume(ticker.total_traded_quote_volume),
+              event_time(ticker.event_time), last_trade_id(ticker.last_trade_id),
+              close_time_delta(static_cast<int32_t>(ticker.statistics_close_time - ticker.event_time)),
+              statistics_window(static_cast<uint32_t>(ticker.statistics_close_time - ticker.statistics_open_time)),
+              trade_id_span(static_cast<uint32_t>(ticker.last_trade_id - ticker.first_trade_id)),
+              total_trades(static_cast<uint32_t>(ticker.total_trades)), symbol(symbol_t::from(ticker.symbol)) {}
+
+        [[nodiscard]] uint64_t statistics_close_time() const {
+            return event_time + static_cast<int64_t>(close_time_delta);
+        }
+
+        [[nodiscard]] uint64_t statistics_open_time() const {
+            return statistics_close_time() - statistics_window;
+        }
+
+        [[nodiscard]] uint64_t first_trade_id() const {
+            return last_trade_id - trade_id_span;
+        }
+
+        double last_price = 0.;                         // Last price (c)
+        double last_quantity = 0.;                      // Last quantity (Q)
+        double price_change = 0.;                       // Price change (p)
+        double price_change_percent = 0.;               // Price change percent (P)
+        double weighted_avg_price = 0.;                 // Weighted average price (w)
+        double open_price = 0.;                         // Open price (o)
+        double high_price = 0.;                         // High price (h)
+        double low_price = 0.;                          // Low price (l)
+        double total_traded_base_volume = 0.;           // Total traded base volume (v)
+        double total_traded_quote_volume = 0.;          // Total traded quote volume (q)
+        uint64_t event_time = 0;                        // Event time (E)
+        uint64_t last_trade_id = 0;                     // Last trade ID (L)
+        int32_t close_time_delta = 0;                   // Statistics close time (C) - event time (E)
+        uint32_t statistics_window = 0;                 // Statistics close time (C) - open time (O)
+        uint32_t trade_id_span = 0;                     // Last (L) - first (F) trade ID
+        uint32_t total_trades = 0;                      // Total number of trades (n)
+        symbol_t symbol;                                // Symbol (inline copy)
+    };
+
+    static_assert(sizeof(book_ticker_compact_t) == cache_line_size);
+    static_assert(alignof(book_ticker_compact_t) == cache_line_size);
+    static_assert(std::is_trivially_copyable_v<book_ticker_compact_t>);
+
+    static_assert(sizeof(trade_compact_t) == cache_line_size);
+    static_assert(alignof(trade_compact_t) == cache_line_size);
+    static_assert(std::is_trivially_copyable_v<trade_compact_t>);
+
+    static_assert(sizeof(ticker_compact_t) == 2 * cache_line_size);
+    static_assert(alignof(ticker_compact_t) == cache_line_size);
+    static_assert(std::is_trivially_copyable_v<ticker_compact_t>);
+    static_assert(offsetof(ticker_compact_t, low_price) + sizeof(double) == cache_line_size);
+
+} // namespace core::faster_parser::binance::types
+
+#endif //FASTER_PARSER_COMPACT_H
@@ -0,0 +1,110 @@
+/**
+ * @file depth.h
+ * @author Kevin Rodrigues
+ * @brief Diff depth update and depth snapshot structures for Binance Futures
+ * @version 1.0
+ * @date 16/10/2026
+ */
+
+#ifndef FASTER_PARSER_DEPTH_H
+#define FASTER_PARSER_DEPTH_H
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#include "faster_parser/core/fast_scalar_parser.h"
+
+namespace core::faster_parser::binance::types {
+
+    struct depth_level_t {
+        double price = 0.;
+        double quantity = 0.;                           // 0 removes the level
+    };
+
+    /**
+     * @brief Zero-copy view of a [["price","qty"],...] array, parsed lazily while iterated
+     * The raw text starts at '[' and ends after the closing ']'; levels are only converted
+     * to doubles when visited, so a consumer that skips a side never pays for it.
+     */
+    class depth_levels_t {
+    public:
+        depth_levels_t() = default;
+
+        explicit depth_levels_t(std::string_view raw) : raw_(raw) {}
+
+        // Call fn(depth_level_t const &) for every level, in message order
+        template<typename fn_t>
+        __attribute__((always_inline)) void for_each(fn_t &&fn) const {
+            const char *ptr = raw_.data();
+            const char *const end = ptr + raw_.size();
+            while (ptr < end) {
+                // ["price","quantity"]
+                const char *price = next_quote(ptr, end);
+                if (!price) return;
+                const char *price_end = next_quote(price + 1, end);
+                if (!price_end) return;
+                const char *quantity = next_quote(price_end + 1, end);
+                if (!quantity) return;
+                const char *quantity_end = next_quote(quantity + 1, end);
+                if (!quantity_end) return;
+
+                depth_level_t level;
+                level.price = fast_scalar_parser::parse_float(std::string_view(price + 1, price_end));
+                level.quantity = fast_scalar_parser::parse_float(std::string_view(quantity + 1, quantity_end));
+                fn(static_cast<depth_level_t const &>(level));
+                ptr = quantity_end + 1;
+            }
+        }
+
+        [[nodiscard]] size_t size() const {
+            size_t count = 0;
+            for (char c : raw_) count += c == '"';
+            return count / 4;
+        }
+
+        [[nodiscard]] bool empty() const { return raw_.size() <= 2; }
+        [[nodiscard]] std::string_view raw() const { return raw_; }
+
+    private:
+        static __attribute__((always_inline)) const char *next_quote(const char *ptr, const char *end) {
+            while (ptr < end && *ptr != '"') ++ptr;
+            return ptr < end ? ptr : nullptr;
+        }
+
+        std::string_view raw_;
+    };
+
+    /**
+     * @brief Diff depth update for Binance Futures
+     * Corresponds to the "depthUpdate" event of the <symbol>@depth streams. The levels are
+     * views into the receive buffer, valid for the duration of the callback.
+     */
+    struct depth_update_t {
+        std::chrono::system_clock::time_point time;     // Reception time
+        std::string_view symbol;                        // Symbol (zero-copy reference)
+        uint64_t event_time = 0;                        // Event time (E)
+        uint64_t transaction_time = 0;                  // Transaction time (T)
+        uint64_t first_update_id = 0;                   // First update id in event (U)
+        uint64_t final_update_id = 0;                   // Final update id in event (u)
+        uint64_t previous_update_id = 0;                // Final update id of the previous event (pu)
+        depth_levels_t bids;                            // Bids to update (b)
+        depth_levels_t asks;                            // Asks to update (a)
+    };
+
+    /**
+     * @brief Order book snapshot from the REST endpoint GET /fapi/v1/depth
+     * Levels are views into the response body.
+     */
+    struct depth_snapshot_t {
+        uint64_t last_update_id = 0;                    // lastUpdateId
+        uint64_t event_time = 0;                        // Message output time (E)
+        uint64_t transaction_time = 0;                  // Transaction time (T)
+        depth_levels_t bids;
+        depth_levels_t asks;
+    };
+
+} // namespace core::faster_parser::binance::types
+
+#endif //FASTER_PARSER_DEPTH_H
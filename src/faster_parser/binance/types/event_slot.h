@@ -0,0 +1,107 @@
+/**
+ * @file event_slot.h
+ * @author Kevin Rodrigues
+ * @brief Fixed-size tagged slot carrying any Binance Futures event between threads
+ * @version 1.0
+ * @date 16/10/2026
+ */
+
+#ifndef FASTER_PARSER_EVENT_SLOT_H
+#define FASTER_PARSER_EVENT_SLOT_H
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "faster_parser/binance/types/compact.h"
+
+namespace core::faster_parser::binance::types {
+    enum class event_type_t : uint8_t {
+        none = 0,
+        book_ticker = 1,
+        trade = 2,
+        ticker = 3
+    };
+
+    // Stands in for the ticker payload of slots that do not carry tickers
+    struct no_payload_t {};
+
+    /**
+     * @brief One event in a queue slot: a header line, then the compact event
+     * The header carries the tag and the reception time that the compact layouts leave out,
+     * so a consumer on another core can measure parse-to-consume latency. The compact book
+     * ticker and trade already fill their cache line (73 bytes with the header), so slots are
+     * sized by the events they carry instead: two lines for book tickers and trades, three
+     * when 24hr tickers are carried as well.
+     */
+    template<bool with_ticker>
+    struct alignas(cache_line_size) basic_event_slot_t {
+        basic_event_slot_t() : book_ticker() {}
+
+        // Fill the slot from a parsed event (tag, receive time and compact payload)
+        __attribute__((always_inline)) void assign(book_ticker_t const &event) {
+            type = event_type_t::book_ticker;
+            receive_time = event.time.time_since_epoch().count();
+            book_ticker = book_ticker_compact_t(event);
+        }
+
+        __attribute__((always_inline)) void assign(trade_t const &event) {
+            type = event_type_t::trade;
+            receive_time = event.time.time_since_epoch().count();
+            trade = trade_compact_t(event);
+        }
+
+        __attribute__((always_inline)) void assign(ticker_t const &event) requires with_ticker {
+            type = event_type_t::ticker;
+            receive_time = event.time.time_since_epoch().count();
+            ticker = ticker_compact_t(event);
+        }
+
+        [[nodiscard]] std::chrono::system_clock::time_point time() const {
+            return std::chrono::system_clock::time_point(std::chrono::system_clock::duration(receive_time));
+        }
+
+        // Call fn with the compact event held in the slot; returns false for an empty slot
+        template<typename fn_t>
+        __attribute__((always_inline)) bool visit(fn_t &&fn) const {
+            switch (type) {
+                case event_type_t::book_ticker: fn(book_ticker); return true;
+                case event_type_t::trade: fn(trade); return true;
+                case event_type_t::ticker:
+                    if constexpr (with_ticker) {
+                        fn(ticker);
+                        return true;
+                    }
+                    return false;
+                default: return false;
+            }
+        }
+
+        event_type_t type = event_type_t::none;
+        int64_t receive_time = 0;                       // Reception time, system_clock ticks
+
+        union {
+            book_ticker_compact_t book_ticker;
+            trade_compact_t trade;
+            std::conditional_t<with_ticker, ticker_compact_t, no_payload_t> ticker;
+        };
+    };
+
+    // Every event type, three cache lines
+    using event_slot_t = basic_event_slot_t<true>;
+
+    // Book tickers and trades only, two cache lines
+    using book_trade_slot_t = basic_event_slot_t<false>;
+
+    static_assert(sizeof(event_slot_t) == 3 * cache_line_size);
+    static_assert(offsetof(event_slot_t, book_ticker) == cache_line_size);
+    static_assert(std::is_trivially_copyable_v<event_slot_t>);
+
+    static_assert(sizeof(book_trade_slot_t) == 2 * cache_line_size);
+    static_assert(offsetof(book_trade_slot_t, book_ticker) == cache_line_size);
+    static_assert(std::is_trivially_copyable_v<book_trade_slot_t>);
+
+} // namespace core::faster_parser::binance::types
+
+#endif //FASTER_PARSER_EVENT_SLOT_H
@@ -0,0 +1,46 @@
+/**
+ * @file sequence.h
+ * @author Kevin Rodrigues
+ * @brief Sequence continuity events reported by the sequence checker
+ * @version 1.0
+ * @date 16/10/2026
+ */
+
+#ifndef FASTER_PARSER_SEQUENCE_H
+#define FASTER_PARSER_SEQUENCE_H
+
+#include <cstdint>
+#include <string_view>
+
+namespace core::faster_parser::binance::types {
+
+    enum class sequence_stream_t : uint8_t {
+        book_ticker = 0,                                // Order book update id (u)
+        trade = 1,                                      // Aggregate trade id (a)
+        depth = 2                                       // Diff depth final / previous update id (u / pu)
+    };
+
+    enum class sequence_issue_t : uint8_t {
+        gap = 0,                                        // Ids were skipped
+        duplicate = 1,                                  // Same id as the last message
+        regression = 2                                  // Older id than the last message
+    };
+
+    /**
+     * @brief One continuity break on one symbol's stream
+     * `expected` is the id that would have continued the stream and `received` the id that
+     * arrived. Book ticker ids are not contiguous, so `expected` is the lowest acceptable
+     * one. Depth gaps compare pu: `expected` is the previous u, `received` the pu.
+     */
+    struct sequence_event_t {
+        sequence_issue_t issue;
+        sequence_stream_t stream;
+        uint32_t symbol_id;                             // Dense id from the checker's registry
+        std::string_view symbol;                        // Symbol (zero-copy reference)
+        uint64_t expected;
+        uint64_t received;
+    };
+
+} // namespace core::faster_parser::binance::types
+
+#endif //FASTER_PARSER_SEQUENCE_H
@@ -0,0 +1,122 @@
+/**
+ * @file symbol.h
+ * @author Kevin Rodrigues
+ * @brief Fixed-size inline symbol storage for self-contained Binance events
+ * @version 1.0
+ * @date 16/10/2026
+ */
+
+#ifndef FASTER_PARSER_SYMBOL_H
+#define FASTER_PARSER_SYMBOL_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <type_traits>
+
+#if defined(__SSE2__)
+#include <immintrin.h>
+#elif defined(__aarch64__) || defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+namespace core::faster_parser::binance::types {
+
+    /**
+     * @brief Symbol stored inline in a 16-byte aligned, zero-padded char array
+     * Filled with a single 16-byte load/mask/store so that events carrying it can be
+     * copied to another thread without allocating or touching the receive buffer.
+     * Symbols longer than 16 characters are truncated (no Binance Futures symbol is).
+     */
+    struct alignas(16) symbol_t {
+        static constexpr size_t capacity = 16;
+
+        char data[capacity] = {};
+
+        static __attribute__((always_inline)) symbol_t from(std::string_view str) {
+            symbol_t symbol;
+            symbol.assign(str);
+            return symbol;
+        }
+
+        __attribute__((always_inline)) void assign(std::string_view str) {
+            const size_t len = str.size() < capacity ? str.size() : capacity;
+            const char *src = str.data();
+
+            // A 16-byte load is only safe if it cannot cross into the next page
+            if ((reinterpret_cast<uintptr_t>(src) & 4095) > 4096 - capacity) [[unlikely]] {
+                std::memset(data, 0, capacity);
+                std::memcpy(data, src, len);
+                return;
+            }
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Warray-bounds"
+#if defined(__SSE2__)
+            const __m128i iota = _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+            __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+            __m128i keep = _mm_cmpgt_epi8(_mm_set1_epi8(static_cast<char>(len)), iota);
+            _mm_store_si128(reinterpret_cast<__m128i*>(data), _mm_and_si128(chunk, keep));
+#elif defined(__aarch64__) || defined(__ARM_NEON)
+            static constexpr uint8_t iota_bytes[16] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15};
+            uint8x16_t chunk = vld1q_u8(reinterpret_cast<const uint8_t*>(src));
+            uint8x16_t keep = vcltq_u8(vld1q_u8(iota_bytes), vdupq_n_u8(static_cast<uint8_t>(len)));
+            vst1q_u8(reinterpret_cast<uint8_t*>(data), vandq_u8(chunk, keep));
+#else
+            std::memset(data, 0, capacity);
+            std::memcpy(data, src, len);
+#endif
+#pragma GCC diagnostic pop
+        }
+
+        [[nodiscard]] size_t size() const {
+            uint64_t lo, hi;
+            std::memcpy(&lo, data, 8);
+            std::memcpy(&hi, data + 8, 8);
+            // Symbols are zero padded: the length is one past the highest non-zero byte
+            if (hi != 0) {
+                return 8 + (71 - __builtin_clzll(hi)) / 8;
+            }
+            return lo ? (71 - __builtin_clzll(lo)) / 8 : 0;
+        }
+
+        [[nodiscard]] bool empty() const {
+            return data[0] == 0;
+        }
+
+        [[nodiscard]] std::string_view view() const {
+            return {data, size()};
+        }
+
+        [[nodiscard]] uint64_t hash() const {
+            uint64_t lo, hi;
+            std::memcpy(&lo, data, 8);
+            std::memcpy(&hi, data + 8, 8);
+            // Every input byte must reach the low bits tables mask with: symbols often
+            // share a prefix and differ only in bytes 5-10 (1000PEPEUSDT, 1000SHIBUSDT)
+            uint64_t h = lo ^ (hi * 0x9E3779B97F4A7C15ULL);
+            h = (h ^ (h >> 30)) * 0xBF58476D1CE4E5B9ULL;
+            h = (h ^ (h >> 27)) * 0x94D049BB133111EBULL;
+            return h ^ (h >> 31);
+        }
+
+        bool operator==(symbol_t const &other) const {
+            uint64_t a[2], b[2];
+            std::memcpy(a, data, 16);
+            std::memcpy(b, other.data, 16);
+            return ((a[0] ^ b[0]) | (a[1] ^ b[1])) == 0;
+        }
+
+        bool operator==(std::string_view other) const {
+            return view() == other;
+        }
+    };
+
+    static_assert(sizeof(symbol_t) == 16);
+    static_assert(alignof(symbol_t) == 16);
+    static_assert(std::is_trivially_copyable_v<symbol_t>);
+
+} // namespace core::faster_parser::binance::types
+
+#endif //FASTER_PARSER_SYMBOL_H
@@ -12,6 +12,9 @@
 #include <chrono>
 #include <cstdint>
 #include <string_view>
+#include <type_traits>
+
+#include "faster_parser/binance/types/symbol.h"
 
 namespace core::faster_parser::binance::types {
 
@@ -41,6 +44,78 @@ namespace core::faster_parser::binance::types {
         uint64_t total_trades;                          // Total number of trades (n)
     };
 
+    /**
+     * @brief Self-contained 24hr ticker with the symbol stored inline
+     * Same fields as ticker_t but trivially copyable and independent of the receive buffer.
+     */
+    struct ticker_owned_t {
+        ticker_owned_t() = default;
+
+        explicit ticker_owned_t(ticker_t const &ticker)
+            : symbol(symbol_t::from(ticker.symbol)), time(ticker.time),
+              event_time(ticker.event_time),
+              price_change(ticker.price_change),
+              price_change_percent(ticker.price_change_percent),
+              weighted_avg_price(ticker.weighted_avg_price),
+              last_price(ticker.last_price),
+              last_quantity(ticker.last_quantity),
+              open_price(ticker.open_price),
+              high_price(ticker.high_price),
+              low_price(ticker.low_price),
+              total_traded_base_volume(ticker.total_traded_base_volume),
+              total_traded_quote_volume(ticker.total_traded_quote_volume),
+              statistics_open_time(ticker.statistics_open_time),
+              statistics_close_time(ticker.statistics_close_time),
+              first_trade_id(ticker.first_trade_id),
+              last_trade_id(ticker.last_trade_id),
+              total_trades(ticker.total_trades) {}
+
+        [[nodiscard]] ticker_t view() const {
+            ticker_t ticker;
+            ticker.time = time;
+            ticker.symbol = symbol.view();
+            ticker.event_time = event_time;
+            ticker.price_change = price_change;
+            ticker.price_change_percent = price_change_percent;
+            ticker.weighted_avg_price = weighted_avg_price;
+            ticker.last_price = last_price;
+            ticker.last_quantity = last_quantity;
+            ticker.open_price = open_price;
+            ticker.high_price = high_price;
+            ticker.low_price = low_price;
+            ticker.total_traded_base_volume = total_traded_base_volume;
+            ticker.total_traded_quote_volume = total_traded_quote_volume;
+            ticker.statistics_open_time = statistics_open_time;
+            ticker.statistics_close_time = statistics_close_time;
+            ticker.first_trade_id = first_trade_id;
+            ticker.last_trade_id = last_trade_id;
+            ticker.total_trades = total_trades;
+            return ticker;
+        }
+
+        symbol_t symbol;                                // Symbol (inline copy)
+        std::chrono::system_clock::time_point time;     // Reception time
+        uint64_t event_time = 0;                        // Event time (E)
+        double price_change = 0.;                       // Price change (p)
+        double price_change_percent = 0.;               // Price change percent (P)
+        double weighted_avg_price = 0.;                 // Weighted average price (w)
+        double last_price = 0.;                         // Last price (c)
+        double last_quantity = 0.;                      // Last quantity (Q)
+        double open_price = 0.;                         // Open price (o)
+        double high_price = 0.;                         // High price (h)
+        double low_price = 0.;                          // Low price (l)
+        double total_traded_base_volume = 0.;           // Total traded base volume (v)
+        double total_traded_quote_volume = 0.;          // Total traded quote volume (q)
+        uint64_t statistics_open_time = 0;              // Statistics open time (O)
+        uint64_t statistics_close_time = 0;             // Statistics close time (C)
+        uint64_t first_trade_id = 0;                    // First trade ID (F)
+        uint64_t last_trade_id = 0;                     // Last trade ID (L)
+        uint64_t total_trades = 0;                      // Total number of trades (n)
+    };
+
+    static_assert(std::is_trivially_copyable_v<ticker_owned_t>);
+    static_assert(sizeof(ticker_owned_t) == 160);
+
 }
 
 #endif //FASTER_PARSER_TICKER_H
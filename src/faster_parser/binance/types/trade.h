@@ -11,6 +11,9 @@
 
 #include <chrono>
 #include <string_view>
+#include <type_traits>
+
+#include "faster_parser/binance/types/symbol.h"
 
 namespace core::faster_parser::binance::types {
 
@@ -36,6 +39,49 @@ namespace core::faster_parser::binance::types {
         bool is_buyer_maker;                            // Is buyer the market maker (m)
     };
 
+    /**
+     * @brief Self-contained aggregate trade with the symbol stored inline
+     * Same fields as trade_t but trivially copyable and independent of the receive buffer.
+     */
+    struct trade_owned_t {
+        trade_owned_t() = default;
+
+        explicit trade_owned_t(trade_t const &trade)
+            : symbol(symbol_t::from(trade.symbol)), time(trade.time), event_time(trade.event_time),
+              agg_trade_id(trade.agg_trade_id), price(trade.price), quantity(trade.quantity),
+              first_trade_id(trade.first_trade_id), last_trade_id(trade.last_trade_id),
+              trade_time(trade.trade_time), is_buyer_maker(trade.is_buyer_maker) {}
+
+        [[nodiscard]] trade_t view() const {
+            trade_t trade;
+            trade.time = time;
+            trade.symbol = symbol.view();
+            trade.event_time = event_time;
+            trade.agg_trade_id = agg_trade_id;
+            trade.price = price;
+            trade.quantity = quantity;
+            trade.first_trade_id = first_trade_id;
+            trade.last_trade_id = last_trade_id;
+            trade.trade_time = trade_time;
+            trade.is_buyer_maker = is_buyer_maker;
+            return trade;
+        }
+
+        symbol_t symbol;                                // Symbol (inline copy)
+        std::chrono::system_clock::time_point time;     // Reception time
+        uint64_t event_time = 0;                        // Event time (E)
+        uint64_t agg_trade_id = 0;                      // Aggregate trade ID (a)
+        double price = 0.;                              // Price (p)
+        double quantity = 0.;                           // Quantity (q)
+        uint64_t first_trade_id = 0;                    // First trade ID (f)
+        uint64_t last_trade_id = 0;                     // Last trade ID (l)
+        uint64_t trade_time = 0;                        // Trade time (T)
+        bool is_buyer_maker = false;                    // Is buyer the market maker (m)
+    };
+
+    static_assert(std::is_trivially_copyable_v<trade_owned_t>);
+    static_assert(sizeof(trade_owned_t) == 96);
+
 } // namespace core::faster_parser::binance::types
 
 #endif //FASTER_PARSER_AGG_TRADE_H
@@ -0,0 +1,115 @@
+/**
+ * @file warm.h
+ * @author Kevin Rodrigues
+ * @brief Cache and branch predictor warming with synthetic messages, for idle periods
+ * @version 1.0
+ * @date 16/10/2026
+ */
+
+#ifndef FASTER_PARSER_WARM_H
+#define FASTER_PARSER_WARM_H
+
+#include <chrono>
+#include <cstddef>
+#include <string_view>
+
+#include "faster_parser/binance/concepts.h"
+#include "faster_parser/binance/future.h"
+
+namespace core::faster_parser::binance {
+    namespace warming {
+        // Two of each type, with different symbols, number widths and flags so both sides
+        // of the data-dependent branches are taken
+        inline constexpr std::string_view book_ticker_messages[] = {
+            R"({"e":"bookTicker","u":8822354685185,"s":"BTCUSDT","b":"112233.10","B":"3.211","a":"112233.20","A":"0.451","T":1760083106580,"E":1760083106580})",
+            R"({"e":"bookTicker","u":8822354685186,"s":"1000PEPEUSDT","b":"0.0093210","B":"1200345","a":"0.0093220","A":"87","T":1760083106581,"E":1760083106581})",
+        };
+
+        inline constexpr std::string_view trade_messages[] = {
+            R"({"e":"aggTrade","E":1760083106579,"s":"BTCUSDT","a":5933014,"p":"112233.10","q":"0.015","f":100,"l":105,"T":1760083106578,"m":true})",
+            R"({"e":"aggTrade","E":1760083106580,"s":"ETHUSDT","a":5933015,"p":"4012.5","q":"12","f":106,"l":106,"T":1760083106579,"m":false})",
+        };
+
+        inline constexpr std::string_view ticker_messages[] = {
+            R"({"e":"24hrTicker","E":1760083106579,"s":"BTCUSDT","p":"-210.50","P":"-0.187","w":"112301.22","c":"112233.10","Q":"0.015","o":"112443.60","h":"113100.00","l":"111020.40","v":"184223.511","q":"20689012345.67","O":1759996706579,"C":1760083106579,"F":5800000,"L":5933014,"n":133015})",
+            R"([{"e":"24hrTicker","E":1760083106580,"s":"ETHUSDT","p":"12.5","P":"0.31","w":"4003","c":"4012.5","Q":"12","o":"4000","h":"4050","l":"3950","v":"901234","q":"3607000000","O":1759996706580,"C":1760083106580,"F":2000,"L":3000,"n":1001}])",
+        };
+
+        inline constexpr std::string_view depth_messages[] = {
+            R"({"e":"depthUpdate","E":1760083106579,"T":1760083106570,"s":"BTCUSDT","U":157,"u":160,"pu":149,"b":[["112233.10","1.5"],["112233.00","0"]],"a":[["112233.20","2.25"]]})",
+            R"({"e":"depthUpdate","E":1760083106580,"T":1760083106575,"s":"ETHUSDT","U":161,"u":161,"pu":160,"b":[],"a":[["4012.6","30"],["4012.7","0.001"],["4013","7"]]})",
+        };
+    } // namespace warming
+
+    /**
+     * @brief Listener exposing the callbacks listener_t implements, discarding every message
+     * Each callback only makes its argument observable to the compiler, so the parse work of
+     * warm() is not optimised away.
+     */
+    template<typename listener_t>
+    struct discarding_listener_t {
+        __attribute__((always_inline)) void on_book_ticker(const types::book_ticker_t &ticker)
+            requires BookTickerListener<listener_t> {
+            asm volatile("" : : "r"(&ticker) : "memory");
+        }
+
+        __attribute__((always_inline)) void on_trade(const types::trade_t &trade)
+            requires TradeListener<listener_t> {
+            asm volatile("" : : "r"(&trade) : "memory");
+        }
+
+        __attribute__((always_inline)) void on_ticker(const types::ticker_t &ticker)
+            requires TickerListener<listener_t> {
+            asm volatile("" : : "r"(&ticker) : "memory");
+        }
+
+        __attribute__((always_inline)) void on_depth_update(const types::depth_update_t &update)
+            requires DepthListener<listener_t> {
+            asm volatile("" : : "r"(&update) : "memory");
+        }
+    };
+
+    /**
+     * @brief Feed the synthetic messages of every type listener_t handles to handler(raw)
+     * For a strategy whose live path goes through a single non-inlined function: handing
+     * that function (with its callbacks disarmed) to warm() warms the exact instructions and
+     * branch history the next live message runs through.
+     * @return Number of messages fed
+     */
+    template<BinanceFutureListener listener_t, typename handler_t>
+    size_t warm_with(handler_t &&handler) {
+        size_t fed = 0;
+        auto feed = [&](auto const &messages) {
+            for (std::string_view raw : messages) {
+                handler(raw);
+                ++fed;
+            }
+        };
+        if constexpr (BookTickerListener<listener_t>) feed(warming::book_ticker_messages);
+        if constexpr (TradeListener<listener_t>) feed(warming::trade_messages);
+        if constexpr (TickerListener<listener_t>) feed(warming::ticker_messages);
+        if constexpr (DepthListener<listener_t>) feed(warming::depth_messages);
+        return fed;
+    }
+
+    /**
+     * @brief Parse the synthetic messages of every type listener_t handles, discarding them
+     * Meant for a strategy's spin loop when no message has arrived for a while: it reloads
+     * the float parsers, their tables (powers_of_10) and the scanning constants into L1/L2
+     * and retrains the branches they share with the live path. The parse routines themselves
+     * are inlined into each caller, so their instructions here are a copy of the live ones:
+     * this warms L2 and the shared code, not the live copy's L1i lines (see warm_with()).
+     * A call takes a few microseconds; keep the interval between calls well above that.
+     * @return Number of messages parsed successfully
+     */
+    template<BinanceFutureListener listener_t>
+    __attribute__((noinline)) size_t warm() {
+        discarding_listener_t<listener_t> discard;
+        const std::chrono::system_clock::time_point now{};
+        size_t parsed = 0;
+        warm_with<listener_t>([&](std::string_view raw) { parsed += binance_future_parser_t::parse(now, raw, discard); });
+        return parsed;
+    }
+} // namespace core::faster_parser::binance
+
+#endif //FASTER_PARSER_WARM_H
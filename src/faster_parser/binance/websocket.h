@@ -0,0 +1,126 @@
+/**
+ * @file websocket.h
+ * @author Kevin Rodrigues
+ * @brief Feeds WebSocket frames from a receive buffer straight into the Binance parser
+ * @version 1.0
+ * @date 16/10/2026
+ */
+
+#ifndef FASTER_PARSER_BINANCE_WEBSOCKET_H
+#define FASTER_PARSER_BINANCE_WEBSOCKET_H
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string_view>
+
+#include "faster_parser/binance/future.h"
+#include "faster_parser/websocket/frame.h"
+
+#if defined(HAS_ZLIB)
+#include "faster_parser/websocket/deflate.h"
+#endif
+
+namespace core::faster_parser::binance {
+    /**
+     * @brief Decodes WebSocket frames and parses each text message with binance_future_parser_t
+     * Payloads are parsed where they sit in the receive buffer. Control frames are forwarded to
+     * the listener when it implements on_ping(std::string_view), on_pong(std::string_view) or
+     * on_close(uint16_t, std::string_view); answering pings is up to the caller's socket code
+     * (see websocket::encode_frame).
+     * When built with zlib and permessage-deflate has been negotiated (enable_permessage_deflate),
+     * compressed messages are inflated into a reusable padded buffer, which keeps its window
+     * across messages, and parsed from there.
+     */
+    template<BinanceFutureListener listener_t>
+    class websocket_feed_t {
+    public:
+        explicit websocket_feed_t(listener_t &listener) : listener_(&listener) {}
+
+        /**
+         * @brief Decode and parse every complete frame at the front of `buffer`
+         * @return Number of bytes consumed; the remainder is an incomplete frame
+         */
+        size_t feed(std::chrono::system_clock::time_point const &now, std::span<char> buffer) {
+            handler_t handler{this, now, 0};
+            size_t consumed = decoder_.decode(buffer, handler);
+            rejected_ += handler.rejected;
+            return consumed;
+        }
+
+        void reset() {
+            decoder_.reset();
+#if defined(HAS_ZLIB)
+            if (inflater_) inflater_->reset();
+#endif
+        }
+
+#if defined(HAS_ZLIB)
+        /**
+         * @brief Accept compressed messages, with the parameters agreed in the handshake
+         * Must be called before the first frame is fed.
+         */
+        void enable_permessage_deflate(int server_max_window_bits = 15, bool server_no_context_takeover = false) {
+            inflater_.emplace(server_max_window_bits, server_no_context_takeover);
+            decoder_.set_permessage_deflate(true);
+        }
+
+        // Compressed bytes received and bytes they inflated to
+        [[nodiscard]] uint64_t compressed_bytes() const { return inflater_ ? inflater_->total_in() : 0; }
+        [[nodiscard]] uint64_t inflated_bytes() const { return inflater_ ? inflater_->total_out() : 0; }
+#endif
+
+        [[nodiscard]] bool failed() const { return decoder_.failed(); }
+
+        // Text messages the parser did not accept (unknown type, or ignored by the listener)
+        [[nodiscard]] size_t rejected() const { return rejected_; }
+
+    private:
+        struct handler_t {
+            websocket_feed_t *feed;
+            std::chrono::system_clock::time_point now;
+            size_t rejected;
+
+            __attribute__((always_inline)) void on_text(std::string_view payload) {
+                if (!binance_future_parser_t::parse(now, payload, *feed->listener_)) [[unlikely]] {
+                    ++rejected;
+                }
+            }
+
+#if defined(HAS_ZLIB)
+            void on_compressed(websocket::opcode_t opcode, std::string_view payload) {
+                std::string_view inflated;
+                if (!feed->inflater_->inflate(payload, inflated)) [[unlikely]] {
+                    // The window is lost: later messages of this connection cannot be decoded
+                    ++rejected;
+                    return;
+                }
+                if (opcode == websocket::opcode_t::text) on_text(inflated);
+            }
+#endif
+
+            void on_ping(std::string_view payload) requires requires(listener_t &l, std::string_view p) { l.on_ping(p); } {
+                feed->listener_->on_ping(payload);
+            }
+
+            void on_pong(std::string_view payload) requires requires(listener_t &l, std::string_view p) { l.on_pong(p); } {
+                feed->listener_->on_pong(payload);
+            }
+
+            void on_close(uint16_t code, std::string_view reason) requires requires(listener_t &l, uint16_t c, std::string_view r) { l.on_close(c, r); } {
+                feed->listener_->on_close(code, reason);
+            }
+        };
+
+        listener_t *listener_;
+        websocket::frame_decoder_t decoder_;
+#if defined(HAS_ZLIB)
+        std::optional<websocket::inflater_t> inflater_;
+#endif
+        size_t rejected_ = 0;
+    };
+} // namespace core::faster_parser::binance
+
+#endif //FASTER_PARSER_BINANCE_WEBSOCKET_H
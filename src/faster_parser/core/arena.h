@@ -0,0 +1,152 @@
+/**
+ * @file arena.h
+ * @author Kevin Rodrigues
+ * @brief Reusable bump allocator and arena-backed growable columns
+ * @version 1.0
+ * @date 16/10/2026
+ */
+
+#ifndef FASTER_PARSER_CORE_ARENA_H
+#define FASTER_PARSER_CORE_ARENA_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace core::faster_parser {
+    /**
+     * @brief Bump allocator over large 64-byte aligned blocks
+     * Individual allocations are never freed; reset() rewinds the arena and keeps its
+     * memory so that the next run (e.g. the next capture file) allocates nothing.
+     */
+    class arena_t {
+    public:
+        static constexpr size_t default_block_size = 1 << 20;
+        static constexpr size_t block_alignment = 64;
+
+        explicit arena_t(size_t block_size = default_block_size) : block_size_(block_size) {}
+
+        arena_t(arena_t const &) = delete;
+        arena_t &operator=(arena_t const &) = delete;
+
+        ~arena_t() {
+            for (auto &block : blocks_) {
+                ::operator delete(block.data, std::align_val_t(block_alignment));
+            }
+        }
+
+        void *allocate(size_t bytes, size_t alignment = alignof(std::max_align_t)) {
+            if (!blocks_.empty()) {
+                block_t &block = blocks_.back();
+                size_t offset = (block.used + alignment - 1) & ~(alignment - 1);
+                if (offset + bytes <= block.size) [[likely]] {
+                    block.used = offset + bytes;
+                    return block.data + offset;
+                }
+            }
+
+            size_t size = std::max(block_size_, bytes + alignment);
+            auto *data = static_cast<char *>(::operator new(size, std::align_val_t(block_alignment)));
+            blocks_.push_back({data, size, bytes});
+            return data;
+        }
+
+        template<typename T>
+        T *allocate_array(size_t count) {
+            static_assert(std::is_trivially_copyable_v<T>, "arena only holds trivially copyable types");
+            return static_cast<T *>(allocate(count * sizeof(T), std::max(alignof(T), size_t{64})));
+        }
+
+        // Rewind the arena. If the last run spilled over several blocks they are merged
+        // into a single block of the same total size, so that the next run fits in it.
+        void reset() {
+            if (blocks_.size() > 1) {
+                size_t total = capacity();
+                for (auto &block : blocks_) {
+                    ::operator delete(block.data, std::align_val_t(block_alignment));
+                }
+                blocks_.clear();
+                auto *data = static_cast<char *>(::operator new(total, std::align_val_t(block_alignment)));
+                blocks_.push_back({data, total, 0});
+            } else if (!blocks_.empty()) {
+                blocks_.front().used = 0;
+            }
+        }
+
+        [[nodiscard]] size_t capacity() const {
+            size_t total = 0;
+            for (auto const &block : blocks_) total += block.size;
+            return total;
+        }
+
+    private:
+        struct block_t {
+            char *data;
+            size_t size;
+            size_t used;
+        };
+
+        size_t block_size_;
+        std::vector<block_t> blocks_;
+    };
+
+    /**
+     * @brief Contiguous growable array whose storage comes from an arena_t
+     * Growth copies into a new arena allocation (the old one is reclaimed on reset),
+     * so sizing it with reserve() up front keeps appends allocation-free.
+     */
+    template<typename T>
+    class arena_column_t {
+    public:
+        static_assert(std::is_trivially_copyable_v<T>);
+
+        explicit arena_column_t(arena_t &arena) : arena_(&arena) {}
+
+        __attribute__((always_inline)) void push_back(T value) {
+            if (size_ == capacity_) [[unlikely]] {
+                grow(capacity_ ? capacity_ * 2 : 1024);
+            }
+            data_[size_++] = value;
+        }
+
+        void reserve(size_t capacity) {
+            if (capacity > capacity_) grow(capacity);
+        }
+
+        // Forget the contents and the storage: to be called alongside arena_t::reset()
+        void release() {
+            data_ = nullptr;
+            size_ = 0;
+            capacity_ = 0;
+        }
+
+        void clear() { size_ = 0; }
+
+        [[nodiscard]] size_t size() const { return size_; }
+        [[nodiscard]] size_t capacity() const { return capacity_; }
+        [[nodiscard]] bool empty() const { return size_ == 0; }
+        [[nodiscard]] const T *data() const { return data_; }
+        [[nodiscard]] std::span<const T> span() const { return {data_, size_}; }
+        [[nodiscard]] const T &operator[](size_t index) const { return data_[index]; }
+
+    private:
+        void grow(size_t capacity) {
+            T *data = arena_->allocate_array<T>(capacity);
+            if (size_) std::memcpy(data, data_, size_ * sizeof(T));
+            data_ = data;
+            capacity_ = capacity;
+        }
+
+        arena_t *arena_;
+        T *data_ = nullptr;
+        size_t size_ = 0;
+        size_t capacity_ = 0;
+    };
+} // namespace core::faster_parser
+
+#endif // FASTER_PARSER_CORE_ARENA_H
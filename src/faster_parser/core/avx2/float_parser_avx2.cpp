@@ -174,7 +174,7 @@ namespace core::avx2 {
             }
 
             if (all_digits) {
-                result = result * 100000000ULL + parse_8_digits(ptr);
+                result = result * 100000000ULL + parse_8_digits(std::string_view(ptr, 8));
                 ptr += 8;
             } else {
                 break;
@@ -0,0 +1,180 @@
+/**
+ * @file histogram.h
+ * @author Kevin Rodrigues
+ * @brief Fixed-memory log-linear latency histogram with merge and text / JSON export
+ * @version 1.0
+ * @date 16/10/2026
+ */
+
+#ifndef FASTER_PARSER_CORE_HISTOGRAM_H
+#define FASTER_PARSER_CORE_HISTOGRAM_H
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <limits>
+#include <string>
+#include <string_view>
+
+namespace core::faster_parser {
+    /**
+     * @brief Histogram of unsigned values with a bounded relative error (HDR-style buckets)
+     * Values below 32 get a bucket each; above, every power of two is split into 32 linear
+     * sub-buckets, so a recorded value is known to within 1/32 (~3%). Values up to 2^40 are
+     * kept (larger ones land in the last bucket), in 1152 counters (9 KB) allocated inline.
+     * record() is a bit_width, a shift and an increment.
+     *
+     * Single writer: one instance per recording thread. Counters are relaxed atomics updated
+     * with a plain load and store (no locked instruction), so another thread may merge() an
+     * instance into its own while the owner keeps recording, and read percentiles from the
+     * merged copy. A merge taken mid-update can be off by the values being recorded.
+     */
+    class latency_histogram_t {
+    public:
+        static constexpr uint32_t sub_bucket_bits = 5;
+        static constexpr uint64_t sub_bucket_count = uint64_t{1} << sub_bucket_bits;
+        static constexpr uint32_t max_value_bits = 40;
+        static constexpr size_t bucket_count = (max_value_bits - sub_bucket_bits) * sub_bucket_count + sub_bucket_count;
+
+        latency_histogram_t() = default;
+        latency_histogram_t(latency_histogram_t const &) = delete;
+        latency_histogram_t &operator=(latency_histogram_t const &) = delete;
+
+        __attribute__((always_inline)) void record(uint64_t value) {
+            add(counts_[index_of(value)], 1);
+            add(count_, 1);
+            add(sum_, value);
+            if (value < min_.load(std::memory_order_relaxed)) min_.store(value, std::memory_order_relaxed);
+            if (value > max_.load(std::memory_order_relaxed)) max_.store(value, std::memory_order_relaxed);
+        }
+
+        // Add the values of `other`, which may be recording on another thread
+        void merge(latency_histogram_t const &other) {
+            uint64_t count = 0;
+            for (size_t i = 0; i < bucket_count; ++i) {
+                const uint64_t bucket = other.counts_[i].load(std::memory_order_relaxed);
+                add(counts_[i], bucket);
+                count += bucket;
+            }
+            if (count == 0) return;
+            add(count_, count);
+            add(sum_, other.sum_.load(std::memory_order_relaxed));
+            min_.store(std::min(min_.load(std::memory_order_relaxed), other.min_.load(std::memory_order_relaxed)), std::memory_order_relaxed);
+            max_.store(std::max(max_.load(std::memory_order_relaxed), other.max_.load(std::memory_order_relaxed)), std::memory_order_relaxed);
+        }
+
+        // Smallest recorded value v such that at least `percentile` % of the values are <= v,
+        // up to the bucket resolution (reported as the bucket's upper bound, capped at max())
+        [[nodiscard]] uint64_t percentile(double percentile) const {
+            const uint64_t total = count();
+            if (total == 0) return 0;
+            const double clamped = std::clamp(percentile, 0., 100.);
+            const auto rank = std::max<uint64_t>(1, static_cast<uint64_t>(clamped / 100. * static_cast<double>(total) + 0.5));
+            uint64_t seen = 0;
+            for (size_t i = 0; i < bucket_count; ++i) {
+                seen += counts_[i].load(std::memory_order_relaxed);
+                if (seen >= rank) return std::clamp(upper_bound_of(i), min(), max());
+            }
+            return max();
+        }
+
+        [[nodiscard]] uint64_t count() const { return count_.load(std::memory_order_relaxed); }
+        [[nodiscard]] uint64_t min() const { return count() ? min_.load(std::memory_order_relaxed) : 0; }
+        [[nodiscard]] uint64_t max() const { return max_.load(std::memory_order_relaxed); }
+        [[nodiscard]] double mean() const {
+            const uint64_t total = count();
+            return total ? static_cast<double>(sum_.load(std::memory_order_relaxed)) / static_cast<double>(total) : 0.;
+        }
+
+        void reset() {
+            for (auto &bucket : counts_) bucket.store(0, std::memory_order_relaxed);
+            count_.store(0, std::memory_order_relaxed);
+            sum_.store(0, std::memory_order_relaxed);
+            min_.store(std::numeric_limits<uint64_t>::max(), std::memory_order_relaxed);
+            max_.store(0, std::memory_order_relaxed);
+        }
+
+        // ====================================================================
+        // Export. Values are multiplied by `scale` (e.g. ns per counter tick).
+        // ====================================================================
+
+        // name count=1000 min=1 p50=500 p90=900 p99=990 p99.9=1000 max=1000 mean=500.5 [unit]
+        [[nodiscard]] std::string to_text(std::string_view name, double scale = 1., std::string_view unit = {}) const {
+            std::string out(name);
+            append_summary(out, scale, " ", "=", "");
+            if (!unit.empty()) {
+                out += ' ';
+                out += unit;
+            }
+            return out;
+        }
+
+        // {"count":1000,"min":1,"p50":500,"p90":900,"p99":990,"p99.9":1000,"max":1000,"mean":500.5}
+        [[nodiscard]] std::string to_json(double scale = 1.) const {
+            std::string out = "{";
+            append_summary(out, scale, ",", ":", "\"");
+            out.erase(1, 1);                                // Leading separator
+            out += '}';
+            return out;
+        }
+
+        // fn(upper_bound, count) for every non-empty bucket, in increasing value order
+        template<typename fn_t>
+        void for_each_bucket(fn_t &&fn) const {
+            for (size_t i = 0; i < bucket_count; ++i) {
+                const uint64_t bucket = counts_[i].load(std::memory_order_relaxed);
+                if (bucket) fn(upper_bound_of(i), bucket);
+            }
+        }
+
+        [[nodiscard]] static __attribute__((always_inline)) size_t index_of(uint64_t value) {
+            if (value < sub_bucket_count) return static_cast<size_t>(value);
+            const uint32_t shift = std::min<uint32_t>(static_cast<uint32_t>(std::bit_width(value)) - 1, max_value_bits - 1) - sub_bucket_bits;
+            const uint64_t mantissa = std::min<uint64_t>(value >> shift, 2 * sub_bucket_count - 1);
+            return static_cast<size_t>(shift * sub_bucket_count + mantissa);
+        }
+
+        // Largest value that maps to bucket `index`
+        [[nodiscard]] static uint64_t upper_bound_of(size_t index) {
+            if (index < sub_bucket_count) return index;
+            const uint64_t shift = index / sub_bucket_count - 1;
+            const uint64_t mantissa = index - shift * sub_bucket_count;
+            return ((mantissa + 1) << shift) - 1;
+        }
+
+    private:
+        // Single-writer increment: no read-modify-write instruction
+        static __attribute__((always_inline)) void add(std::atomic<uint64_t> &counter, uint64_t value) {
+            counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+        }
+
+        void append_summary(std::string &out, double scale, const char *separator, const char *assign, const char *quote) const {
+            char buffer[64];
+            auto field = [&](const char *key, double value, bool integral) {
+                const int n = integral ? std::snprintf(buffer, sizeof(buffer), "%s%s%s%s%s%.0f", separator, quote, key, quote, assign, value)
+                                       : std::snprintf(buffer, sizeof(buffer), "%s%s%s%s%s%.1f", separator, quote, key, quote, assign, value);
+                out.append(buffer, static_cast<size_t>(n));
+            };
+            field("count", static_cast<double>(count()), true);
+            field("min", static_cast<double>(min()) * scale, true);
+            field("p50", static_cast<double>(percentile(50.)) * scale, true);
+            field("p90", static_cast<double>(percentile(90.)) * scale, true);
+            field("p99", static_cast<double>(percentile(99.)) * scale, true);
+            field("p99.9", static_cast<double>(percentile(99.9)) * scale, true);
+            field("max", static_cast<double>(max()) * scale, true);
+            field("mean", mean() * scale, false);
+        }
+
+        std::array<std::atomic<uint64_t>, bucket_count> counts_{};
+        std::atomic<uint64_t> count_ = 0;
+        std::atomic<uint64_t> sum_ = 0;
+        std::atomic<uint64_t> min_ = std::numeric_limits<uint64_t>::max();
+        std::atomic<uint64_t> max_ = 0;
+    };
+} // namespace core::faster_parser
+
+#endif //FASTER_PARSER_CORE_HISTOGRAM_H
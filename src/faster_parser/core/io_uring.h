@@ -0,0 +1,204 @@
+/**
+ * @file io_uring.h
+ * @author Kevin Rodrigues
+ * @brief Minimal io_uring ring with a provided buffer ring, on raw system calls
+ * @version 1.0
+ * @date 16/10/2026
+ */
+
+#ifndef FASTER_PARSER_CORE_IO_URING_H
+#define FASTER_PARSER_CORE_IO_URING_H
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace core::faster_parser {
+    /**
+     * @brief Single-threaded io_uring instance (no liburing dependency)
+     * Covers what the ingest loop needs: one submission queue, the completion queue and one
+     * kernel-provided buffer ring (IORING_REGISTER_PBUF_RING, Linux 5.19+). Must only be used
+     * from the thread that created it.
+     */
+    class io_uring_t {
+    public:
+        io_uring_t() = default;
+        io_uring_t(io_uring_t const &) = delete;
+        io_uring_t &operator=(io_uring_t const &) = delete;
+
+        ~io_uring_t() { close(); }
+
+        // Returns false if io_uring is unavailable (old kernel, seccomp, io_uring_disabled)
+        bool init(unsigned entries) {
+            close();
+
+            io_uring_params params{};
+            // Completions are only run when we ask for them: fewer interrupts, same thread
+            params.flags = IORING_SETUP_SINGLE_ISSUER | IORING_SETUP_DEFER_TASKRUN;
+            fd_ = static_cast<int>(::syscall(__NR_io_uring_setup, entries, &params));
+            if (fd_ < 0 && errno == EINVAL) {
+                params = io_uring_params{};
+                fd_ = static_cast<int>(::syscall(__NR_io_uring_setup, entries, &params));
+            }
+            if (fd_ < 0) return false;
+            if (!(params.features & IORING_FEAT_SINGLE_MMAP)) return fail();
+
+            ring_size_ = std::max<size_t>(params.sq_off.array + params.sq_entries * sizeof(unsigned),
+                                          params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe));
+            void *ring = ::mmap(nullptr, ring_size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd_, IORING_OFF_SQ_RING);
+            if (ring == MAP_FAILED) return fail();
+            ring_ = static_cast<char *>(ring);
+
+            sqes_size_ = params.sq_entries * sizeof(io_uring_sqe);
+            void *sqes = ::mmap(nullptr, sqes_size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd_, IORING_OFF_SQES);
+            if (sqes == MAP_FAILED) return fail();
+            sqes_ = static_cast<io_uring_sqe *>(sqes);
+
+            sq_head_ = reinterpret_cast<unsigned *>(ring_ + params.sq_off.head);
+            sq_tail_ = reinterpret_cast<unsigned *>(ring_ + params.sq_off.tail);
+            sq_mask_ = *reinterpret_cast<unsigned *>(ring_ + params.sq_off.ring_mask);
+            sq_entries_ = params.sq_entries;
+            cq_head_ = reinterpret_cast<unsigned *>(ring_ + params.cq_off.head);
+            cq_tail_ = reinterpret_cast<unsigned *>(ring_ + params.cq_off.tail);
+            cq_mask_ = *reinterpret_cast<unsigned *>(ring_ + params.cq_off.ring_mask);
+            cqes_ = reinterpret_cast<io_uring_cqe *>(ring_ + params.cq_off.cqes);
+
+            // Identity mapping: SQE i always sits in slot i
+            auto *array = reinterpret_cast<unsigned *>(ring_ + params.sq_off.array);
+            for (unsigned i = 0; i < sq_entries_; ++i) array[i] = i;
+
+            sqe_tail_ = *sq_tail_;
+            submitted_ = sqe_tail_;
+            return true;
+        }
+
+        void close() {
+            if (buf_ring_) ::munmap(buf_ring_, buf_ring_size_);
+            if (sqes_) ::munmap(sqes_, sqes_size_);
+            if (ring_) ::munmap(ring_, ring_size_);
+            if (fd_ >= 0) ::close(fd_);
+            buf_ring_ = nullptr;
+            sqes_ = nullptr;
+            ring_ = nullptr;
+            fd_ = -1;
+        }
+
+        [[nodiscard]] bool is_open() const { return fd_ >= 0; }
+
+        // Next free SQE, zeroed, or nullptr if the submission queue is full
+        io_uring_sqe *get_sqe() {
+            const unsigned head = std::atomic_ref<unsigned>(*sq_head_).load(std::memory_order_acquire);
+            if (sqe_tail_ - head >= sq_entries_) return nullptr;
+            io_uring_sqe *sqe = &sqes_[sqe_tail_ & sq_mask_];
+            std::memset(sqe, 0, sizeof(*sqe));
+            ++sqe_tail_;
+            return sqe;
+        }
+
+        /**
+         * @brief Submit pending SQEs and run completions, blocking until `wait_nr` are available
+         * @return false on a system call error other than EINTR
+         */
+        bool submit(unsigned wait_nr = 0) {
+            std::atomic_ref<unsigned>(*sq_tail_).store(sqe_tail_, std::memory_order_release);
+            const unsigned to_submit = sqe_tail_ - submitted_;
+            int ret = static_cast<int>(::syscall(__NR_io_uring_enter, fd_, to_submit, wait_nr, IORING_ENTER_GETEVENTS, nullptr, 0));
+            if (ret < 0) return errno == EINTR;
+            submitted_ += static_cast<unsigned>(ret);
+            return true;
+        }
+
+        // Call `handler(io_uring_cqe const &)` for every available completion, then release them
+        template<typename handler_t>
+        unsigned for_each_cqe(handler_t &&handler) {
+            unsigned head = *cq_head_;
+            const unsigned tail = std::atomic_ref<unsigned>(*cq_tail_).load(std::memory_order_acquire);
+            const unsigned count = tail - head;
+            for (; head != tail; ++head) {
+                handler(cqes_[head & cq_mask_]);
+            }
+            std::atomic_ref<unsigned>(*cq_head_).store(head, std::memory_order_release);
+            return count;
+        }
+
+        /**
+         * @brief Register a provided buffer ring of `entries` (a power of two) slots as group `group`
+         * Buffers are handed to the kernel with add_buffer() + publish_buffers(); receives with
+         * IOSQE_BUFFER_SELECT pick one and report its id in the completion flags.
+         */
+        bool setup_buffer_ring(unsigned entries, uint16_t group) {
+            buf_ring_size_ = entries * sizeof(io_uring_buf);
+            void *mem = ::mmap(nullptr, buf_ring_size_, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_POPULATE, -1, 0);
+            if (mem == MAP_FAILED) return false;
+            buf_ring_ = static_cast<io_uring_buf_ring *>(mem);
+
+            io_uring_buf_reg reg{};
+            reg.ring_addr = reinterpret_cast<uint64_t>(mem);
+            reg.ring_entries = entries;
+            reg.bgid = group;
+            if (::syscall(__NR_io_uring_register, fd_, IORING_REGISTER_PBUF_RING, &reg, 1) != 0) {
+                ::munmap(mem, buf_ring_size_);
+                buf_ring_ = nullptr;
+                return false;
+            }
+            buf_ring_mask_ = entries - 1;
+            buf_tail_ = 0;
+            return true;
+        }
+
+        // Queue a buffer for the kernel; visible after publish_buffers()
+        __attribute__((always_inline)) void add_buffer(char *data, unsigned length, uint16_t id) {
+            // Not buf_ring_->bufs: compiled as C++, the uapi flexible array sits after a 1-byte
+            // empty struct and is misplaced. Slots are plain io_uring_buf entries from offset 0.
+            io_uring_buf &slot = reinterpret_cast<io_uring_buf *>(buf_ring_)[buf_tail_ & buf_ring_mask_];
+            slot.addr = reinterpret_cast<uint64_t>(data);
+            slot.len = length;
+            slot.bid = id;
+            ++buf_tail_;
+        }
+
+        __attribute__((always_inline)) void publish_buffers() {
+            std::atomic_ref<uint16_t>(buf_ring_->tail).store(buf_tail_, std::memory_order_release);
+        }
+
+    private:
+        bool fail() {
+            close();
+            return false;
+        }
+
+        int fd_ = -1;
+        char *ring_ = nullptr;
+        size_t ring_size_ = 0;
+        io_uring_sqe *sqes_ = nullptr;
+        size_t sqes_size_ = 0;
+
+        unsigned *sq_head_ = nullptr;
+        unsigned *sq_tail_ = nullptr;
+        unsigned sq_mask_ = 0;
+        unsigned sq_entries_ = 0;
+        unsigned sqe_tail_ = 0;   // Local tail, published on submit()
+        unsigned submitted_ = 0;
+
+        unsigned *cq_head_ = nullptr;
+        unsigned *cq_tail_ = nullptr;
+        unsigned cq_mask_ = 0;
+        io_uring_cqe *cqes_ = nullptr;
+
+        io_uring_buf_ring *buf_ring_ = nullptr;
+        size_t buf_ring_size_ = 0;
+        unsigned buf_ring_mask_ = 0;
+        uint16_t buf_tail_ = 0;
+    };
+} // namespace core::faster_parser
+
+#endif // FASTER_PARSER_CORE_IO_URING_H
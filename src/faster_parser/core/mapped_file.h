@@ -0,0 +1,114 @@
+/**
+ * @file mapped_file.h
+ * @author Kevin Rodrigues
+ * @brief Read-only memory mapping of a capture file
+ * @version 1.0
+ * @date 16/10/2026
+ */
+
+#ifndef FASTER_PARSER_CORE_MAPPED_FILE_H
+#define FASTER_PARSER_CORE_MAPPED_FILE_H
+
+#include <cstddef>
+#include <string_view>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace core::faster_parser {
+    /**
+     * @brief Maps a whole file read-only and advises the kernel it will be read front to back
+     * MADV_SEQUENTIAL doubles read-ahead and drops pages behind the reader. Where supported,
+     * MADV_HUGEPAGE is requested as well; the kernel ignores it for file systems without
+     * huge page support, so it is best effort only.
+     */
+    class mapped_file_t {
+    public:
+        mapped_file_t() = default;
+
+        explicit mapped_file_t(const char *path, bool huge_pages = true) {
+            open(path, huge_pages);
+        }
+
+        mapped_file_t(mapped_file_t const &) = delete;
+        mapped_file_t &operator=(mapped_file_t const &) = delete;
+
+        mapped_file_t(mapped_file_t &&other) noexcept
+            : data_(std::exchange(other.data_, nullptr)), size_(std::exchange(other.size_, 0)),
+              opened_empty_(std::exchange(other.opened_empty_, false)) {}
+
+        mapped_file_t &operator=(mapped_file_t &&other) noexcept {
+            if (this != &other) {
+                close();
+                data_ = std::exchange(other.data_, nullptr);
+                size_ = std::exchange(other.size_, 0);
+                opened_empty_ = std::exchange(other.opened_empty_, false);
+            }
+            return *this;
+        }
+
+        ~mapped_file_t() { close(); }
+
+        // Map the file. Returns false if it cannot be opened or mapped; an empty file maps
+        // successfully to an empty view.
+        bool open(const char *path, bool huge_pages = true) {
+            close();
+
+            int fd = ::open(path, O_RDONLY);
+            if (fd < 0) return false;
+
+            struct stat st{};
+            if (::fstat(fd, &st) != 0) {
+                ::close(fd);
+                return false;
+            }
+
+            size_ = static_cast<size_t>(st.st_size);
+            if (size_ == 0) {
+                ::close(fd);
+                opened_empty_ = true;
+                return true;
+            }
+
+            void *data = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+            ::close(fd);
+            if (data == MAP_FAILED) {
+                size_ = 0;
+                return false;
+            }
+
+            data_ = static_cast<const char *>(data);
+            ::madvise(data, size_, MADV_SEQUENTIAL);
+#if defined(MADV_HUGEPAGE)
+            if (huge_pages) ::madvise(data, size_, MADV_HUGEPAGE);
+#else
+            (void) huge_pages;
+#endif
+            return true;
+        }
+
+        void close() {
+            if (data_) {
+                ::munmap(const_cast<char *>(data_), size_);
+            }
+            data_ = nullptr;
+            size_ = 0;
+            opened_empty_ = false;
+        }
+
+        [[nodiscard]] bool is_open() const { return data_ != nullptr || opened_empty_; }
+        [[nodiscard]] size_t size() const { return size_; }
+        [[nodiscard]] const char *data() const { return data_; }
+        [[nodiscard]] std::string_view view() const { return {data_, size_}; }
+
+    private:
+        const char *data_ = nullptr;
+        size_t size_ = 0;
+        bool opened_empty_ = false;
+    };
+} // namespace core::faster_parser
+
+#endif // FASTER_PARSER_CORE_MAPPED_FILE_H
@@ -0,0 +1,343 @@
+/**
+ * @file shm_ring.h
+ * @author Kevin Rodrigues
+ * @brief Single-writer broadcast ring in POSIX shared memory with sequence-numbered slots
+ * @version 1.0
+ * @date 16/10/2026
+ */
+
+#ifndef FASTER_PARSER_CORE_SHM_RING_H
+#define FASTER_PARSER_CORE_SHM_RING_H
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <string>
+#include <type_traits>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace core::faster_parser {
+    namespace shm_detail {
+        constexpr uint64_t magic = 0x46505348'4D524E47ULL;    // "FPSHMRNG"
+        constexpr uint32_t version = 1;
+        constexpr size_t max_readers = 32;
+
+        // One line per reader: the writer polls these to find slow readers
+        struct alignas(64) reader_entry_t {
+            std::atomic<int32_t> pid{0};                    // 0: free
+            std::atomic<uint64_t> position{0};              // Next position the reader will read
+        };
+
+        struct alignas(64) header_t {
+            std::atomic<uint64_t> magic{0};                 // Stored last, once the ring is initialised
+            uint32_t version = 0;
+            uint32_t slot_size = 0;
+            uint64_t capacity = 0;
+
+            alignas(64) std::atomic<uint64_t> write_position{0};
+
+            reader_entry_t readers[max_readers];
+        };
+
+        /**
+         * Slot sequence for position p: 2p+1 while the writer fills it, 2p+2 once complete.
+         * The payload starts on the next cache line so the sequence word is the only thing a
+         * reader spins on.
+         */
+        template<typename payload_t>
+        struct alignas(64) slot_t {
+            std::atomic<uint64_t> sequence{0};
+            alignas(64) payload_t payload;
+        };
+
+        template<typename payload_t>
+        constexpr size_t mapping_size(size_t capacity) {
+            return sizeof(header_t) + capacity * sizeof(slot_t<payload_t>);
+        }
+
+        static_assert(std::atomic<uint64_t>::is_always_lock_free, "slot sequences must be address-free");
+    } // namespace shm_detail
+
+    /**
+     * @brief Writer side of a shared-memory broadcast ring
+     * Creates a POSIX shared memory object that any number of processes can map with
+     * shm_ring_reader_t. The writer never waits for readers: it overwrites the oldest slot,
+     * and a reader that falls a whole ring behind detects it on its next read. Readers report
+     * their position in the header, so the writer side can list slow or stuck readers.
+     * Only one writer per ring.
+     */
+    template<typename payload_t>
+    class shm_ring_writer_t {
+        static_assert(std::is_trivially_copyable_v<payload_t>, "payloads are copied across processes");
+
+        using slot_t = shm_detail::slot_t<payload_t>;
+
+    public:
+        shm_ring_writer_t() = default;
+        shm_ring_writer_t(shm_ring_writer_t const &) = delete;
+        shm_ring_writer_t &operator=(shm_ring_writer_t const &) = delete;
+
+        ~shm_ring_writer_t() { close(); }
+
+        /**
+         * @brief Create (or replace) the shared memory object `name` ("/something")
+         * Capacity is rounded up to a power of two.
+         * @return false if the object cannot be created, sized or mapped
+         */
+        bool create(const char *name, size_t capacity) {
+            close();
+            capacity = std::bit_ceil(capacity < 2 ? size_t{2} : capacity);
+            const size_t size = shm_detail::mapping_size<payload_t>(capacity);
+
+            ::shm_unlink(name);
+            int fd = ::shm_open(name, O_CREAT | O_EXCL | O_RDWR, 0600);
+            if (fd < 0) return false;
+            if (::ftruncate(fd, static_cast<off_t>(size)) != 0) {
+                ::close(fd);
+                ::shm_unlink(name);
+                return false;
+            }
+            void *memory = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, 0);
+            ::close(fd);
+            if (memory == MAP_FAILED) {
+                ::shm_unlink(name);
+                return false;
+            }
+
+            name_ = name;
+            size_ = size;
+            mask_ = capacity - 1;
+            position_ = 0;
+            header_ = new (memory) shm_detail::header_t();
+            header_->version = shm_detail::version;
+            header_->slot_size = sizeof(slot_t);
+            header_->capacity = capacity;
+            slots_ = reinterpret_cast<slot_t *>(static_cast<char *>(memory) + sizeof(shm_detail::header_t));
+            for (size_t i = 0; i < capacity; ++i) new (&slots_[i]) slot_t();
+            header_->magic.store(shm_detail::magic, std::memory_order_release);
+            return true;
+        }
+
+        // Unmap and remove the shared memory object; attached readers keep their mapping
+        void close() {
+            if (!header_) return;
+            ::munmap(header_, size_);
+            ::shm_unlink(name_.c_str());
+            header_ = nullptr;
+            slots_ = nullptr;
+        }
+
+        /**
+         * @brief Fill the next slot in place with `fn(payload_t &)` and make it visible
+         * The slot may still hold an old payload: fn must write every field it relies on.
+         */
+        template<typename fn_t>
+        __attribute__((always_inline)) void publish(fn_t &&fn) {
+            slot_t &slot = slots_[position_ & mask_];
+            slot.sequence.store(2 * position_ + 1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+            fn(slot.payload);
+            slot.sequence.store(2 * position_ + 2, std::memory_order_release);
+            header_->write_position.store(++position_, std::memory_order_release);
+        }
+
+        __attribute__((always_inline)) void push(payload_t const &payload) {
+            publish([&payload](payload_t &slot) { slot = payload; });
+        }
+
+        /**
+         * @brief Call `fn(pid, lag)` for every attached reader
+         * The lag is how many events the reader is behind, as of its last read call.
+         */
+        template<typename fn_t>
+        void for_each_reader(fn_t &&fn) const {
+            for (auto const &entry : header_->readers) {
+                const int32_t pid = entry.pid.load(std::memory_order_acquire);
+                if (pid == 0) continue;
+                const uint64_t position = entry.position.load(std::memory_order_relaxed);
+                fn(pid, position < position_ ? position_ - position : uint64_t{0});
+            }
+        }
+
+        // Readers more than `max_lag` events behind; above capacity() they are losing events
+        [[nodiscard]] size_t slow_readers(uint64_t max_lag) const {
+            size_t count = 0;
+            for_each_reader([&](int32_t, uint64_t lag) { count += lag > max_lag; });
+            return count;
+        }
+
+        [[nodiscard]] size_t readers() const {
+            size_t count = 0;
+            for_each_reader([&](int32_t, uint64_t) { ++count; });
+            return count;
+        }
+
+        [[nodiscard]] bool is_open() const { return header_ != nullptr; }
+        [[nodiscard]] size_t capacity() const { return mask_ + 1; }
+        [[nodiscard]] uint64_t position() const { return position_; }
+
+    private:
+        std::string name_;
+        shm_detail::header_t *header_ = nullptr;
+        slot_t *slots_ = nullptr;
+        size_t size_ = 0;
+        uint64_t mask_ = 0;
+        uint64_t position_ = 0;
+    };
+
+    /**
+     * @brief Reader side of a shared-memory broadcast ring
+     * Wait-free: a read is one sequence load, a copy and a second sequence load, whatever
+     * the writer does. A read that finds its slot overwritten (the reader was lapped) jumps
+     * to the writer's current position; the events skipped are counted in lost().
+     * Each reader registers in one of the header's reader entries, which lets the writer
+     * monitor its lag. One reader object per thread.
+     */
+    template<typename payload_t>
+    class shm_ring_reader_t {
+        static_assert(std::is_trivially_copyable_v<payload_t>, "payloads are copied across processes");
+
+        using slot_t = shm_detail::slot_t<payload_t>;
+
+    public:
+        shm_ring_reader_t() = default;
+        shm_ring_reader_t(shm_ring_reader_t const &) = delete;
+        shm_ring_reader_t &operator=(shm_ring_reader_t const &) = delete;
+
+        ~shm_ring_reader_t() { close(); }
+
+        /**
+         * @brief Map an existing ring and start reading at the writer's current position
+         * @return false if the object does not exist, is still being created, or holds a
+         * different payload type or layout version
+         */
+        bool open(const char *name) {
+            close();
+            int fd = ::shm_open(name, O_RDWR, 0);
+            if (fd < 0) return false;
+
+            struct stat st{};
+            if (::fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < sizeof(shm_detail::header_t)) {
+                ::close(fd);
+                return false;
+            }
+            size_ = static_cast<size_t>(st.st_size);
+            void *memory = ::mmap(nullptr, size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, 0);
+            ::close(fd);
+            if (memory == MAP_FAILED) return false;
+
+            header_ = static_cast<shm_detail::header_t *>(memory);
+            if (header_->magic.load(std::memory_order_acquire) != shm_detail::magic ||
+                header_->version != shm_detail::version || header_->slot_size != sizeof(slot_t) ||
+                shm_detail::mapping_size<payload_t>(header_->capacity) != size_) {
+                ::munmap(memory, size_);
+                header_ = nullptr;
+                return false;
+            }
+
+            slots_ = reinterpret_cast<slot_t *>(static_cast<char *>(memory) + sizeof(shm_detail::header_t));
+            mask_ = header_->capacity - 1;
+            position_ = header_->write_position.load(std::memory_order_acquire);
+            lost_ = 0;
+            overruns_ = 0;
+
+            const auto pid = static_cast<int32_t>(::getpid());
+            for (auto &entry : header_->readers) {
+                int32_t free = 0;
+                if (entry.pid.compare_exchange_strong(free, pid, std::memory_order_acq_rel)) {
+                    entry.position.store(position_, std::memory_order_relaxed);
+                    entry_ = &entry;
+                    break;
+                }
+            }
+            return true;
+        }
+
+        void close() {
+            if (!header_) return;
+            if (entry_) entry_->pid.store(0, std::memory_order_release);
+            ::munmap(header_, size_);
+            header_ = nullptr;
+            slots_ = nullptr;
+            entry_ = nullptr;
+        }
+
+        /**
+         * @brief Call `fn(payload_t const &)` on up to `max` new events, oldest first
+         * @return Number of events delivered
+         */
+        template<typename fn_t>
+        __attribute__((always_inline)) size_t poll(fn_t &&fn, size_t max = SIZE_MAX) {
+            size_t count = 0;
+            payload_t copy;
+            while (count < max && read(copy)) {
+                fn(static_cast<payload_t const &>(copy));
+                ++count;
+            }
+            if (entry_) entry_->position.store(position_, std::memory_order_relaxed);
+            return count;
+        }
+
+        __attribute__((always_inline)) bool try_read(payload_t &out) {
+            const bool got = read(out);
+            if (entry_) entry_->position.store(position_, std::memory_order_relaxed);
+            return got;
+        }
+
+        [[nodiscard]] bool is_open() const { return header_ != nullptr; }
+        [[nodiscard]] bool registered() const { return entry_ != nullptr; }
+        [[nodiscard]] size_t capacity() const { return mask_ + 1; }
+        [[nodiscard]] uint64_t position() const { return position_; }
+
+        // Events published but not read yet
+        [[nodiscard]] uint64_t lag() const {
+            return header_->write_position.load(std::memory_order_acquire) - position_;
+        }
+
+        // Events skipped because the writer lapped this reader, and how many times it did
+        [[nodiscard]] uint64_t lost() const { return lost_; }
+        [[nodiscard]] uint64_t overruns() const { return overruns_; }
+
+    private:
+        __attribute__((always_inline)) bool read(payload_t &out) {
+            slot_t const &slot = slots_[position_ & mask_];
+            const uint64_t expected = 2 * position_ + 2;
+
+            const uint64_t before = slot.sequence.load(std::memory_order_acquire);
+            if (before < expected) return false;            // Not written yet, or being written
+            if (before == expected) [[likely]] {
+                std::memcpy(static_cast<void *>(&out), &slot.payload, sizeof(payload_t));
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (slot.sequence.load(std::memory_order_relaxed) == expected) [[likely]] {
+                    ++position_;
+                    return true;
+                }
+            }
+
+            // Overwritten before or while we copied it: skip to the writer
+            const uint64_t head = header_->write_position.load(std::memory_order_acquire);
+            lost_ += head - position_;
+            ++overruns_;
+            position_ = head;
+            return false;
+        }
+
+        shm_detail::header_t *header_ = nullptr;
+        slot_t const *slots_ = nullptr;
+        shm_detail::reader_entry_t *entry_ = nullptr;
+        size_t size_ = 0;
+        uint64_t mask_ = 0;
+        uint64_t position_ = 0;
+        uint64_t lost_ = 0;
+        uint64_t overruns_ = 0;
+    };
+} // namespace core::faster_parser
+
+#endif // FASTER_PARSER_CORE_SHM_RING_H
@@ -0,0 +1,153 @@
+/**
+ * @file spsc_ring.h
+ * @author Kevin Rodrigues
+ * @brief Lock-free single-producer single-consumer ring of fixed-size slots
+ * @version 1.0
+ * @date 16/10/2026
+ */
+
+#ifndef FASTER_PARSER_CORE_SPSC_RING_H
+#define FASTER_PARSER_CORE_SPSC_RING_H
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <type_traits>
+
+namespace core::faster_parser {
+    /**
+     * @brief Bounded SPSC queue of trivially copyable slots, written in place by the producer
+     * The producer fills slots directly (next_slot() + commit()) and makes everything committed
+     * so far visible with one release store in publish(), so a batch of events costs one shared
+     * cache line write. The consumer drains everything published in one call and releases the
+     * slots with one store as well. Each side keeps a cached copy of the other side's index and
+     * only reads the shared one when the cache says the ring is full (or empty). Producer,
+     * consumer and shared indices sit on separate cache lines.
+     */
+    template<typename slot_t>
+    class spsc_ring_t {
+        static_assert(std::is_trivially_copyable_v<slot_t>, "slots are copied between threads with plain stores");
+
+    public:
+        static constexpr size_t cache_line = 64;
+
+        // Capacity is rounded up to a power of two
+        explicit spsc_ring_t(size_t capacity)
+            : capacity_(std::bit_ceil(capacity < 2 ? size_t{2} : capacity)), mask_(capacity_ - 1),
+              slots_(std::make_unique<slot_t[]>(capacity_)) {}
+
+        spsc_ring_t(spsc_ring_t const &) = delete;
+        spsc_ring_t &operator=(spsc_ring_t const &) = delete;
+
+        // ====================================================================
+        // Producer
+        // ====================================================================
+
+        // Slot to fill next, or nullptr if the ring is full. Invisible to the consumer until
+        // commit() and publish().
+        __attribute__((always_inline)) slot_t *next_slot() {
+            if (producer_.write - producer_.cached_read == capacity_) [[unlikely]] {
+                producer_.cached_read = consumer_read_.value.load(std::memory_order_acquire);
+                if (producer_.write - producer_.cached_read == capacity_) return nullptr;
+            }
+            return &slots_[producer_.write & mask_];
+        }
+
+        __attribute__((always_inline)) void commit() { ++producer_.write; }
+
+        // Make every committed slot visible to the consumer
+        __attribute__((always_inline)) void publish() {
+            published_write_.value.store(producer_.write, std::memory_order_release);
+        }
+
+        // Copy `slot` in and commit it; publish() is still required
+        __attribute__((always_inline)) bool try_push(slot_t const &slot) {
+            slot_t *target = next_slot();
+            if (!target) [[unlikely]] return false;
+            *target = slot;
+            commit();
+            return true;
+        }
+
+        // Committed but not yet published slots
+        [[nodiscard]] size_t unpublished() const {
+            return producer_.write - published_write_.value.load(std::memory_order_relaxed);
+        }
+
+        // ====================================================================
+        // Consumer
+        // ====================================================================
+
+        /**
+         * @brief Call `fn(slot_t const &)` on up to `max` published slots, oldest first
+         * The slots are handed back to the producer once all of them have been processed.
+         * @return Number of slots consumed
+         */
+        template<typename fn_t>
+        __attribute__((always_inline)) size_t consume(fn_t &&fn, size_t max = std::numeric_limits<size_t>::max()) {
+            size_t read = consumer_.read;
+            if (consumer_.cached_write == read) {
+                consumer_.cached_write = published_write_.value.load(std::memory_order_acquire);
+                if (consumer_.cached_write == read) return 0;
+            }
+
+            const size_t available = consumer_.cached_write - read;
+            const size_t count = available < max ? available : max;
+            for (size_t i = 0; i < count; ++i) {
+                fn(static_cast<slot_t const &>(slots_[(read + i) & mask_]));
+            }
+
+            consumer_.read = read + count;
+            consumer_read_.value.store(consumer_.read, std::memory_order_release);
+            return count;
+        }
+
+        __attribute__((always_inline)) bool try_pop(slot_t &out) {
+            return consume([&out](slot_t const &slot) { out = slot; }, 1) == 1;
+        }
+
+        // ====================================================================
+        // Either side
+        // ====================================================================
+
+        [[nodiscard]] size_t capacity() const { return capacity_; }
+
+        // Published slots not yet consumed; a snapshot when called concurrently
+        [[nodiscard]] size_t size() const {
+            return published_write_.value.load(std::memory_order_acquire) - consumer_read_.value.load(std::memory_order_acquire);
+        }
+
+        [[nodiscard]] bool empty() const { return size() == 0; }
+
+    private:
+        struct alignas(cache_line) padded_index_t {
+            std::atomic<size_t> value{0};
+        };
+
+        // Producer-owned line
+        struct alignas(cache_line) producer_state_t {
+            size_t write = 0;
+            size_t cached_read = 0;
+        };
+
+        // Consumer-owned line
+        struct alignas(cache_line) consumer_state_t {
+            size_t read = 0;
+            size_t cached_write = 0;
+        };
+
+        const size_t capacity_;
+        const size_t mask_;
+        std::unique_ptr<slot_t[]> slots_;
+
+        producer_state_t producer_;
+        padded_index_t published_write_;
+        padded_index_t consumer_read_;
+        consumer_state_t consumer_;
+    };
+} // namespace core::faster_parser
+
+#endif // FASTER_PARSER_CORE_SPSC_RING_H
@@ -0,0 +1,131 @@
+/**
+ * @file tsc.h
+ * @author Kevin Rodrigues
+ * @brief Hardware timestamp counter reads (rdtsc, cntvct_el0) calibrated to nanoseconds
+ * @version 1.0
+ * @date 16/10/2026
+ */
+
+#ifndef FASTER_PARSER_CORE_TSC_H
+#define FASTER_PARSER_CORE_TSC_H
+
+#include <chrono>
+#include <cstdint>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+namespace core::faster_parser {
+    /**
+     * @brief Current value of the timestamp counter
+     * Not serialising: neighbouring instructions may be reordered around the read by a few
+     * cycles, which is fine for stage timings in the tens of nanoseconds. Falls back to
+     * steady_clock nanoseconds on other architectures.
+     */
+    __attribute__((always_inline)) inline uint64_t read_tsc() {
+#if defined(__x86_64__) || defined(__i386__)
+        return __rdtsc();
+#elif defined(__aarch64__)
+        uint64_t ticks;
+        asm volatile("mrs %0, cntvct_el0" : "=r"(ticks));
+        return ticks;
+#else
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+    }
+
+    /**
+     * @brief Serialising counter reads bracketing a timed region (start before, end after)
+     * The start read waits for earlier instructions to complete and keeps later ones from
+     * starting before it (lfence, rdtsc, lfence); the end read waits for the region to
+     * complete (rdtscp, lfence). ISB plays the role of the fences on ARM64. Costs a few tens
+     * of cycles more than read_tsc(); for per-message latency measurement, not hot paths.
+     */
+    __attribute__((always_inline)) inline uint64_t read_tsc_start() {
+#if defined(__x86_64__) || defined(__i386__)
+        _mm_lfence();
+        const uint64_t ticks = __rdtsc();
+        _mm_lfence();
+        return ticks;
+#elif defined(__aarch64__)
+        uint64_t ticks;
+        asm volatile("isb\n\tmrs %0, cntvct_el0\n\tisb" : "=r"(ticks) : : "memory");
+        return ticks;
+#else
+        return read_tsc();
+#endif
+    }
+
+    __attribute__((always_inline)) inline uint64_t read_tsc_end() {
+#if defined(__x86_64__) || defined(__i386__)
+        unsigned int aux;
+        const uint64_t ticks = __rdtscp(&aux);
+        _mm_lfence();
+        return ticks;
+#elif defined(__aarch64__)
+        uint64_t ticks;
+        asm volatile("isb\n\tmrs %0, cntvct_el0" : "=r"(ticks) : : "memory");
+        return ticks;
+#else
+        return read_tsc();
+#endif
+    }
+
+    /**
+     * @brief Timestamp counter to nanoseconds and to wall-clock time
+     * calibrate() measures the tick rate against steady_clock over a short busy-wait and
+     * anchors the counter to system_clock, after which now() is a counter read and a
+     * multiply instead of a clock_gettime call. Assumes an invariant TSC (constant_tsc,
+     * nonstop_tsc), as on every x86 server of the last decade; the anchor drifts from NTP
+     * time by the counter's frequency error, so long-running processes re-calibrate.
+     */
+    class tsc_clock_t {
+    public:
+        tsc_clock_t() = default;
+
+        static tsc_clock_t calibrate(std::chrono::nanoseconds window = std::chrono::milliseconds(10)) {
+            using namespace std::chrono;
+            const auto steady_start = steady_clock::now();
+            const uint64_t ticks_start = read_tsc();
+            auto steady_end = steady_start;
+            while ((steady_end = steady_clock::now()) - steady_start < window) {
+            }
+            const uint64_t ticks_end = read_tsc();
+
+            tsc_clock_t clock;
+            const auto elapsed = duration_cast<nanoseconds>(steady_end - steady_start).count();
+            if (ticks_end > ticks_start) {
+                clock.ns_per_tick_ = static_cast<double>(elapsed) / static_cast<double>(ticks_end - ticks_start);
+            }
+            clock.anchor_ticks_ = read_tsc();
+            clock.anchor_time_ = system_clock::now();
+            return clock;
+        }
+
+        [[nodiscard]] __attribute__((always_inline)) uint64_t to_ns(uint64_t ticks) const {
+            return static_cast<uint64_t>(static_cast<double>(ticks) * ns_per_tick_);
+        }
+
+        // Wall-clock time of a counter value read after calibration
+        [[nodiscard]] __attribute__((always_inline)) std::chrono::system_clock::time_point to_system(uint64_t ticks) const {
+            const auto offset = std::chrono::nanoseconds(to_ns(ticks - anchor_ticks_));
+            return anchor_time_ + std::chrono::duration_cast<std::chrono::system_clock::duration>(offset);
+        }
+
+        [[nodiscard]] __attribute__((always_inline)) std::chrono::system_clock::time_point now() const {
+            return to_system(read_tsc());
+        }
+
+        [[nodiscard]] double ns_per_tick() const { return ns_per_tick_; }
+        [[nodiscard]] double ticks_per_ns() const { return 1. / ns_per_tick_; }
+
+    private:
+        double ns_per_tick_ = 1.;
+        uint64_t anchor_ticks_ = 0;
+        std::chrono::system_clock::time_point anchor_time_{};
+    };
+} // namespace core::faster_parser
+
+#endif //FASTER_PARSER_CORE_TSC_H
@@ -0,0 +1,184 @@
+/**
+ * @file deflate.h
+ * @author Kevin Rodrigues
+ * @brief permessage-deflate (RFC 7692) decompression of WebSocket messages with zlib
+ * @version 1.0
+ * @date 16/10/2026
+ */
+
+#ifndef FASTER_PARSER_WEBSOCKET_DEFLATE_H
+#define FASTER_PARSER_WEBSOCKET_DEFLATE_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <zlib.h>
+
+namespace core::faster_parser::websocket {
+    /**
+     * @brief Inflates permessage-deflate messages into a reusable output buffer
+     * The zlib stream, and so the LZ77 window, persists across messages: with context takeover
+     * (the default) each message may refer back to the previous ones. Output lands in one
+     * buffer that is reused for every message, grows by doubling only when a message does not
+     * fit and is followed by `padding` zero bytes so the SIMD parsers can read past the end.
+     * A message inflating to more than `max_output` bytes is rejected, so a small frame cannot
+     * make the buffer grow without bound. The view returned by inflate() is valid until the
+     * next call.
+     */
+    class inflater_t {
+    public:
+        static constexpr size_t padding = 64;
+
+        explicit inflater_t(int window_bits = 15, bool no_context_takeover = false, size_t initial_capacity = 64 * 1024,
+                            size_t max_output = 16 * 1024 * 1024)
+            : window_bits_(window_bits), no_context_takeover_(no_context_takeover), max_output_(std::max<size_t>(max_output, 1)),
+              buffer_(std::clamp<size_t>(initial_capacity, 1, max_output_) + padding, '\0') {
+            // Negative window bits: raw deflate data, no zlib header or checksum
+            ok_ = inflateInit2(&stream_, -window_bits) == Z_OK;
+        }
+
+        inflater_t(inflater_t const &) = delete;
+        inflater_t &operator=(inflater_t const &) = delete;
+
+        ~inflater_t() {
+            if (ok_) inflateEnd(&stream_);
+        }
+
+        /**
+         * @brief Decompress one complete message (all fragments concatenated)
+         * @return false on corrupt input or output above max_output; the window is then reset
+         */
+        bool inflate(std::string_view compressed, std::string_view &out) {
+            if (!ok_) [[unlikely]] return false;
+
+            size_t written = 0;
+            bool ended = false;
+            if (!run(compressed, written, ended)) return fail();
+            // The sender strips the 00 00 ff ff tail of the final empty stored block (RFC 7692 7.2.2),
+            // unless it ended the message with a final block (BFINAL), after which nothing follows
+            static constexpr char trailer[4] = {0x00, 0x00, static_cast<char>(0xFF), static_cast<char>(0xFF)};
+            if (!ended && !run(std::string_view(trailer, sizeof(trailer)), written, ended)) return fail();
+
+            std::fill_n(buffer_.data() + written, padding, '\0');
+            out = std::string_view(buffer_.data(), written);
+            total_in_ += compressed.size();
+            total_out_ += written;
+
+            // A window cannot be carried past a final block: the next message starts a new stream
+            if (no_context_takeover_ || ended) inflateReset(&stream_);
+            return true;
+        }
+
+        // Drop the window, e.g. after an error or when the connection is re-established
+        void reset() {
+            if (!ok_) ok_ = inflateInit2(&stream_, -window_bits_) == Z_OK;
+            else inflateReset(&stream_);
+        }
+
+        [[nodiscard]] bool ok() const { return ok_; }
+        [[nodiscard]] size_t max_output() const { return max_output_; }
+
+        // Compressed and decompressed bytes seen so far
+        [[nodiscard]] uint64_t total_in() const { return total_in_; }
+        [[nodiscard]] uint64_t total_out() const { return total_out_; }
+
+    private:
+        // Inflate input into the buffer after `written`; sets `ended` and stops at the end of a final block
+        bool run(std::string_view input, size_t &written, bool &ended) {
+            stream_.next_in = reinterpret_cast<Bytef *>(const_cast<char *>(input.data()));
+            stream_.avail_in = static_cast<uInt>(input.size());
+
+            while (true) {
+                if (buffer_.size() - padding - written == 0) {
+                    if (written >= max_output_) return false;
+                    buffer_.resize(std::min((buffer_.size() - padding) * 2, max_output_) + padding);
+                }
+                const size_t room = buffer_.size() - padding - written;
+                stream_.next_out = reinterpret_cast<Bytef *>(buffer_.data() + written);
+                stream_.avail_out = static_cast<uInt>(room);
+
+                int status = ::inflate(&stream_, Z_SYNC_FLUSH);
+                written += room - stream_.avail_out;
+
+                if (status == Z_BUF_ERROR) {
+                    // No progress possible: either the input is used up or the output is full
+                    if (stream_.avail_in == 0) return true;
+                    continue;
+                }
+                if (status == Z_STREAM_END) {
+                    ended = true;
+                    return true;
+                }
+                if (status != Z_OK) return false;
+                if (stream_.avail_in == 0 && stream_.avail_out != 0) return true;
+            }
+        }
+
+        bool fail() {
+            inflateReset(&stream_);
+            return false;
+        }
+
+        z_stream stream_{};
+        bool ok_ = false;
+        int window_bits_;
+        bool no_context_takeover_;
+        size_t max_output_;
+        std::vector<char> buffer_;
+        uint64_t total_in_ = 0;
+        uint64_t total_out_ = 0;
+    };
+
+    /**
+     * @brief Compresses messages the way a permessage-deflate peer does
+     * Not used on the receive path; it builds compressed frames for tests and benchmarks.
+     */
+    class deflater_t {
+    public:
+        explicit deflater_t(int window_bits = 15, int level = Z_DEFAULT_COMPRESSION, bool no_context_takeover = false)
+            : no_context_takeover_(no_context_takeover) {
+            ok_ = deflateInit2(&stream_, level, Z_DEFLATED, -window_bits, 8, Z_DEFAULT_STRATEGY) == Z_OK;
+        }
+
+        deflater_t(deflater_t const &) = delete;
+        deflater_t &operator=(deflater_t const &) = delete;
+
+        ~deflater_t() {
+            if (ok_) deflateEnd(&stream_);
+        }
+
+        // Compress one message, without the trailing 00 00 ff ff
+        bool deflate(std::string_view message, std::string &out) {
+            if (!ok_) return false;
+            out.clear();
+
+            stream_.next_in = reinterpret_cast<Bytef *>(const_cast<char *>(message.data()));
+            stream_.avail_in = static_cast<uInt>(message.size());
+
+            char chunk[16 * 1024];
+            do {
+                stream_.next_out = reinterpret_cast<Bytef *>(chunk);
+                stream_.avail_out = sizeof(chunk);
+                if (::deflate(&stream_, Z_SYNC_FLUSH) == Z_STREAM_ERROR) return false;
+                out.append(chunk, sizeof(chunk) - stream_.avail_out);
+            } while (stream_.avail_out == 0);
+
+            if (out.size() < 4) return false;
+            out.resize(out.size() - 4);
+
+            if (no_context_takeover_) deflateReset(&stream_);
+            return true;
+        }
+
+    private:
+        z_stream stream_{};
+        bool ok_ = false;
+        bool no_context_takeover_;
+    };
+} // namespace core::faster_parser::websocket
+
+#endif // FASTER_PARSER_WEBSOCKET_DEFLATE_H
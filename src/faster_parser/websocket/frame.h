@@ -0,0 +1,332 @@
+/**
+ * @file frame.h
+ * @author Kevin Rodrigues
+ * @brief Minimal client-side RFC 6455 WebSocket frame decoder
+ * @version 1.0
+ * @date 16/10/2026
+ */
+
+#ifndef FASTER_PARSER_WEBSOCKET_FRAME_H
+#define FASTER_PARSER_WEBSOCKET_FRAME_H
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <string>
+#include <string_view>
+
+#if defined(__SSE2__)
+#include <immintrin.h>
+#elif defined(__aarch64__) || defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+namespace core::faster_parser::websocket {
+    enum class opcode_t : uint8_t {
+        continuation = 0x0,
+        text = 0x1,
+        binary = 0x2,
+        close = 0x8,
+        ping = 0x9,
+        pong = 0xA
+    };
+
+    struct frame_header_t {
+        bool fin = false;
+        bool compressed = false;    // RSV1: permessage-deflate compressed message (RFC 7692)
+        opcode_t opcode = opcode_t::continuation;
+        bool masked = false;
+        uint32_t mask_key = 0;      // Key bytes in wire order
+        uint64_t payload_length = 0;
+        size_t header_size = 0;
+    };
+
+    enum class header_status_t : uint8_t {
+        ok,
+        incomplete,
+        invalid
+    };
+
+    /**
+     * @brief Decode a frame header from the start of `data`
+     * Rejects RSV2/RSV3 (no extension uses them), RSV1 on control frames, unknown opcodes and
+     * control frames that are fragmented or longer than 125 bytes. RSV1 on data frames is
+     * reported as `compressed`; whether permessage-deflate was negotiated is up to the caller.
+     */
+    inline header_status_t parse_header(const char *data, size_t available, frame_header_t &header) {
+        if (available < 2) return header_status_t::incomplete;
+
+        const auto b0 = static_cast<uint8_t>(data[0]);
+        const auto b1 = static_cast<uint8_t>(data[1]);
+
+        if (b0 & 0x30) return header_status_t::invalid;
+
+        header.fin = (b0 & 0x80) != 0;
+        header.compressed = (b0 & 0x40) != 0;
+        header.opcode = static_cast<opcode_t>(b0 & 0x0F);
+        header.masked = (b1 & 0x80) != 0;
+
+        const uint8_t op = b0 & 0x0F;
+        const bool control = (op & 0x08) != 0;
+        if ((op > 0x2 && op < 0x8) || op > 0xA) return header_status_t::invalid;
+
+        size_t offset = 2;
+        uint64_t length = b1 & 0x7F;
+        if (length == 126) {
+            if (available < 4) return header_status_t::incomplete;
+            length = (static_cast<uint64_t>(static_cast<uint8_t>(data[2])) << 8) | static_cast<uint8_t>(data[3]);
+            offset = 4;
+        } else if (length == 127) {
+            if (available < 10) return header_status_t::incomplete;
+            length = 0;
+            for (size_t i = 0; i < 8; ++i) {
+                length = (length << 8) | static_cast<uint8_t>(data[2 + i]);
+            }
+            if (length >> 63) return header_status_t::invalid;
+            offset = 10;
+        }
+
+        if (control && (!header.fin || header.compressed || length > 125)) return header_status_t::invalid;
+
+        if (header.masked) {
+            if (available < offset + 4) return header_status_t::incomplete;
+            std::memcpy(&header.mask_key, data + offset, 4);
+            offset += 4;
+        } else {
+            header.mask_key = 0;
+        }
+
+        header.payload_length = length;
+        header.header_size = offset;
+        return header_status_t::ok;
+    }
+
+    /**
+     * @brief XOR `len` bytes in place with the 4-byte masking key
+     * `mask_key` holds the key bytes in wire order (as copied from the header), so replicating
+     * it across a vector register lines each key byte up with its payload byte.
+     */
+    __attribute__((always_inline)) inline void unmask(char *data, size_t len, uint32_t mask_key) {
+        size_t i = 0;
+
+#if defined(__AVX2__)
+        const __m256i key256 = _mm256_set1_epi32(static_cast<int>(mask_key));
+        for (; i + 32 <= len; i += 32) {
+            __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(data + i), _mm256_xor_si256(chunk, key256));
+        }
+#endif
+#if defined(__SSE2__)
+        const __m128i key128 = _mm_set1_epi32(static_cast<int>(mask_key));
+        for (; i + 16 <= len; i += 16) {
+            __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(data + i), _mm_xor_si128(chunk, key128));
+        }
+#elif defined(__aarch64__) || defined(__ARM_NEON)
+        const uint8x16_t key128 = vreinterpretq_u8_u32(vdupq_n_u32(mask_key));
+        for (; i + 16 <= len; i += 16) {
+            uint8x16_t chunk = vld1q_u8(reinterpret_cast<const uint8_t*>(data + i));
+            vst1q_u8(reinterpret_cast<uint8_t*>(data + i), veorq_u8(chunk, key128));
+        }
+#endif
+
+        // Vector blocks are multiples of 4 bytes, so the key phase is unchanged here
+        uint8_t key[4];
+        std::memcpy(key, &mask_key, 4);
+        for (; i < len; ++i) {
+            data[i] = static_cast<char>(static_cast<uint8_t>(data[i]) ^ key[i & 3]);
+        }
+    }
+
+    /**
+     * @brief Append one frame to `out`. Clients must mask (RFC 6455 5.3): pass a non-zero key.
+     * Used to answer pings and to close the connection.
+     */
+    inline void encode_frame(std::string &out, opcode_t opcode, std::string_view payload, uint32_t mask_key = 0, bool fin = true,
+                             bool compressed = false) {
+        const bool masked = mask_key != 0;
+        out.push_back(static_cast<char>((fin ? 0x80 : 0x00) | (compressed ? 0x40 : 0x00) | static_cast<uint8_t>(opcode)));
+
+        const uint8_t mask_bit = masked ? 0x80 : 0x00;
+        if (payload.size() < 126) {
+            out.push_back(static_cast<char>(mask_bit | payload.size()));
+        } else if (payload.size() <= 0xFFFF) {
+            out.push_back(static_cast<char>(mask_bit | 126));
+            out.push_back(static_cast<char>(payload.size() >> 8));
+            out.push_back(static_cast<char>(payload.size() & 0xFF));
+        } else {
+            out.push_back(static_cast<char>(mask_bit | 127));
+            for (int shift = 56; shift >= 0; shift -= 8) {
+                out.push_back(static_cast<char>((static_cast<uint64_t>(payload.size()) >> shift) & 0xFF));
+            }
+        }
+
+        if (masked) {
+            out.append(reinterpret_cast<const char *>(&mask_key), 4);
+        }
+
+        const size_t start = out.size();
+        out.append(payload);
+        if (masked) {
+            unmask(out.data() + start, payload.size(), mask_key);
+        }
+    }
+
+    /**
+     * @brief Receives decoded messages. Only on_text is required; on_binary, on_ping, on_pong
+     * and on_close are detected and called when present. Compressed messages are passed, still
+     * compressed, to on_compressed(opcode_t, std::string_view); without it they are a protocol
+     * error.
+     */
+    template<typename T>
+    concept FrameHandler = requires(T &handler, std::string_view payload) {
+        { handler.on_text(payload) } -> std::same_as<void>;
+    };
+
+    /**
+     * @brief Decodes frames in place from a receive buffer
+     * Complete unfragmented text and binary frames are handed to the handler as a view of the
+     * receive buffer (masked payloads are unmasked in place first). Fragmented messages are
+     * reassembled into an internal buffer. Bytes of a frame that has not fully arrived are not
+     * consumed: keep them at the front of the buffer and decode again after the next read.
+     * Frames with RSV1 set are only accepted once permessage-deflate has been negotiated
+     * (set_permessage_deflate).
+     */
+    class frame_decoder_t {
+    public:
+        frame_decoder_t() { fragments_.reserve(4096); }
+
+        /**
+         * @return Number of bytes consumed. Stops early, without consuming the offending frame,
+         * on a protocol error; failed() then stays true until reset().
+         */
+        template<FrameHandler handler_t>
+        size_t decode(std::span<char> buffer, handler_t &handler) {
+            char *const begin = buffer.data();
+            char *ptr = begin;
+            size_t available = buffer.size();
+
+            while (!failed_) {
+                frame_header_t header;
+                header_status_t status = parse_header(ptr, available, header);
+                if (status == header_status_t::incomplete) break;
+                if (status == header_status_t::invalid) [[unlikely]] {
+                    failed_ = true;
+                    break;
+                }
+
+                if (available - header.header_size < header.payload_length) break;
+
+                char *payload = ptr + header.header_size;
+                const size_t length = static_cast<size_t>(header.payload_length);
+                if (header.masked) [[unlikely]] {
+                    unmask(payload, length, header.mask_key);
+                }
+
+                if (!dispatch(header, std::string_view(payload, length), handler)) [[unlikely]] {
+                    failed_ = true;
+                    break;
+                }
+
+                ptr = payload + length;
+                available -= header.header_size + length;
+            }
+
+            return static_cast<size_t>(ptr - begin);
+        }
+
+        void reset() {
+            fragments_.clear();
+            fragmented_ = false;
+            fragment_compressed_ = false;
+            failed_ = false;
+        }
+
+        // Accept RSV1 (compressed) data frames, as agreed in the opening handshake
+        void set_permessage_deflate(bool enabled) { permessage_deflate_ = enabled; }
+
+        [[nodiscard]] bool failed() const { return failed_; }
+
+    private:
+        template<FrameHandler handler_t>
+        __attribute__((always_inline)) bool dispatch(frame_header_t const &header, std::string_view payload, handler_t &handler) {
+            switch (header.opcode) {
+                case opcode_t::text:
+                case opcode_t::binary:
+                    if (fragmented_) return false;
+                    if (header.compressed && !permessage_deflate_) return false;
+                    if (header.fin) [[likely]] {
+                        return deliver(header.opcode, header.compressed, payload, handler);
+                    }
+                    fragments_.assign(payload);
+                    fragment_opcode_ = header.opcode;
+                    fragment_compressed_ = header.compressed;
+                    fragmented_ = true;
+                    return true;
+
+                case opcode_t::continuation:
+                    // RSV1 is only set on the first frame of a message
+                    if (!fragmented_ || header.compressed) return false;
+                    fragments_.append(payload);
+                    if (header.fin) {
+                        fragmented_ = false;
+                        bool ok = deliver(fragment_opcode_, fragment_compressed_, fragments_, handler);
+                        fragments_.clear();
+                        return ok;
+                    }
+                    return true;
+
+                case opcode_t::ping:
+                    if constexpr (requires { handler.on_ping(payload); }) handler.on_ping(payload);
+                    return true;
+
+                case opcode_t::pong:
+                    if constexpr (requires { handler.on_pong(payload); }) handler.on_pong(payload);
+                    return true;
+
+                case opcode_t::close: {
+                    if (payload.size() == 1) return false;
+                    uint16_t code = 1005; // No status received
+                    std::string_view reason;
+                    if (payload.size() >= 2) {
+                        code = static_cast<uint16_t>((static_cast<uint8_t>(payload[0]) << 8) | static_cast<uint8_t>(payload[1]));
+                        reason = payload.substr(2);
+                    }
+                    if constexpr (requires { handler.on_close(code, reason); }) handler.on_close(code, reason);
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        template<FrameHandler handler_t>
+        __attribute__((always_inline)) static bool deliver(opcode_t opcode, bool compressed, std::string_view payload, handler_t &handler) {
+            if (compressed) {
+                if constexpr (requires { handler.on_compressed(opcode, payload); }) {
+                    handler.on_compressed(opcode, payload);
+                    return true;
+                } else {
+                    return false;
+                }
+            }
+
+            if (opcode == opcode_t::text) [[likely]] {
+                handler.on_text(payload);
+            } else if constexpr (requires { handler.on_binary(payload); }) {
+                handler.on_binary(payload);
+            }
+            return true;
+        }
+
+        std::string fragments_;
+        opcode_t fragment_opcode_ = opcode_t::text;
+        bool fragmented_ = false;
+        bool fragment_compressed_ = false;
+        bool permessage_deflate_ = false;
+        bool failed_ = false;
+    };
+} // namespace core::faster_parser::websocket
+
+#endif // FASTER_PARSER_WEBSOCKET_FRAME_H
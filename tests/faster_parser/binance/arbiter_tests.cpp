@@ -0,0 +1,152 @@
+/**
+ * @file arbiter_tests.cpp
+ * @author Kevin Rodrigues
+ * @brief Tests for first-arrival arbitration across redundant feed connections
+ * @version 1.0
+ * @date 16/10/2026
+ */
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include <faster_parser/binance/arbiter.h>
+
+using namespace core::faster_parser::binance;
+using namespace core::faster_parser::binance::types;
+
+namespace {
+    std::string agg_trade(std::string const &symbol, uint64_t id) {
+        return R"({"e":"aggTrade","E":1,"s":")" + symbol + R"(","a":)" + std::to_string(id) +
+               R"(,"p":"0.001","q":"100","f":100,"l":105,"T":123456785,"m":true})";
+    }
+
+    std::string book_ticker(std::string const &symbol, uint64_t update_id) {
+        return R"({"e":"bookTicker","u":)" + std::to_string(update_id) + R"(,"s":")" + symbol +
+               R"(","b":"25.35190000","B":"31.21000000","a":"25.36520000","A":"40.66000000","T":1,"E":2})";
+    }
+
+    std::string ticker(std::string const &symbol, uint64_t event_time) {
+        return R"({"e":"24hrTicker","E":)" + std::to_string(event_time) + R"(,"s":")" + symbol +
+               R"(","p":"0.0015","P":"250.00","w":"0.0018","c":"0.0025","Q":"10","o":"0.0010","h":"0.0025","l":"0.0010","v":"10000","q":"18","O":0,"C":86400000,"F":0,"L":18150,"n":1})";
+    }
+
+    class RecordingListener {
+    public:
+        std::vector<uint64_t> book_update_ids;
+        std::vector<uint64_t> agg_trade_ids;
+        std::vector<uint64_t> ticker_times;
+
+        void on_book_ticker(const book_ticker_t &ticker) { book_update_ids.push_back(ticker.bid.sequence); }
+        void on_trade(const trade_t &trade) { agg_trade_ids.push_back(trade.agg_trade_id); }
+        void on_ticker(const ticker_t &ticker) { ticker_times.push_back(ticker.event_time); }
+    };
+
+    auto now() {
+        return std::chrono::system_clock::now();
+    }
+}
+
+TEST(feed_arbiter_test_t, PeeksTypeSymbolAndKey) {
+    auto peek = [](std::string const &message) { return peek_arbitration_key(message.data(), message.data() + message.size()); };
+
+    arbitration_key_t key = peek(book_ticker("ASTERUSDT", 8822354685185));
+    EXPECT_EQ(key.stream, arbitration_stream_t::book_ticker);
+    EXPECT_EQ(key.symbol, "ASTERUSDT");
+    EXPECT_EQ(key.key, 8822354685185ULL);
+
+    key = peek(agg_trade("BTCUSDT", 5933014));
+    EXPECT_EQ(key.stream, arbitration_stream_t::trade);
+    EXPECT_EQ(key.symbol, "BTCUSDT");
+    EXPECT_EQ(key.key, 5933014U);
+
+    key = peek(ticker("ETHUSDT", 1760083106579));
+    EXPECT_EQ(key.stream, arbitration_stream_t::ticker);
+    EXPECT_EQ(key.symbol, "ETHUSDT");
+    EXPECT_EQ(key.key, 1760083106579ULL);
+
+    key = peek(R"({"e":"depthUpdate","E":1,"T":1,"s":"BTCUSDT","U":157,"u":160,"pu":149,"b":[],"a":[]})");
+    EXPECT_EQ(key.stream, arbitration_stream_t::depth);
+    EXPECT_EQ(key.symbol, "BTCUSDT");
+    EXPECT_EQ(key.key, 160U);
+
+    key = peek("[" + ticker("BTCUSDT", 77) + "," + ticker("ETHUSDT", 77) + "]");
+    EXPECT_EQ(key.stream, arbitration_stream_t::ticker_array);
+    EXPECT_EQ(key.key, 77U);
+
+    EXPECT_EQ(peek(R"({"e":"markPriceUpdate","E":1,"s":"BTCUSDT","p":"1"})").stream, arbitration_stream_t::none);
+    EXPECT_EQ(peek(R"({"e":"bookTicker","u":88223546)").stream, arbitration_stream_t::none);
+}
+
+TEST(feed_arbiter_test_t, ParsesOnlyTheFirstCopy) {
+    feed_arbiter_t arbiter;
+    RecordingListener listener;
+
+    // Connection A is ahead on BTCUSDT, connection B on ETHUSDT
+    std::vector<std::string> a = {agg_trade("BTCUSDT", 1), agg_trade("BTCUSDT", 2), agg_trade("ETHUSDT", 7)};
+    std::vector<std::string> b = {agg_trade("ETHUSDT", 7), agg_trade("BTCUSDT", 1), agg_trade("ETHUSDT", 8), agg_trade("BTCUSDT", 2)};
+
+    EXPECT_EQ(arbiter.parse(now(), a[0], listener), arbitration_t::accepted);
+    EXPECT_EQ(arbiter.parse(now(), b[0], listener), arbitration_t::accepted);
+    EXPECT_EQ(arbiter.parse(now(), a[1], listener), arbitration_t::accepted);
+    EXPECT_EQ(arbiter.parse(now(), b[1], listener), arbitration_t::duplicate);
+    EXPECT_EQ(arbiter.parse(now(), a[2], listener), arbitration_t::duplicate);
+    EXPECT_EQ(arbiter.parse(now(), b[2], listener), arbitration_t::accepted);
+    EXPECT_EQ(arbiter.parse(now(), b[3], listener), arbitration_t::duplicate);
+
+    EXPECT_EQ(listener.agg_trade_ids, (std::vector<uint64_t>{1, 7, 2, 8}));
+    EXPECT_EQ(arbiter.accepted(), 4U);
+    EXPECT_EQ(arbiter.duplicates(), 3U);
+    EXPECT_EQ(arbiter.mark("BTCUSDT", arbitration_stream_t::trade), 2U);
+    EXPECT_EQ(arbiter.mark("ETHUSDT", arbitration_stream_t::trade), 8U);
+}
+
+TEST(feed_arbiter_test_t, KeepsOneMarkPerStream) {
+    feed_arbiter_t arbiter;
+    RecordingListener listener;
+
+    // The same number as key of different streams of one symbol
+    EXPECT_EQ(arbiter.parse(now(), book_ticker("BTCUSDT", 100), listener), arbitration_t::accepted);
+    EXPECT_EQ(arbiter.parse(now(), agg_trade("BTCUSDT", 100), listener), arbitration_t::accepted);
+    EXPECT_EQ(arbiter.parse(now(), ticker("BTCUSDT", 100), listener), arbitration_t::accepted);
+    EXPECT_EQ(arbiter.parse(now(), book_ticker("BTCUSDT", 99), listener), arbitration_t::duplicate);
+    EXPECT_EQ(arbiter.parse(now(), ticker("BTCUSDT", 101), listener), arbitration_t::accepted);
+
+    EXPECT_EQ(listener.book_update_ids, (std::vector<uint64_t>{100}));
+    EXPECT_EQ(listener.ticker_times, (std::vector<uint64_t>{100, 101}));
+
+    const std::string array = "[" + ticker("BTCUSDT", 500) + "," + ticker("ETHUSDT", 500) + "]";
+    EXPECT_EQ(arbiter.parse(now(), array, listener), arbitration_t::accepted);
+    EXPECT_EQ(arbiter.parse(now(), array, listener), arbitration_t::duplicate);
+    EXPECT_EQ(listener.ticker_times.size(), 4U);
+}
+
+TEST(feed_arbiter_test_t, FailedParseDoesNotRaiseTheMark) {
+    feed_arbiter_t arbiter;
+    RecordingListener listener;
+
+    // Key readable but the message is cut short on this connection
+    std::string truncated = book_ticker("BTCUSDT", 42).substr(0, 60);
+    EXPECT_EQ(arbiter.parse(now(), truncated, listener), arbitration_t::rejected);
+    EXPECT_EQ(arbiter.parse(now(), book_ticker("BTCUSDT", 42), listener), arbitration_t::accepted);
+    EXPECT_EQ(listener.book_update_ids, (std::vector<uint64_t>{42}));
+    EXPECT_EQ(arbiter.rejected(), 1U);
+}
+
+TEST(feed_arbiter_test_t, UnkeyedMessagesGoStraightToTheParser) {
+    feed_arbiter_t arbiter(1);
+    RecordingListener listener;
+
+    EXPECT_EQ(arbiter.parse(now(), agg_trade("BTCUSDT", 1), listener), arbitration_t::accepted);
+    // Registry full: ETHUSDT cannot be arbitrated and every copy is delivered
+    EXPECT_EQ(arbiter.parse(now(), agg_trade("ETHUSDT", 1), listener), arbitration_t::accepted);
+    EXPECT_EQ(arbiter.parse(now(), agg_trade("ETHUSDT", 1), listener), arbitration_t::accepted);
+    EXPECT_EQ(arbiter.unkeyed(), 2U);
+    EXPECT_EQ(arbiter.parse(now(), R"({"e":"markPriceUpdate","E":1,"s":"BTCUSDT","p":"1"})", listener), arbitration_t::rejected);
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,121 @@
+/**
+ * @file cursor_tests.cpp
+ * @author Kevin Rodrigues
+ * @brief Tests for the pull-style Binance message cursor
+ * @version 1.0
+ * @date 16/10/2026
+ */
+
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <faster_parser/binance/cursor.h>
+
+using namespace core::faster_parser::binance;
+using namespace core::faster_parser::binance::types;
+
+namespace {
+    const std::string book_ticker_message = R"({"e":"bookTicker","u":400900217,"s":"BNBUSDT","b":"25.35190000","B":"31.21000000","a":"25.36520000","A":"40.66000000","T":1568014460891,"E":1568014460893})";
+    const std::string agg_trade_message = R"({"e":"aggTrade","E":123456789,"s":"BTCUSDT","a":5933014,"p":"0.001","q":"100","f":100,"l":105,"T":123456785,"m":true})";
+    const std::string ticker_message = R"({"e":"24hrTicker","E":123456789,"s":"ETHUSDT","p":"0.0015","P":"250.00","w":"0.0018","c":"0.0025","Q":"10","o":"0.0010","h":"0.0025","l":"0.0010","v":"10000","q":"18","O":0,"C":86400000,"F":0,"L":18150,"n":18151})";
+
+    std::string length_prefixed(std::vector<std::string> const &messages) {
+        std::string out;
+        for (auto const &message : messages) {
+            uint32_t length = static_cast<uint32_t>(message.size());
+            char prefix[4];
+            std::memcpy(prefix, &length, sizeof(length));
+            out.append(prefix, sizeof(prefix));
+            out += message;
+        }
+        return out;
+    }
+}
+
+TEST(message_cursor_test_t, YieldsEventsFromNewlineFrames) {
+    std::string buffer = book_ticker_message + "\n" + agg_trade_message + "\r\n" + ticker_message;
+    message_cursor_t cursor(buffer);
+    event_t event;
+
+    ASSERT_TRUE(cursor.next(event));
+    ASSERT_TRUE(std::holds_alternative<book_ticker_t>(event));
+    EXPECT_EQ(std::get<book_ticker_t>(event).symbol, "BNBUSDT");
+    EXPECT_DOUBLE_EQ(std::get<book_ticker_t>(event).bid.price, 25.3519);
+
+    ASSERT_TRUE(cursor.next(event));
+    ASSERT_TRUE(std::holds_alternative<trade_t>(event));
+    EXPECT_EQ(std::get<trade_t>(event).agg_trade_id, 5933014U);
+    EXPECT_TRUE(std::get<trade_t>(event).is_buyer_maker);
+
+    ASSERT_TRUE(cursor.next(event));
+    ASSERT_TRUE(std::holds_alternative<ticker_t>(event));
+    EXPECT_EQ(std::get<ticker_t>(event).total_trades, 18151U);
+
+    EXPECT_FALSE(cursor.next(event));
+    EXPECT_TRUE(cursor.done());
+    EXPECT_EQ(cursor.skipped(), 0U);
+}
+
+TEST(message_cursor_test_t, YieldsEventsFromLengthPrefixedFrames) {
+    std::string buffer = length_prefixed({agg_trade_message, book_ticker_message});
+    message_cursor_t cursor(buffer, framing_t::length_prefixed);
+    event_t event;
+
+    ASSERT_TRUE(cursor.next(event));
+    EXPECT_TRUE(std::holds_alternative<trade_t>(event));
+    ASSERT_TRUE(cursor.next(event));
+    EXPECT_TRUE(std::holds_alternative<book_ticker_t>(event));
+    EXPECT_FALSE(cursor.next(event));
+}
+
+TEST(message_cursor_test_t, TruncatedLengthPrefixedFrameEndsTheCursor) {
+    std::string buffer = length_prefixed({agg_trade_message, book_ticker_message});
+    buffer.resize(buffer.size() - 10);
+    message_cursor_t cursor(buffer, framing_t::length_prefixed);
+    event_t event;
+
+    ASSERT_TRUE(cursor.next(event));
+    EXPECT_FALSE(cursor.next(event));
+}
+
+TEST(message_cursor_test_t, TickerArrayYieldsOneEventPerElement) {
+    std::string buffer = "[" + ticker_message + "," + ticker_message + "," + ticker_message + "]\n" + agg_trade_message;
+    message_cursor_t cursor(buffer);
+
+    std::vector<size_t> kinds;
+    for (auto const &event : cursor) {
+        kinds.push_back(event.index());
+    }
+
+    EXPECT_EQ(kinds, (std::vector<size_t>{2, 2, 2, 1}));
+}
+
+TEST(message_cursor_test_t, SkipsEmptyAndUnknownFrames) {
+    std::string buffer = "\n" + agg_trade_message + "\n\n{\"e\":\"unknownEvent\",\"E\":1,\"s\":\"X\"}\n" + agg_trade_message + "\n";
+    message_cursor_t cursor(buffer);
+
+    size_t count = 0;
+    for (auto const &event : cursor) {
+        EXPECT_TRUE(std::holds_alternative<trade_t>(event));
+        ++count;
+    }
+
+    EXPECT_EQ(count, 2U);
+    EXPECT_EQ(cursor.skipped(), 1U);
+}
+
+TEST(message_cursor_test_t, EmptyBuffer) {
+    message_cursor_t cursor(std::string_view{});
+    event_t event;
+
+    EXPECT_FALSE(cursor.next(event));
+    EXPECT_TRUE(cursor.done());
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -42,6 +42,49 @@ public:
     }
 };
 
+class TradeOnlyListener {
+public:
+    std::vector<trade_t> agg_trades;
+
+    void on_trade(const trade_t& trade) {
+        agg_trades.push_back(trade);
+    }
+};
+
+class TickerOnlyListener {
+public:
+    std::vector<ticker_t> tickers;
+
+    void on_ticker(const ticker_t& ticker) {
+        tickers.push_back(ticker);
+    }
+};
+
+class DepthOnlyListener {
+public:
+    struct update_t {
+        depth_update_t update;
+        std::vector<depth_level_t> bids;
+        std::vector<depth_level_t> asks;
+    };
+
+    std::vector<update_t> updates;
+
+    // Levels are views into the message: copy them out while the callback runs
+    void on_depth_update(const depth_update_t& update) {
+        update_t copy{update, {}, {}};
+        update.bids.for_each([&](const depth_level_t& level) { copy.bids.push_back(level); });
+        update.asks.for_each([&](const depth_level_t& level) { copy.asks.push_back(level); });
+        updates.push_back(std::move(copy));
+    }
+};
+
+static_assert(BinanceFutureListener<MockListener>);
+static_assert(BinanceFutureListener<TradeOnlyListener>);
+static_assert(TradeListener<TradeOnlyListener> && !BookTickerListener<TradeOnlyListener> && !TickerListener<TradeOnlyListener>);
+static_assert(DepthListener<DepthOnlyListener> && !DepthListener<MockListener>);
+static_assert(!BinanceFutureListener<int>);
+
 class binance_future_parser_test_t : public ::testing::Test {
 protected:
     MockListener listener;
@@ -804,6 +847,212 @@ TEST_F(binance_future_parser_test_t, ParseEmptyTickerArray) {
     EXPECT_EQ(listener.tickers.size(), 0);
 }
 
+TEST_F(binance_future_parser_test_t, TradeOnlyListenerParsesTrades) {
+    TradeOnlyListener trade_listener;
+    std::string_view message = R"({"e":"aggTrade","E":123456789,"s":"BTCUSDT","a":5933014,"p":"0.001","q":"100","f":100,"l":105,"T":123456785,"m":true})";
+
+    EXPECT_TRUE(binance_future_parser_t::parse(now(), message, trade_listener));
+    ASSERT_EQ(trade_listener.agg_trades.size(), 1);
+    EXPECT_EQ(trade_listener.agg_trades[0].symbol, "BTCUSDT");
+    EXPECT_EQ(trade_listener.agg_trades[0].agg_trade_id, 5933014U);
+}
+
+TEST_F(binance_future_parser_test_t, TradeOnlyListenerRejectsOtherTypes) {
+    TradeOnlyListener trade_listener;
+    std::string_view book_ticker = R"({"e":"bookTicker","u":8822354685185,"s":"ASTERUSDT","b":"1.5822000","B":"457","a":"1.5823000","A":"112","T":1760083106579,"E":1760083106579})";
+    std::string_view ticker = R"({"e":"24hrTicker","E":123456789,"s":"BTCUSDT","p":"0.0015","P":"250.00","w":"0.0018","c":"0.0025","Q":"10","o":"0.0010","h":"0.0025","l":"0.0010","v":"10000","q":"18","O":0,"C":86400000,"F":0,"L":18150,"n":18151})";
+
+    EXPECT_FALSE(binance_future_parser_t::parse(now(), book_ticker, trade_listener));
+    EXPECT_FALSE(binance_future_parser_t::parse(now(), ticker, trade_listener));
+    EXPECT_TRUE(trade_listener.agg_trades.empty());
+}
+
+TEST_F(binance_future_parser_test_t, TickerOnlyListenerParsesTickerArray) {
+    TickerOnlyListener ticker_listener;
+    std::string_view message = R"([{"e":"24hrTicker","E":1,"s":"BTCUSDT","p":"0.0015","P":"250.00","w":"0.0018","c":"0.0025","Q":"10","o":"0.0010","h":"0.0025","l":"0.0010","v":"10000","q":"18","O":0,"C":86400000,"F":0,"L":18150,"n":18151},{"e":"24hrTicker","E":2,"s":"ETHUSDT","p":"0.0015","P":"250.00","w":"0.0018","c":"0.0025","Q":"10","o":"0.0010","h":"0.0025","l":"0.0010","v":"10000","q":"18","O":0,"C":86400000,"F":0,"L":18150,"n":18151}])";
+    std::string_view trade = R"({"e":"aggTrade","E":123456789,"s":"BTCUSDT","a":5933014,"p":"0.001","q":"100","f":100,"l":105,"T":123456785,"m":true})";
+
+    EXPECT_TRUE(binance_future_parser_t::parse(now(), message, ticker_listener));
+    EXPECT_FALSE(binance_future_parser_t::parse(now(), trade, ticker_listener));
+    ASSERT_EQ(ticker_listener.tickers.size(), 2);
+    EXPECT_EQ(ticker_listener.tickers[1].symbol, "ETHUSDT");
+}
+
+TEST_F(binance_future_parser_test_t, ParseStreamNewlineDelimited) {
+    std::string buffer =
+        R"({"e":"bookTicker","u":8822354685185,"s":"ASTERUSDT","b":"1.5822000","B":"457","a":"1.5823000","A":"112","T":1760083106579,"E":1760083106579})" "\n"
+        R"({"e":"aggTrade","E":123456789,"s":"BTCUSDT","a":5933014,"p":"0.001","q":"100","f":100,"l":105,"T":123456785,"m":true})" "\r\n"
+        R"({"e":"24hrTicker","E":123456789,"s":"ETHUSDT","p":"0.0015","P":"250.00","w":"0.0018","c":"0.0025","Q":"10","o":"0.0010","h":"0.0025","l":"0.0010","v":"10000","q":"18","O":0,"C":86400000,"F":0,"L":18150,"n":18151})" "\n";
+
+    size_t consumed = binance_future_parser_t::parse_stream(now(), buffer, listener);
+
+    EXPECT_EQ(consumed, buffer.size());
+    ASSERT_EQ(listener.book_tickers.size(), 1);
+    ASSERT_EQ(listener.agg_trades.size(), 1);
+    ASSERT_EQ(listener.tickers.size(), 1);
+    EXPECT_EQ(listener.book_tickers[0].symbol, "ASTERUSDT");
+    EXPECT_TRUE(listener.agg_trades[0].is_buyer_maker);
+    EXPECT_EQ(listener.tickers[0].total_trades, 18151U);
+}
+
+TEST_F(binance_future_parser_test_t, ParseStreamConcatenatedWithoutSeparator) {
+    std::string trade = R"({"e":"aggTrade","E":123456789,"s":"BTCUSDT","a":5933014,"p":"0.001","q":"100","f":100,"l":105,"T":123456785,"m":false})";
+    std::string buffer = trade + trade + trade;
+
+    EXPECT_EQ(binance_future_parser_t::parse_stream(now(), buffer, listener), buffer.size());
+    ASSERT_EQ(listener.agg_trades.size(), 3);
+    EXPECT_FALSE(listener.agg_trades[2].is_buyer_maker);
+}
+
+TEST_F(binance_future_parser_test_t, ParseStreamStopsAtPartialMessage) {
+    std::string complete = std::string(R"({"e":"aggTrade","E":123456789,"s":"BTCUSDT","a":5933014,"p":"0.001","q":"100","f":100,"l":105,"T":123456785,"m":true})") + "\n";
+    std::string partial = R"({"e":"bookTicker","u":8822354685185,"s":"ASTERUSDT","b":"1.5822000","B":"457","a":"1.5823000","A":"112","T":17600831)";
+    std::string buffer = complete + partial;
+
+    size_t consumed = binance_future_parser_t::parse_stream(now(), buffer, listener);
+
+    EXPECT_EQ(consumed, complete.size());
+    EXPECT_EQ(listener.agg_trades.size(), 1);
+    EXPECT_TRUE(listener.book_tickers.empty());
+
+    // Feeding the remainder once it has arrived completes the message
+    std::string rest = buffer.substr(consumed) + R"(06579,"E":1760083106579})" "\n";
+    EXPECT_EQ(binance_future_parser_t::parse_stream(now(), rest, listener), rest.size());
+    ASSERT_EQ(listener.book_tickers.size(), 1);
+    EXPECT_EQ(listener.book_tickers[0].exchange_timestamp, 1760083106579ULL);
+}
+
+TEST_F(binance_future_parser_test_t, ParseStreamTruncatedLineDoesNotBorrowNextLine) {
+    std::string buffer =
+        R"({"e":"bookTicker","u":1,"s":"BTCUSDT","b":"1.0")" "\n"
+        R"({"e":"bookTicker","u":2,"s":"ETHUSDT","b":"2.0","B":"3.0","a":"4.0","A":"5.0","T":6,"E":7})" "\n"
+        R"([{"e":"24hrTicker","E":1,"s":"BTCUSDT","p":"0.0015","P":"250.00")" "\n"
+        R"({"e":"aggTrade","E":123456789,"s":"BTCUSDT","a":5933014,"p":"0.001","q":"100","f":100,"l":105,"T":123456785,"m":true})" "\n"
+        R"([{"e":"24hrTicker","E":1,"s":"BNBUSDT","p":"0.0015","P":"250.00","w":"0.0018","c":"0.0025","Q":"10","o":"0.0010","h":"0.0025","l":"0.0010","v":"10000","q":"18","O":0,"C":86400000,"F":0,"L":18150,"n":18151}])" "\n";
+
+    EXPECT_EQ(binance_future_parser_t::parse_stream(now(), buffer, listener), buffer.size());
+    ASSERT_EQ(listener.book_tickers.size(), 1);
+    EXPECT_EQ(listener.book_tickers[0].symbol, "ETHUSDT");
+    EXPECT_EQ(listener.book_tickers[0].bid.sequence, 2U);
+    EXPECT_EQ(listener.book_tickers[0].exchange_timestamp, 7U);
+    EXPECT_EQ(listener.agg_trades.size(), 1);
+    ASSERT_EQ(listener.tickers.size(), 1);
+    EXPECT_EQ(listener.tickers[0].symbol, "BNBUSDT");
+}
+
+TEST_F(binance_future_parser_test_t, ParseStreamPartialTickerArrayIsNotDispatched) {
+    std::string buffer = R"([{"e":"24hrTicker","E":1,"s":"BTCUSDT","p":"0.0015","P":"250.00","w":"0.0018","c":"0.0025","Q":"10","o":"0.0010","h":"0.0025","l":"0.0010","v":"10000","q":"18","O":0,"C":86400000,"F":0,"L":18150,"n":18151},{"e":"24hrT)";
+
+    EXPECT_EQ(binance_future_parser_t::parse_stream(now(), buffer, listener), 0U);
+    EXPECT_TRUE(listener.tickers.empty());
+}
+
+TEST_F(binance_future_parser_test_t, ParseStreamSkipsUnknownLines) {
+    std::string buffer =
+        R"({"e":"markPriceUpdate","E":1,"s":"BTCUSDT","p":"1"})" "\n"
+        R"({"e":"aggTrade","E":123456789,"s":"BTCUSDT","a":5933014,"p":"0.001","q":"100","f":100,"l":105,"T":123456785,"m":true})" "\n";
+    TradeOnlyListener trade_listener;
+    std::string with_book_ticker = buffer + R"({"e":"bookTicker","u":1,"s":"ASTERUSDT","b":"1.5822000","B":"457","a":"1.5823000","A":"112","T":1,"E":1})" "\n";
+
+    EXPECT_EQ(binance_future_parser_t::parse_stream(now(), with_book_ticker, trade_listener), with_book_ticker.size());
+    EXPECT_EQ(trade_listener.agg_trades.size(), 1);
+}
+
+TEST_F(binance_future_parser_test_t, ParseStreamConsumesIgnoredRecordWithoutNewline) {
+    const std::string trade = R"({"e":"aggTrade","E":123456789,"s":"BTCUSDT","a":5933014,"p":"0.001","q":"100","f":100,"l":105,"T":123456785,"m":true})";
+    const std::string book_ticker = R"({"e":"bookTicker","u":1,"s":"ASTERUSDT","b":"1.5822000","B":"457","a":"1.5823000","A":"112","T":1,"E":1})";
+    TradeOnlyListener trade_listener;
+
+    // A complete record the listener ignores is not carried over to the next call
+    const std::string buffer = trade + "\n" + book_ticker;
+    EXPECT_EQ(binance_future_parser_t::parse_stream(now(), buffer, trade_listener), buffer.size());
+    EXPECT_EQ(trade_listener.agg_trades.size(), 1);
+
+    // Too short to tell its type, or a handled type cut short: kept
+    const std::string short_tail = trade + "\n" + R"({"e":"bookTi)";
+    EXPECT_EQ(binance_future_parser_t::parse_stream(now(), short_tail, trade_listener), trade.size() + 1);
+    const std::string handled_tail = trade + "\n" + trade.substr(0, 60);
+    EXPECT_EQ(binance_future_parser_t::parse_stream(now(), handled_tail, trade_listener), trade.size() + 1);
+    EXPECT_EQ(trade_listener.agg_trades.size(), 3);
+}
+
+TEST_F(binance_future_parser_test_t, ParseStreamEmptyBuffer) {
+    EXPECT_EQ(binance_future_parser_t::parse_stream(now(), std::string_view{}, listener), 0U);
+    EXPECT_EQ(binance_future_parser_t::parse_stream(now(), "\n\n", listener), 2U);
+}
+
+TEST_F(binance_future_parser_test_t, ParseDepthUpdate) {
+    std::string_view message = R"({"e":"depthUpdate","E":1760083106579,"T":1760083106570,"s":"BTCUSDT","U":157,"u":160,"pu":149,"b":[["45123.10","1.5"],["45123.00","0"]],"a":[["45123.20","2.25"]]})";
+    DepthOnlyListener depth_listener;
+
+    ASSERT_TRUE(binance_future_parser_t::parse(now(), message, depth_listener));
+    ASSERT_EQ(depth_listener.updates.size(), 1);
+
+    const auto& update = depth_listener.updates[0];
+    EXPECT_EQ(update.update.event_time, 1760083106579ULL);
+    EXPECT_EQ(update.update.transaction_time, 1760083106570ULL);
+    EXPECT_EQ(update.update.first_update_id, 157U);
+    EXPECT_EQ(update.update.final_update_id, 160U);
+    EXPECT_EQ(update.update.previous_update_id, 149U);
+    EXPECT_EQ(update.update.bids.size(), 2U);
+    ASSERT_EQ(update.bids.size(), 2U);
+    EXPECT_DOUBLE_EQ(update.bids[0].price, 45123.10);
+    EXPECT_DOUBLE_EQ(update.bids[0].quantity, 1.5);
+    EXPECT_DOUBLE_EQ(update.bids[1].price, 45123.00);
+    EXPECT_DOUBLE_EQ(update.bids[1].quantity, 0.);
+    ASSERT_EQ(update.asks.size(), 1U);
+    EXPECT_DOUBLE_EQ(update.asks[0].price, 45123.20);
+    EXPECT_DOUBLE_EQ(update.asks[0].quantity, 2.25);
+
+    // Listeners without on_depth_update reject depth updates
+    EXPECT_FALSE(binance_future_parser_t::parse(now(), message, listener));
+}
+
+TEST_F(binance_future_parser_test_t, ParseDepthUpdateWithEmptySide) {
+    std::string_view message = R"({"e":"depthUpdate","E":1,"T":1,"s":"ETHUSDT","U":5,"u":5,"pu":4,"b":[],"a":[["2500.5","3"]]})";
+    DepthOnlyListener depth_listener;
+
+    ASSERT_TRUE(binance_future_parser_t::parse(now(), message, depth_listener));
+    ASSERT_EQ(depth_listener.updates.size(), 1);
+    EXPECT_TRUE(depth_listener.updates[0].update.bids.empty());
+    EXPECT_TRUE(depth_listener.updates[0].bids.empty());
+    ASSERT_EQ(depth_listener.updates[0].asks.size(), 1U);
+    EXPECT_DOUBLE_EQ(depth_listener.updates[0].asks[0].price, 2500.5);
+}
+
+TEST_F(binance_future_parser_test_t, ParseStreamStopsAtPartialDepthUpdate) {
+    std::string complete = R"({"e":"depthUpdate","E":1,"T":1,"s":"BTCUSDT","U":1,"u":2,"pu":0,"b":[["1.0","1"]],"a":[]})" "\n";
+    std::string partial = R"({"e":"depthUpdate","E":2,"T":2,"s":"BTCUSDT","U":3,"u":4,"pu":2,"b":[["1.0","2"]],"a":[["1.1")";
+    std::string buffer = complete + partial;
+    DepthOnlyListener depth_listener;
+
+    EXPECT_EQ(binance_future_parser_t::parse_stream(now(), buffer, depth_listener), complete.size());
+    ASSERT_EQ(depth_listener.updates.size(), 1);
+    EXPECT_EQ(depth_listener.updates[0].update.final_update_id, 2U);
+}
+
+TEST_F(binance_future_parser_test_t, ParseDepthSnapshot) {
+    std::string_view body = R"({"lastUpdateId":1027024,"E":1589436922972,"T":1589436922959,"bids":[["4.00000000","431.00000000"],["3.99000000","12"]],"asks":[["4.00000200","12.00000000"]]})";
+    depth_snapshot_t snapshot;
+
+    ASSERT_TRUE(binance_future_parser_t::parse_depth_snapshot(body, snapshot));
+    EXPECT_EQ(snapshot.last_update_id, 1027024U);
+    EXPECT_EQ(snapshot.event_time, 1589436922972ULL);
+    EXPECT_EQ(snapshot.transaction_time, 1589436922959ULL);
+    EXPECT_EQ(snapshot.bids.size(), 2U);
+    EXPECT_EQ(snapshot.asks.size(), 1U);
+
+    std::vector<depth_level_t> bids;
+    snapshot.bids.for_each([&](const depth_level_t& level) { bids.push_back(level); });
+    ASSERT_EQ(bids.size(), 2U);
+    EXPECT_DOUBLE_EQ(bids[0].price, 4.0);
+    EXPECT_DOUBLE_EQ(bids[0].quantity, 431.0);
+    EXPECT_DOUBLE_EQ(bids[1].price, 3.99);
+
+    depth_snapshot_t missing;
+    EXPECT_FALSE(binance_future_parser_t::parse_depth_snapshot(R"({"code":-1121,"msg":"Invalid symbol."})", missing));
+}
+
 int main(int argc, char **argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
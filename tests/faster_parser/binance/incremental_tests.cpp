@@ -0,0 +1,138 @@
+/**
+ * @file incremental_tests.cpp
+ * @author Kevin Rodrigues
+ * @brief Tests for the resumable ticker array parser
+ * @version 1.0
+ * @date 16/10/2026
+ */
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include <faster_parser/binance/incremental.h>
+
+using namespace core::faster_parser::binance;
+using namespace core::faster_parser::binance::types;
+
+namespace {
+    struct ticker_record_t {
+        std::string symbol;
+        uint64_t event_time;
+        double last_price;
+        uint64_t total_trades;
+
+        bool operator==(ticker_record_t const &) const = default;
+    };
+
+    class RecordingListener {
+    public:
+        std::vector<ticker_record_t> tickers;
+
+        void on_ticker(const ticker_t &ticker) {
+            tickers.push_back({std::string(ticker.symbol), ticker.event_time, ticker.last_price, ticker.total_trades});
+        }
+    };
+
+    std::string ticker_array(size_t count) {
+        std::string out = "[";
+        for (size_t i = 0; i < count; ++i) {
+            if (i) out += ",";
+            out += R"({"e":"24hrTicker","E":)" + std::to_string(1000 + i) + R"(,"s":"SYM)" + std::to_string(i) +
+                   R"(USDT","p":"0.0015","P":"250.00","w":"0.0018","c":")" + std::to_string(i) +
+                   R"(.25","Q":"10","o":"0.0010","h":"0.0025","l":"0.0010","v":"10000","q":"18","O":0,"C":86400000,"F":0,"L":18150,"n":)" +
+                   std::to_string(i * 7) + "}";
+        }
+        out += "]";
+        return out;
+    }
+
+    std::vector<ticker_record_t> reference(std::string const &frame) {
+        RecordingListener listener;
+        binance_future_parser_t::process_ticker_array(std::chrono::system_clock::now(), frame, listener);
+        return listener.tickers;
+    }
+}
+
+TEST(ticker_array_stream_test_t, WholeFrameInOneChunk) {
+    std::string frame = ticker_array(5);
+    ticker_array_stream_t stream;
+    RecordingListener listener;
+
+    EXPECT_TRUE(stream.feed(std::chrono::system_clock::now(), frame, listener));
+    EXPECT_TRUE(stream.done());
+    EXPECT_EQ(stream.emitted(), 5U);
+    EXPECT_EQ(listener.tickers, reference(frame));
+}
+
+TEST(ticker_array_stream_test_t, EveryChunkSizeMatchesContiguousParse) {
+    std::string frame = ticker_array(4);
+    auto expected = reference(frame);
+
+    for (size_t chunk_size = 1; chunk_size <= frame.size(); chunk_size += (chunk_size < 64 ? 1 : 37)) {
+        ticker_array_stream_t stream;
+        RecordingListener listener;
+        for (size_t offset = 0; offset < frame.size(); offset += chunk_size) {
+            ASSERT_TRUE(stream.feed(std::chrono::system_clock::now(), std::string_view(frame).substr(offset, chunk_size), listener));
+        }
+        EXPECT_TRUE(stream.done()) << "chunk size " << chunk_size;
+        EXPECT_EQ(listener.tickers, expected) << "chunk size " << chunk_size;
+    }
+}
+
+TEST(ticker_array_stream_test_t, EmitsTickerAsSoonAsItCloses) {
+    std::string frame = ticker_array(3);
+    size_t first_close = frame.find('}');
+    ticker_array_stream_t stream;
+    RecordingListener listener;
+
+    EXPECT_TRUE(stream.feed(std::chrono::system_clock::now(), std::string_view(frame).substr(0, first_close), listener));
+    EXPECT_TRUE(listener.tickers.empty());
+
+    EXPECT_TRUE(stream.feed(std::chrono::system_clock::now(), std::string_view(frame).substr(first_close, 1), listener));
+    ASSERT_EQ(listener.tickers.size(), 1U);
+    EXPECT_EQ(listener.tickers[0].symbol, "SYM0USDT");
+    EXPECT_FALSE(stream.done());
+}
+
+TEST(ticker_array_stream_test_t, ResetStartsANewFrame) {
+    ticker_array_stream_t stream;
+    RecordingListener listener;
+    std::string frame = ticker_array(2);
+
+    EXPECT_TRUE(stream.feed(std::chrono::system_clock::now(), std::string_view(frame).substr(0, 50), listener));
+    stream.reset();
+    EXPECT_TRUE(stream.feed(std::chrono::system_clock::now(), frame, listener));
+
+    EXPECT_TRUE(stream.done());
+    EXPECT_EQ(listener.tickers, reference(frame));
+}
+
+TEST(ticker_array_stream_test_t, EmptyArray) {
+    ticker_array_stream_t stream;
+    RecordingListener listener;
+
+    EXPECT_TRUE(stream.feed(std::chrono::system_clock::now(), " [", listener));
+    EXPECT_TRUE(stream.feed(std::chrono::system_clock::now(), "]", listener));
+    EXPECT_TRUE(stream.done());
+    EXPECT_TRUE(listener.tickers.empty());
+}
+
+TEST(ticker_array_stream_test_t, MalformedInputFails) {
+    ticker_array_stream_t stream;
+    RecordingListener listener;
+
+    EXPECT_FALSE(stream.feed(std::chrono::system_clock::now(), R"({"e":"24hrTicker"})", listener));
+    EXPECT_TRUE(stream.failed());
+    EXPECT_FALSE(stream.feed(std::chrono::system_clock::now(), "[", listener));
+
+    ticker_array_stream_t oversized;
+    EXPECT_TRUE(oversized.feed(std::chrono::system_clock::now(), "[{", listener));
+    EXPECT_FALSE(oversized.feed(std::chrono::system_clock::now(), std::string(ticker_array_stream_t::max_element_size, 'x'), listener));
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
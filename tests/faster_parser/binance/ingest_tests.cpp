@@ -0,0 +1,210 @@
+/**
+ * @file ingest_tests.cpp
+ * @author Kevin Rodrigues
+ * @brief Tests for the io_uring ingest loop
+ * @version 1.0
+ * @date 16/10/2026
+ */
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <faster_parser/binance/ingest.h>
+#include <faster_parser/binance/websocket.h>
+#include <faster_parser/websocket/frame.h>
+
+using namespace core::faster_parser::binance;
+using namespace core::faster_parser::binance::types;
+
+namespace {
+    std::string agg_trade(uint64_t id) {
+        return R"({"e":"aggTrade","E":123456789,"s":"BTCUSDT","a":)" + std::to_string(id) +
+               R"(,"p":"0.001","q":"100","f":100,"l":105,"T":123456785,"m":true})";
+    }
+
+    class CountingListener {
+    public:
+        size_t trades = 0;
+        uint64_t id_sum = 0;
+        uint64_t last_id = 0;
+        bool in_order = true;
+
+        void on_trade(const trade_t &trade) {
+            if (trades && trade.agg_trade_id != last_id + 1) in_order = false;
+            ++trades;
+            id_sum += trade.agg_trade_id;
+            last_id = trade.agg_trade_id;
+        }
+    };
+
+    // Writes `stream` to `fd` in pieces of `piece` bytes, then closes it
+    std::thread serve(int fd, std::string stream, size_t piece) {
+        return std::thread([fd, stream = std::move(stream), piece] {
+            for (size_t offset = 0; offset < stream.size(); offset += piece) {
+                size_t length = std::min(piece, stream.size() - offset);
+                ASSERT_EQ(::write(fd, stream.data() + offset, length), static_cast<ssize_t>(length));
+            }
+            ::close(fd);
+        });
+    }
+
+    std::string ndjson(size_t count) {
+        std::string out;
+        for (size_t i = 1; i <= count; ++i) {
+            out += agg_trade(i);
+            out += '\n';
+        }
+        return out;
+    }
+
+    uint64_t id_sum(size_t count) { return count * (count + 1) / 2; }
+}
+
+class uring_ingest_test_t : public ::testing::Test {
+protected:
+    void SetUp() override {
+        int sockets[2];
+        ASSERT_EQ(::socketpair(AF_UNIX, SOCK_STREAM, 0, sockets), 0);
+        client = sockets[0];
+        server = sockets[1];
+    }
+
+    void TearDown() override {
+        if (server >= 0) ::close(server);
+    }
+
+    // Hands the client socket to the ingest, skipping the test where io_uring is unavailable
+    bool open(uring_ingest_t &ingest, uring_ingest_t::options_t options = {}) {
+        if (!ingest.open(client, options)) {
+            ::close(client);
+            return false;
+        }
+        return true;
+    }
+
+    int client = -1;
+    int server = -1;
+};
+
+TEST_F(uring_ingest_test_t, ParsesNewlineDelimitedStream) {
+    uring_ingest_t ingest;
+    if (!open(ingest)) GTEST_SKIP() << "io_uring unavailable";
+
+    constexpr size_t count = 5000;
+    std::thread writer = serve(std::exchange(server, -1), ndjson(count), 4096);
+
+    CountingListener listener;
+    EXPECT_TRUE(ingest.run_ndjson(listener));
+    writer.join();
+
+    EXPECT_TRUE(ingest.eof());
+    EXPECT_EQ(ingest.error(), 0);
+    EXPECT_EQ(ingest.pending(), 0U);
+    EXPECT_EQ(listener.trades, count);
+    EXPECT_EQ(listener.id_sum, id_sum(count));
+    EXPECT_TRUE(listener.in_order);
+}
+
+TEST_F(uring_ingest_test_t, CompletesMessagesSplitAcrossSmallBuffers) {
+    uring_ingest_t ingest;
+    // Buffers shorter than a message: every message straddles several receives
+    if (!open(ingest, {.buffer_count = 16, .buffer_size = 64})) GTEST_SKIP() << "io_uring unavailable";
+
+    constexpr size_t count = 500;
+    std::thread writer = serve(std::exchange(server, -1), ndjson(count), 37);
+
+    CountingListener listener;
+    EXPECT_TRUE(ingest.run_ndjson(listener));
+    writer.join();
+
+    EXPECT_EQ(listener.trades, count);
+    EXPECT_EQ(listener.id_sum, id_sum(count));
+    EXPECT_TRUE(listener.in_order);
+}
+
+TEST_F(uring_ingest_test_t, FeedsWebSocketFrames) {
+    uring_ingest_t ingest;
+    if (!open(ingest, {.buffer_count = 8, .buffer_size = 1024})) GTEST_SKIP() << "io_uring unavailable";
+
+    constexpr size_t count = 2000;
+    std::string stream;
+    for (size_t i = 1; i <= count; ++i) {
+        core::faster_parser::websocket::encode_frame(stream, core::faster_parser::websocket::opcode_t::text, agg_trade(i));
+    }
+    std::thread writer = serve(std::exchange(server, -1), std::move(stream), 1000);
+
+    CountingListener listener;
+    websocket_feed_t feed(listener);
+    auto consumer = [&](std::span<char> buffer) { return feed.feed(std::chrono::system_clock::now(), buffer); };
+    EXPECT_TRUE(ingest.run(consumer));
+    writer.join();
+
+    EXPECT_FALSE(feed.failed());
+    EXPECT_EQ(listener.trades, count);
+    EXPECT_EQ(listener.id_sum, id_sum(count));
+    EXPECT_TRUE(listener.in_order);
+}
+
+TEST_F(uring_ingest_test_t, RejectsOversizedMessage) {
+    uring_ingest_t ingest;
+    if (!open(ingest, {.buffer_count = 4, .buffer_size = 256, .max_message_size = 1024})) GTEST_SKIP() << "io_uring unavailable";
+
+    // No newline and never a complete message
+    std::thread writer = serve(std::exchange(server, -1), std::string(8192, 'x'), 512);
+
+    CountingListener listener;
+    EXPECT_FALSE(ingest.run_ndjson(listener));
+    writer.join();
+
+    EXPECT_EQ(ingest.error(), EMSGSIZE);
+}
+
+TEST(uring_ingest_tcp_test_t, ParsesFromLoopbackTcpServer) {
+    int listen_fd = ::socket(AF_INET, SOCK_STREAM, 0);
+    ASSERT_GE(listen_fd, 0);
+    sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    ASSERT_EQ(::bind(listen_fd, reinterpret_cast<sockaddr *>(&address), sizeof(address)), 0);
+    ASSERT_EQ(::listen(listen_fd, 1), 0);
+    socklen_t length = sizeof(address);
+    ASSERT_EQ(::getsockname(listen_fd, reinterpret_cast<sockaddr *>(&address), &length), 0);
+
+    constexpr size_t count = 20000;
+    std::thread server([listen_fd] {
+        int fd = ::accept(listen_fd, nullptr, nullptr);
+        ASSERT_GE(fd, 0);
+        std::string stream = ndjson(count);
+        ASSERT_EQ(::write(fd, stream.data(), stream.size()), static_cast<ssize_t>(stream.size()));
+        ::close(fd);
+    });
+
+    int fd = ::socket(AF_INET, SOCK_STREAM, 0);
+    ASSERT_EQ(::connect(fd, reinterpret_cast<sockaddr *>(&address), sizeof(address)), 0);
+
+    uring_ingest_t ingest;
+    CountingListener listener;
+    if (ingest.open(fd)) {
+        EXPECT_TRUE(ingest.run_ndjson(listener));
+    } else {
+        ::close(fd);
+    }
+    server.join();
+    ::close(listen_fd);
+
+    if (!ingest.eof()) GTEST_SKIP() << "io_uring unavailable";
+    EXPECT_EQ(listener.trades, count);
+    EXPECT_EQ(listener.id_sum, id_sum(count));
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,767 @@
+/**
+ * @file listeners_tests.cpp
+ * @author Kevin Rodrigues
+ * @brief Tests for the ready-made Binance listeners and the symbol registry
+ * @version 1.0
+ * @date 16/10/2026
+ */
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <cmath>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+
+#include <faster_parser/binance/future.h>
+#include <faster_parser/binance/listeners/bus_publisher.h>
+#include <faster_parser/binance/listeners/conflation.h>
+#include <faster_parser/binance/listeners/latency_recorder.h>
+#include <faster_parser/binance/listeners/ring_writer.h>
+#include <faster_parser/binance/listeners/sequence_checker.h>
+#include <faster_parser/binance/listeners/top_of_book.h>
+#include <faster_parser/binance/listeners/trade_bars.h>
+#include <faster_parser/binance/listeners/trade_columns.h>
+#include <faster_parser/binance/symbol_registry.h>
+
+using namespace core::faster_parser::binance;
+using namespace core::faster_parser::binance::types;
+
+// ============================================================================
+// Symbol Registry Tests
+// ============================================================================
+
+TEST(symbol_registry_test_t, InternAssignsDenseIds) {
+    symbol_registry_t registry(16);
+
+    EXPECT_EQ(registry.intern("BTCUSDT"), 0U);
+    EXPECT_EQ(registry.intern("ETHUSDT"), 1U);
+    EXPECT_EQ(registry.intern("BTCUSDT"), 0U);
+    EXPECT_EQ(registry.size(), 2U);
+
+    EXPECT_EQ(registry.find("ETHUSDT"), 1U);
+    EXPECT_EQ(registry.find("SOLUSDT"), invalid_symbol_id);
+    EXPECT_EQ(registry.symbol(1).view(), "ETHUSDT");
+}
+
+TEST(symbol_registry_test_t, FullRegistryReturnsInvalidId) {
+    symbol_registry_t registry(2);
+
+    EXPECT_EQ(registry.intern("A"), 0U);
+    EXPECT_EQ(registry.intern("B"), 1U);
+    EXPECT_EQ(registry.intern("C"), invalid_symbol_id);
+    EXPECT_EQ(registry.intern("A"), 0U);
+}
+
+TEST(symbol_registry_test_t, ManySymbols) {
+    symbol_registry_t registry(1000);
+    for (int i = 0; i < 1000; ++i) {
+        EXPECT_EQ(registry.intern("SYM" + std::to_string(i)), static_cast<symbol_id_t>(i));
+    }
+    for (int i = 0; i < 1000; ++i) {
+        EXPECT_EQ(registry.find("SYM" + std::to_string(i)), static_cast<symbol_id_t>(i));
+    }
+}
+
+// ============================================================================
+// Trade Columns Tests
+// ============================================================================
+
+TEST(trade_columns_test_t, AppendsEveryFieldToItsColumn) {
+    listeners::trade_columns_t columns(4);
+    auto now = std::chrono::system_clock::now();
+
+    std::vector<std::string> messages = {
+        R"({"e":"aggTrade","E":1,"s":"BTCUSDT","a":10,"p":"50000.5","q":"0.1","f":100,"l":101,"T":2,"m":true})",
+        R"({"e":"aggTrade","E":3,"s":"ETHUSDT","a":11,"p":"3500.25","q":"2","f":102,"l":102,"T":4,"m":false})",
+        R"({"e":"aggTrade","E":5,"s":"BTCUSDT","a":12,"p":"50001","q":"0.3","f":103,"l":105,"T":6,"m":false})",
+        R"({"e":"bookTicker","u":1,"s":"BTCUSDT","b":"50000","B":"1","a":"50001","A":"1","T":1,"E":1})",
+    };
+    for (size_t i = 0; i < 3; ++i) {
+        EXPECT_TRUE(binance_future_parser_t::parse(now, messages[i], columns));
+    }
+    EXPECT_FALSE(binance_future_parser_t::parse(now, messages[3], columns));
+
+    ASSERT_EQ(columns.size(), 3U);
+    EXPECT_DOUBLE_EQ(columns.price()[0], 50000.5);
+    EXPECT_DOUBLE_EQ(columns.price()[1], 3500.25);
+    EXPECT_DOUBLE_EQ(columns.quantity()[2], 0.3);
+    EXPECT_EQ(columns.agg_trade_id()[1], 11U);
+    EXPECT_EQ(columns.first_trade_id()[2], 103U);
+    EXPECT_EQ(columns.last_trade_id()[2], 105U);
+    EXPECT_EQ(columns.event_time()[1], 3U);
+    EXPECT_EQ(columns.trade_time()[2], 6U);
+    EXPECT_EQ(columns.is_buyer_maker()[0], 1);
+    EXPECT_EQ(columns.is_buyer_maker()[1], 0);
+
+    EXPECT_EQ(columns.symbol_id()[0], columns.symbol_id()[2]);
+    EXPECT_NE(columns.symbol_id()[0], columns.symbol_id()[1]);
+    EXPECT_EQ(columns.symbol_registry().symbol(columns.symbol_id()[1]).view(), "ETHUSDT");
+}
+
+TEST(trade_columns_test_t, GrowsPastCapacityHint) {
+    listeners::trade_columns_t columns(2);
+    auto now = std::chrono::system_clock::now();
+    std::string_view message = R"({"e":"aggTrade","E":1,"s":"BTCUSDT","a":10,"p":"1.5","q":"2","f":1,"l":1,"T":1,"m":true})";
+
+    for (int i = 0; i < 5000; ++i) {
+        EXPECT_TRUE(binance_future_parser_t::parse(now, message, columns));
+    }
+
+    ASSERT_EQ(columns.size(), 5000U);
+    EXPECT_DOUBLE_EQ(columns.price()[0], 1.5);
+    EXPECT_DOUBLE_EQ(columns.price()[4999], 1.5);
+    EXPECT_EQ(columns.symbol_id()[4999], 0U);
+}
+
+TEST(trade_columns_test_t, ClearKeepsCapacityAndSymbols) {
+    listeners::trade_columns_t columns(1024);
+    auto now = std::chrono::system_clock::now();
+    std::string_view message = R"({"e":"aggTrade","E":1,"s":"BTCUSDT","a":10,"p":"1.5","q":"2","f":1,"l":1,"T":1,"m":true})";
+
+    EXPECT_TRUE(binance_future_parser_t::parse(now, message, columns));
+    columns.clear();
+    EXPECT_TRUE(columns.empty());
+
+    EXPECT_TRUE(binance_future_parser_t::parse(now, message, columns));
+    ASSERT_EQ(columns.size(), 1U);
+    EXPECT_EQ(columns.agg_trade_id()[0], 10U);
+    EXPECT_EQ(columns.symbol_id()[0], 0U);
+}
+
+// ============================================================================
+// Event Ring Writer Tests
+// ============================================================================
+
+TEST(event_ring_writer_test_t, WritesCompactEventsIntoSlots) {
+    listeners::event_ring_t ring(16);
+    listeners::event_ring_writer_t writer(ring);
+    auto now = std::chrono::system_clock::now();
+
+    std::vector<std::string> messages = {
+        R"({"e":"bookTicker","u":400900217,"s":"BNBUSDT","b":"25.35190000","B":"31.21000000","a":"25.36520000","A":"40.66000000","T":1568014460891,"E":1568014460893})",
+        R"({"e":"aggTrade","E":123456789,"s":"BTCUSDT","a":5933014,"p":"0.001","q":"100","f":100,"l":105,"T":123456785,"m":true})",
+        R"({"e":"24hrTicker","E":123456789,"s":"BTCUSDT","p":"0.0015","P":"250.00","w":"0.0018","c":"0.0025","Q":"10","o":"0.0010","h":"0.0025","l":"0.0010","v":"10000","q":"18","O":0,"C":86400000,"F":0,"L":18150,"n":18151})",
+    };
+    for (const auto &message : messages) {
+        EXPECT_TRUE(binance_future_parser_t::parse(now, message, writer));
+    }
+    EXPECT_EQ(writer.written(), 3U);
+
+    std::vector<event_slot_t> slots;
+    EXPECT_EQ(ring.consume([&](event_slot_t const &slot) { slots.push_back(slot); }), 3U);
+    ASSERT_EQ(slots.size(), 3U);
+
+    ASSERT_EQ(slots[0].type, event_type_t::book_ticker);
+    EXPECT_EQ(slots[0].time(), now);
+    EXPECT_EQ(slots[0].book_ticker.update_id, 400900217U);
+    EXPECT_DOUBLE_EQ(slots[0].book_ticker.ask_price, 25.3652);
+    EXPECT_EQ(slots[0].book_ticker.symbol.view(), "BNBUSDT");
+
+    ASSERT_EQ(slots[1].type, event_type_t::trade);
+    EXPECT_EQ(slots[1].trade.agg_trade_id, 5933014U);
+    EXPECT_EQ(slots[1].trade.last_trade_id(), 105U);
+    EXPECT_TRUE(slots[1].trade.is_buyer_maker());
+
+    ASSERT_EQ(slots[2].type, event_type_t::ticker);
+    EXPECT_EQ(slots[2].ticker.total_trades, 18151U);
+    EXPECT_EQ(slots[2].ticker.symbol.view(), "BTCUSDT");
+
+    size_t trades = 0;
+    EXPECT_TRUE(slots[1].visit([&](auto const &event) {
+        if constexpr (std::is_same_v<std::decay_t<decltype(event)>, trade_compact_t>) ++trades;
+    }));
+    EXPECT_EQ(trades, 1U);
+}
+
+TEST(event_ring_writer_test_t, BookTradeSlotsCarryNoTickers) {
+    static_assert(sizeof(book_trade_slot_t) == 2 * cache_line_size);
+    static_assert(!TickerListener<listeners::book_trade_ring_writer_t>);
+    static_assert(TickerListener<listeners::event_ring_writer_t>);
+
+    listeners::book_trade_ring_t ring(16);
+    listeners::book_trade_ring_writer_t writer(ring);
+    auto now = std::chrono::system_clock::now();
+
+    EXPECT_TRUE(binance_future_parser_t::parse(now, std::string_view(R"({"e":"bookTicker","u":400900217,"s":"BNBUSDT","b":"25.35190000","B":"31.21000000","a":"25.36520000","A":"40.66000000","T":1568014460891,"E":1568014460893})"), writer));
+    EXPECT_FALSE(binance_future_parser_t::parse(now, std::string_view(R"({"e":"24hrTicker","E":123456789,"s":"BTCUSDT","p":"0.0015","P":"250.00","w":"0.0018","c":"0.0025","Q":"10","o":"0.0010","h":"0.0025","l":"0.0010","v":"10000","q":"18","O":0,"C":86400000,"F":0,"L":18150,"n":18151})"), writer));
+    EXPECT_TRUE(binance_future_parser_t::parse(now, std::string_view(R"({"e":"aggTrade","E":123456789,"s":"BTCUSDT","a":5933014,"p":"0.001","q":"100","f":100,"l":105,"T":123456785,"m":true})"), writer));
+    EXPECT_EQ(writer.written(), 2U);
+
+    std::vector<book_trade_slot_t> slots;
+    EXPECT_EQ(ring.consume([&](book_trade_slot_t const &slot) { slots.push_back(slot); }), 2U);
+    ASSERT_EQ(slots.size(), 2U);
+    ASSERT_EQ(slots[0].type, event_type_t::book_ticker);
+    EXPECT_EQ(slots[0].time(), now);
+    EXPECT_EQ(slots[0].book_ticker.update_id, 400900217U);
+    ASSERT_EQ(slots[1].type, event_type_t::trade);
+    EXPECT_EQ(slots[1].trade.agg_trade_id, 5933014U);
+
+    size_t visited = 0;
+    for (auto const &slot : slots) {
+        EXPECT_TRUE(slot.visit([&](auto const &) { ++visited; }));
+    }
+    EXPECT_EQ(visited, 2U);
+}
+
+TEST(event_ring_writer_test_t, BatchesPublishUntilFlush) {
+    listeners::event_ring_t ring(16);
+    listeners::event_ring_writer_t writer(ring, 4);
+    auto now = std::chrono::system_clock::now();
+    std::string_view message = R"({"e":"aggTrade","E":1,"s":"BTCUSDT","a":10,"p":"1.5","q":"2","f":1,"l":1,"T":1,"m":true})";
+
+    for (int i = 0; i < 5; ++i) {
+        EXPECT_TRUE(binance_future_parser_t::parse(now, message, writer));
+    }
+    // One full batch is visible, the fifth event waits for flush()
+    EXPECT_EQ(ring.size(), 4U);
+    writer.flush();
+    EXPECT_EQ(ring.size(), 5U);
+}
+
+TEST(event_ring_writer_test_t, DropsWhenConsumerFallsBehind) {
+    listeners::event_ring_t ring(4);
+    listeners::event_ring_writer_t writer(ring);
+    auto now = std::chrono::system_clock::now();
+    std::string_view message = R"({"e":"aggTrade","E":1,"s":"BTCUSDT","a":10,"p":"1.5","q":"2","f":1,"l":1,"T":1,"m":true})";
+
+    for (int i = 0; i < 6; ++i) {
+        EXPECT_TRUE(binance_future_parser_t::parse(now, message, writer));
+    }
+    EXPECT_EQ(writer.written(), 4U);
+    EXPECT_EQ(writer.dropped(), 2U);
+}
+
+// ============================================================================
+// Event Bus Publisher Tests
+// ============================================================================
+
+TEST(event_bus_publisher_test_t, ReadersSeeParsedEventsInSlots) {
+    const std::string name = "/faster_parser_bus_" + std::to_string(::getpid());
+    listeners::event_bus_writer_t bus;
+    ASSERT_TRUE(bus.create(name.c_str(), 64));
+    listeners::event_bus_reader_t reader;
+    ASSERT_TRUE(reader.open(name.c_str()));
+
+    listeners::event_bus_publisher_t publisher(bus);
+    auto now = std::chrono::system_clock::now();
+    EXPECT_TRUE(binance_future_parser_t::parse(now, std::string_view(R"({"e":"bookTicker","u":400900217,"s":"BNBUSDT","b":"25.35190000","B":"31.21000000","a":"25.36520000","A":"40.66000000","T":1568014460891,"E":1568014460893})"), publisher));
+    EXPECT_TRUE(binance_future_parser_t::parse(now, std::string_view(R"({"e":"aggTrade","E":123456789,"s":"BTCUSDT","a":5933014,"p":"0.001","q":"100","f":100,"l":105,"T":123456785,"m":true})"), publisher));
+    EXPECT_EQ(publisher.published(), 2U);
+
+    std::vector<event_slot_t> slots;
+    EXPECT_EQ(reader.poll([&](event_slot_t const &slot) { slots.push_back(slot); }), 2U);
+    ASSERT_EQ(slots.size(), 2U);
+    ASSERT_EQ(slots[0].type, event_type_t::book_ticker);
+    EXPECT_EQ(slots[0].time(), now);
+    EXPECT_EQ(slots[0].book_ticker.update_id, 400900217U);
+    EXPECT_EQ(slots[0].book_ticker.symbol.view(), "BNBUSDT");
+    ASSERT_EQ(slots[1].type, event_type_t::trade);
+    EXPECT_EQ(slots[1].trade.agg_trade_id, 5933014U);
+}
+
+// ============================================================================
+// Top Of Book Table Tests
+// ============================================================================
+
+namespace {
+    book_ticker_t make_book_ticker(std::string_view symbol, uint64_t update_id, double price) {
+        book_ticker_t ticker;
+        ticker.symbol = symbol;
+        ticker.bid.price = price;
+        ticker.bid.volume = price * 2;
+        ticker.bid.sequence = update_id;
+        ticker.ask.price = price + 1;
+        ticker.ask.volume = price * 3;
+        ticker.ask.sequence = update_id;
+        ticker.exchange_timestamp = update_id * 10;
+        return ticker;
+    }
+}
+
+TEST(top_of_book_table_test_t, KeepsLatestBookTickerPerSymbol) {
+    listeners::top_of_book_table_t table;
+    auto now = std::chrono::system_clock::now();
+    EXPECT_TRUE(binance_future_parser_t::parse(now, std::string_view(R"({"e":"bookTicker","u":400900217,"s":"BNBUSDT","b":"25.35190000","B":"31.21000000","a":"25.36520000","A":"40.66000000","T":1568014460891,"E":1568014460893})"), table));
+    EXPECT_FALSE(binance_future_parser_t::parse(now, std::string_view(R"({"e":"aggTrade","E":123456789,"s":"BTCUSDT","a":5933014,"p":"0.001","q":"100","f":100,"l":105,"T":123456785,"m":true})"), table));
+    table.on_book_ticker(make_book_ticker("BTCUSDT", 7, 100.));
+    table.on_book_ticker(make_book_ticker("BTCUSDT", 8, 101.));
+
+    ASSERT_EQ(table.size(), 2U);
+    const symbol_id_t bnb = table.find("BNBUSDT");
+    const symbol_id_t btc = table.find("BTCUSDT");
+    ASSERT_NE(bnb, invalid_symbol_id);
+    ASSERT_NE(btc, invalid_symbol_id);
+    EXPECT_EQ(table.find("ETHUSDT"), invalid_symbol_id);
+    EXPECT_EQ(table.symbol(btc).view(), "BTCUSDT");
+
+    listeners::top_of_book_t book;
+    ASSERT_TRUE(table.snapshot(bnb, book));
+    EXPECT_DOUBLE_EQ(book.bid_price, 25.3519);
+    EXPECT_DOUBLE_EQ(book.ask_volume, 40.66);
+    EXPECT_EQ(book.update_id, 400900217U);
+    EXPECT_EQ(book.exchange_timestamp, 1568014460893U);
+    EXPECT_EQ(book.receive_time, now.time_since_epoch().count());
+
+    ASSERT_TRUE(table.snapshot(btc, book));
+    EXPECT_DOUBLE_EQ(book.bid_price, 101.);
+    EXPECT_DOUBLE_EQ(book.ask_price, 102.);
+    EXPECT_EQ(table.update_id(btc), 8U);
+    EXPECT_EQ(table.version(btc), 2U);
+}
+
+TEST(top_of_book_table_test_t, IgnoresOlderUpdatesAndUnknownIds) {
+    listeners::top_of_book_table_t table(2);
+    table.on_book_ticker(make_book_ticker("BTCUSDT", 10, 100.));
+    table.on_book_ticker(make_book_ticker("BTCUSDT", 9, 50.));
+    EXPECT_EQ(table.stale(), 1U);
+    EXPECT_EQ(table.update_id(table.find("BTCUSDT")), 10U);
+
+    // Interned during setup, no ticker yet
+    const symbol_id_t eth = table.intern("ETHUSDT");
+    listeners::top_of_book_t book;
+    EXPECT_FALSE(table.snapshot(eth, book));
+    EXPECT_EQ(table.update_id(eth), 0U);
+    EXPECT_FALSE(table.snapshot(5, book));
+
+    table.on_book_ticker(make_book_ticker("SOLUSDT", 1, 1.));
+    EXPECT_EQ(table.dropped(), 1U);
+}
+
+TEST(top_of_book_table_test_t, ReadersNeverSeeTornEntries) {
+    listeners::top_of_book_table_t table;
+    const symbol_id_t id = table.intern("BTCUSDT");
+    constexpr uint64_t updates = 200'000;
+    std::atomic<bool> done{false};
+
+    auto read = [&] {
+        size_t torn = 0;
+        uint64_t last = 0;
+        listeners::top_of_book_t book;
+        while (!done.load(std::memory_order_acquire)) {
+            if (!table.snapshot(id, book)) continue;
+            const auto expected = static_cast<double>(book.update_id);
+            torn += book.bid_price != expected || book.ask_price != expected + 1 ||
+                    book.bid_volume != expected * 2 || book.ask_volume != expected * 3 ||
+                    book.exchange_timestamp != book.update_id * 10 || book.update_id < last;
+            last = book.update_id;
+        }
+        return torn;
+    };
+
+    size_t torn_a = 0, torn_b = 0;
+    std::thread reader_a([&] { torn_a = read(); });
+    std::thread reader_b([&] { torn_b = read(); });
+    for (uint64_t i = 1; i <= updates; ++i) {
+        table.on_book_ticker(make_book_ticker("BTCUSDT", i, static_cast<double>(i)));
+    }
+    done.store(true, std::memory_order_release);
+    reader_a.join();
+    reader_b.join();
+
+    EXPECT_EQ(torn_a, 0U);
+    EXPECT_EQ(torn_b, 0U);
+    EXPECT_EQ(table.update_id(id), updates);
+}
+
+// ============================================================================
+// Conflating Cache Tests
+// ============================================================================
+
+TEST(conflating_cache_test_t, DrainsOnlyDirtySymbolsWithTheirLatestValue) {
+    listeners::conflating_cache_t cache;
+    for (uint64_t i = 1; i <= 5; ++i) {
+        cache.on_book_ticker(make_book_ticker("BTCUSDT", i, 100. + static_cast<double>(i)));
+    }
+    cache.on_book_ticker(make_book_ticker("ETHUSDT", 42, 10.));
+
+    std::vector<std::pair<std::string, uint64_t>> drained;
+    auto collect = [&](symbol_id_t id, listeners::conflating_cache_t::book_ticker_entry_t const &entry) {
+        EXPECT_EQ(cache.symbol(id), entry.value.symbol);
+        drained.emplace_back(std::string(entry.value.symbol.view()), entry.value.update_id);
+    };
+    EXPECT_EQ(cache.drain_book_tickers(collect), 2U);
+    ASSERT_EQ(drained.size(), 2U);
+    EXPECT_EQ(drained[0], (std::pair<std::string, uint64_t>{"BTCUSDT", 5}));
+    EXPECT_EQ(drained[1], (std::pair<std::string, uint64_t>{"ETHUSDT", 42}));
+
+    // Nothing changed since
+    EXPECT_EQ(cache.drain_book_tickers(collect), 0U);
+
+    drained.clear();
+    cache.on_book_ticker(make_book_ticker("ETHUSDT", 43, 11.));
+    EXPECT_EQ(cache.drain_book_tickers([&](symbol_id_t, auto const &entry) {
+        EXPECT_EQ(entry.updates, 2U);
+        EXPECT_DOUBLE_EQ(entry.value.bid_price, 11.);
+    }), 1U);
+    EXPECT_EQ(cache.drain_tickers([](symbol_id_t, auto const &) {}), 0U);
+}
+
+TEST(conflating_cache_test_t, ConflatesTickersParsedFromTheFeed) {
+    listeners::conflating_cache_t cache(4);
+    auto now = std::chrono::system_clock::now();
+    std::string array = R"([{"e":"24hrTicker","E":1,"s":"BTCUSDT","p":"0.0015","P":"250.00","w":"0.0018","c":"0.0025","Q":"10","o":"0.0010","h":"0.0025","l":"0.0010","v":"10000","q":"18","O":0,"C":86400000,"F":0,"L":18150,"n":1},)"
+                        R"({"e":"24hrTicker","E":2,"s":"BTCUSDT","p":"0.0015","P":"250.00","w":"0.0018","c":"0.0030","Q":"10","o":"0.0010","h":"0.0025","l":"0.0010","v":"10000","q":"18","O":0,"C":86400000,"F":0,"L":18150,"n":2}])";
+    EXPECT_TRUE(binance_future_parser_t::parse(now, array, cache));
+
+    size_t drained = 0;
+    cache.drain_tickers([&](symbol_id_t, listeners::conflating_cache_t::ticker_entry_t const &entry) {
+        ++drained;
+        EXPECT_EQ(entry.value.total_trades, 2U);
+        EXPECT_DOUBLE_EQ(entry.value.last_price, 0.003);
+        EXPECT_EQ(entry.receive_time, now.time_since_epoch().count());
+        EXPECT_EQ(entry.updates, 2U);
+    });
+    EXPECT_EQ(drained, 1U);
+
+    for (auto symbol : {"A1", "A2", "A3", "A4"}) cache.on_book_ticker(make_book_ticker(symbol, 1, 1.));
+    EXPECT_EQ(cache.dropped(), 1U);
+}
+
+TEST(conflating_cache_test_t, ConsumerConvergesOnTheLatestUpdate) {
+    listeners::conflating_cache_t cache(300);
+    std::vector<std::string> names;
+    for (int i = 0; i < 300; ++i) names.push_back("SYM" + std::to_string(i));
+    constexpr uint64_t rounds = 500;
+    std::atomic<bool> done{false};
+
+    std::thread producer([&] {
+        for (uint64_t round = 1; round <= rounds; ++round) {
+            for (auto const &name : names) cache.on_book_ticker(make_book_ticker(name, round, static_cast<double>(round)));
+        }
+        done.store(true, std::memory_order_release);
+    });
+
+    std::vector<uint64_t> latest(300, 0);
+    size_t torn = 0;
+    auto on_entry = [&](symbol_id_t id, listeners::conflating_cache_t::book_ticker_entry_t const &entry) {
+        torn += entry.value.bid_price != static_cast<double>(entry.value.update_id) || entry.value.update_id < latest[id];
+        latest[id] = entry.value.update_id;
+    };
+    while (!done.load(std::memory_order_acquire)) cache.drain_book_tickers(on_entry);
+    producer.join();
+    cache.drain_book_tickers(on_entry);
+
+    EXPECT_EQ(torn, 0U);
+    for (uint64_t update_id : latest) EXPECT_EQ(update_id, rounds);
+}
+
+// ============================================================================
+// Sequence Checker Tests
+// ============================================================================
+
+namespace {
+    struct sequence_recorder_t {
+        std::vector<trade_t> trades;
+        std::vector<uint64_t> book_update_ids;
+        std::vector<sequence_event_t> events;
+
+        void on_trade(const trade_t &trade) { trades.push_back(trade); }
+        void on_book_ticker(const book_ticker_t &ticker) { book_update_ids.push_back(ticker.bid.sequence); }
+        void on_sequence_event(const sequence_event_t &event) { events.push_back(event); }
+    };
+
+    struct trade_sink_t {
+        size_t trades = 0;
+        void on_trade(const trade_t &) { ++trades; }
+    };
+
+    static_assert(TradeListener<listeners::sequence_checker_t<trade_sink_t>>);
+    static_assert(!BookTickerListener<listeners::sequence_checker_t<trade_sink_t>>);
+    static_assert(!DepthListener<listeners::sequence_checker_t<trade_sink_t>>);
+
+    std::string agg_trade(std::string_view symbol, uint64_t id) {
+        return R"({"e":"aggTrade","E":1,"s":")" + std::string(symbol) + R"(","a":)" + std::to_string(id) +
+               R"(,"p":"1.5","q":"2","f":1,"l":1,"T":1,"m":true})";
+    }
+}
+
+TEST(sequence_checker_test_t, ReportsAggTradeGapsInsideTheParseCall) {
+    sequence_recorder_t recorder;
+    listeners::sequence_checker_t checker(recorder);
+    auto now = std::chrono::system_clock::now();
+
+    std::string buffer;
+    for (uint64_t id : {10, 11, 12, 15, 16}) buffer += agg_trade("BTCUSDT", id) + "\n";
+    buffer += agg_trade("ETHUSDT", 500) + "\n" + agg_trade("ETHUSDT", 501) + "\n";
+    EXPECT_EQ(binance_future_parser_t::parse_stream(now, buffer, checker), buffer.size());
+
+    EXPECT_EQ(recorder.trades.size(), 7U);
+    ASSERT_EQ(recorder.events.size(), 1U);
+    const sequence_event_t &gap = recorder.events[0];
+    EXPECT_EQ(gap.issue, sequence_issue_t::gap);
+    EXPECT_EQ(gap.stream, sequence_stream_t::trade);
+    EXPECT_EQ(gap.symbol, "BTCUSDT");
+    EXPECT_EQ(gap.expected, 13U);
+    EXPECT_EQ(gap.received, 15U);
+    EXPECT_EQ(checker.gaps(), 1U);
+    EXPECT_EQ(checker.missing(), 2U);
+    EXPECT_EQ(checker.last("BTCUSDT", sequence_stream_t::trade), 16U);
+    EXPECT_EQ(checker.last("ETHUSDT", sequence_stream_t::trade), 501U);
+    EXPECT_EQ(checker.last("XRPUSDT", sequence_stream_t::trade), 0U);
+
+    // A reconnect: the next id is taken as the new baseline
+    checker.reset();
+    EXPECT_TRUE(binance_future_parser_t::parse(now, agg_trade("BTCUSDT", 40), checker));
+    EXPECT_EQ(checker.gaps(), 1U);
+}
+
+TEST(sequence_checker_test_t, FlagsDuplicateAndRegressedBookTickers) {
+    sequence_recorder_t recorder;
+    listeners::sequence_checker_t checker(recorder);
+    for (uint64_t id : {100, 250, 250, 180, 300}) checker.on_book_ticker(make_book_ticker("BTCUSDT", id, 1.));
+
+    // Book ticker ids are not contiguous: 100 -> 250 is not a gap
+    EXPECT_EQ(checker.gaps(), 0U);
+    EXPECT_EQ(checker.duplicates(), 1U);
+    EXPECT_EQ(checker.regressions(), 1U);
+    ASSERT_EQ(recorder.events.size(), 2U);
+    EXPECT_EQ(recorder.events[0].issue, sequence_issue_t::duplicate);
+    EXPECT_EQ(recorder.events[1].issue, sequence_issue_t::regression);
+    EXPECT_EQ(recorder.events[1].expected, 251U);
+    EXPECT_EQ(recorder.events[1].received, 180U);
+    EXPECT_EQ(recorder.book_update_ids, (std::vector<uint64_t>{100, 250, 250, 180, 300}));
+
+    sequence_recorder_t filtered;
+    listeners::sequence_checker_t dropping(filtered, 16, true);
+    for (uint64_t id : {100, 250, 250, 180, 300}) dropping.on_book_ticker(make_book_ticker("BTCUSDT", id, 1.));
+    EXPECT_EQ(filtered.book_update_ids, (std::vector<uint64_t>{100, 250, 300}));
+}
+
+TEST(sequence_checker_test_t, ChecksDepthPreviousUpdateId) {
+    struct depth_recorder_t {
+        std::vector<sequence_event_t> events;
+        size_t updates = 0;
+        void on_depth_update(const depth_update_t &) { ++updates; }
+        void on_sequence_event(const sequence_event_t &event) { events.push_back(event); }
+    } recorder;
+    listeners::sequence_checker_t checker(recorder);
+
+    auto depth = [](uint64_t first, uint64_t final, uint64_t previous) {
+        depth_update_t update;
+        update.symbol = "BTCUSDT";
+        update.first_update_id = first;
+        update.final_update_id = final;
+        update.previous_update_id = previous;
+        return update;
+    };
+    checker.on_depth_update(depth(10, 12, 9));
+    checker.on_depth_update(depth(13, 15, 12));
+    checker.on_depth_update(depth(20, 22, 18));
+    checker.on_depth_update(depth(20, 22, 18));
+
+    EXPECT_EQ(recorder.updates, 4U);
+    ASSERT_EQ(recorder.events.size(), 2U);
+    EXPECT_EQ(recorder.events[0].issue, sequence_issue_t::gap);
+    EXPECT_EQ(recorder.events[0].stream, sequence_stream_t::depth);
+    EXPECT_EQ(recorder.events[0].expected, 15U);
+    EXPECT_EQ(recorder.events[0].received, 18U);
+    EXPECT_EQ(recorder.events[1].issue, sequence_issue_t::duplicate);
+}
+
+// ============================================================================
+// Trade Bar Aggregator Tests
+// ============================================================================
+
+namespace {
+    trade_t make_trade(std::string_view symbol, uint64_t id, uint64_t time_ms, double price, double quantity, bool buyer_maker) {
+        trade_t trade{};
+        trade.symbol = symbol;
+        trade.agg_trade_id = id;
+        trade.trade_time = time_ms;
+        trade.event_time = time_ms;
+        trade.price = price;
+        trade.quantity = quantity;
+        trade.is_buyer_maker = buyer_maker;
+        return trade;
+    }
+
+    struct bar_collector_t {
+        std::vector<listeners::trade_bar_t> *bars;
+        void operator()(listeners::trade_bar_t const &bar) const { bars->push_back(bar); }
+    };
+}
+
+TEST(trade_bar_aggregator_test_t, BuildsTimeBarsWithVwapAndTakerVolumes) {
+    std::vector<listeners::trade_bar_t> bars;
+    const listeners::bar_spec_t specs[] = {{listeners::bar_kind_t::time, 1000.}};
+    listeners::trade_bar_aggregator_t aggregator(specs, bar_collector_t{&bars});
+
+    aggregator.on_trade(make_trade("BTCUSDT", 1, 10'100, 100., 1., false));
+    aggregator.on_trade(make_trade("BTCUSDT", 2, 10'400, 103., 2., true));
+    aggregator.on_trade(make_trade("BTCUSDT", 3, 10'999, 99., 1., false));
+    EXPECT_TRUE(bars.empty());
+    ASSERT_NE(aggregator.current("BTCUSDT", 0), nullptr);
+    EXPECT_EQ(aggregator.current("BTCUSDT", 0)->trades, 3U);
+
+    // Next interval (with an empty one in between): the first bar is complete
+    aggregator.on_trade(make_trade("BTCUSDT", 4, 12'000, 101., 4., true));
+    ASSERT_EQ(bars.size(), 1U);
+    const listeners::trade_bar_t &bar = bars[0];
+    EXPECT_EQ(bar.symbol, "BTCUSDT");
+    EXPECT_EQ(bar.open_time, 10'000U);
+    EXPECT_EQ(bar.close_time, 11'000U);
+    EXPECT_DOUBLE_EQ(bar.open, 100.);
+    EXPECT_DOUBLE_EQ(bar.high, 103.);
+    EXPECT_DOUBLE_EQ(bar.low, 99.);
+    EXPECT_DOUBLE_EQ(bar.close, 99.);
+    EXPECT_DOUBLE_EQ(bar.volume, 4.);
+    EXPECT_DOUBLE_EQ(bar.vwap(), (100. + 206. + 99.) / 4.);
+    EXPECT_DOUBLE_EQ(bar.buy_volume, 2.);
+    EXPECT_DOUBLE_EQ(bar.sell_volume, 2.);
+    EXPECT_EQ(bar.trades, 3U);
+    EXPECT_EQ(bar.first_agg_trade_id, 1U);
+    EXPECT_EQ(bar.last_agg_trade_id, 3U);
+
+    // Closed on a timer, without waiting for the next trade
+    EXPECT_EQ(aggregator.close_expired(12'500), 0U);
+    EXPECT_EQ(aggregator.close_expired(13'000), 1U);
+    ASSERT_EQ(bars.size(), 2U);
+    EXPECT_EQ(bars[1].open_time, 12'000U);
+    EXPECT_DOUBLE_EQ(bars[1].open, 101.);
+    EXPECT_EQ(aggregator.current("BTCUSDT", 0), nullptr);
+}
+
+TEST(trade_bar_aggregator_test_t, BuildsVolumeAndTickBarsPerSymbol) {
+    std::vector<listeners::trade_bar_t> bars;
+    const listeners::bar_spec_t specs[] = {{listeners::bar_kind_t::volume, 5.}, {listeners::bar_kind_t::tick, 2.}};
+    listeners::trade_bar_aggregator_t aggregator(specs, bar_collector_t{&bars});
+
+    aggregator.on_trade(make_trade("BTCUSDT", 1, 1, 100., 3., false));
+    aggregator.on_trade(make_trade("ETHUSDT", 1, 2, 10., 9., false));       // Volume bar and nothing else
+    aggregator.on_trade(make_trade("BTCUSDT", 2, 3, 101., 3., false));      // Volume 6 >= 5, 2 ticks
+    aggregator.on_trade(make_trade("BTCUSDT", 3, 4, 102., 1., false));
+
+    ASSERT_EQ(bars.size(), 3U);
+    EXPECT_EQ(bars[0].symbol, "ETHUSDT");
+    EXPECT_EQ(bars[0].spec, 0U);
+    EXPECT_DOUBLE_EQ(bars[0].volume, 9.);
+
+    EXPECT_EQ(bars[1].symbol, "BTCUSDT");
+    EXPECT_EQ(bars[1].spec, 0U);
+    EXPECT_DOUBLE_EQ(bars[1].volume, 6.);
+    EXPECT_EQ(bars[1].open_time, 1U);
+    EXPECT_EQ(bars[1].close_time, 3U);
+    EXPECT_EQ(bars[2].spec, 1U);
+    EXPECT_EQ(bars[2].trades, 2U);
+    EXPECT_DOUBLE_EQ(bars[2].close, 101.);
+
+    // The third BTCUSDT trade and the ETHUSDT tick bar are still open
+    EXPECT_EQ(aggregator.flush(), 3U);
+    ASSERT_EQ(bars.size(), 6U);
+    EXPECT_EQ(aggregator.emitted(), 6U);
+    EXPECT_EQ(aggregator.flush(), 0U);
+}
+
+TEST(trade_bar_aggregator_test_t, ClampsOutOfRangeThresholds) {
+    std::vector<listeners::trade_bar_t> bars;
+    const listeners::bar_spec_t specs[] = {{listeners::bar_kind_t::time, 0.5},
+                                           {listeners::bar_kind_t::volume, 0.},
+                                           {listeners::bar_kind_t::tick, -3.},
+                                           {listeners::bar_kind_t::volume, std::nan("")},
+                                           {listeners::bar_kind_t::time, 1500.7}};
+    listeners::trade_bar_aggregator_t aggregator(specs, bar_collector_t{&bars});
+    EXPECT_DOUBLE_EQ(aggregator.spec(0).threshold, 1.);
+    EXPECT_GT(aggregator.spec(1).threshold, 0.);
+    EXPECT_DOUBLE_EQ(aggregator.spec(2).threshold, 1.);
+    EXPECT_GT(aggregator.spec(3).threshold, 0.);
+    EXPECT_DOUBLE_EQ(aggregator.spec(4).threshold, 1500.);
+
+    // Sub-millisecond time bars become 1 ms bars; the other three close on every trade
+    aggregator.on_trade(make_trade("BTCUSDT", 1, 10, 100., 1., false));
+    aggregator.on_trade(make_trade("BTCUSDT", 2, 10, 101., 1., false));
+    aggregator.on_trade(make_trade("BTCUSDT", 3, 11, 102., 1., false));
+    ASSERT_EQ(bars.size(), 10U);
+    EXPECT_EQ(bars[6].spec, 0U);
+    EXPECT_EQ(bars[6].trades, 2U);
+    EXPECT_EQ(bars[6].open_time, 10U);
+    EXPECT_EQ(bars[6].close_time, 11U);
+    ASSERT_NE(aggregator.current("BTCUSDT", 4), nullptr);
+    EXPECT_EQ(aggregator.current("BTCUSDT", 4)->open_time, 0U);
+    EXPECT_EQ(aggregator.current("BTCUSDT", 4)->close_time, 1500U);
+}
+
+TEST(trade_bar_aggregator_test_t, AggregatesTradesParsedFromTheFeed) {
+    std::vector<listeners::trade_bar_t> bars;
+    const listeners::bar_spec_t specs[] = {{listeners::bar_kind_t::tick, 2.}};
+    listeners::trade_bar_aggregator_t aggregator(specs, bar_collector_t{&bars}, 1);
+    auto now = std::chrono::system_clock::now();
+
+    std::string buffer =
+        R"({"e":"aggTrade","E":1,"s":"BTCUSDT","a":1,"p":"100.5","q":"2","f":1,"l":1,"T":1,"m":true})" "\n"
+        R"({"e":"aggTrade","E":2,"s":"BTCUSDT","a":2,"p":"101.5","q":"2","f":2,"l":2,"T":2,"m":false})" "\n"
+        R"({"e":"aggTrade","E":3,"s":"ETHUSDT","a":1,"p":"10","q":"1","f":1,"l":1,"T":3,"m":false})" "\n";
+    EXPECT_EQ(binance_future_parser_t::parse_stream(now, buffer, aggregator), buffer.size());
+
+    ASSERT_EQ(bars.size(), 1U);
+    EXPECT_DOUBLE_EQ(bars[0].vwap(), 101.);
+    EXPECT_DOUBLE_EQ(bars[0].buy_volume, 2.);
+    EXPECT_EQ(aggregator.dropped(), 1U);
+}
+
+// ============================================================================
+// Latency Recorder Tests
+// ============================================================================
+
+TEST(latency_recorder_test_t, RecordsExchangeToLocalLatencyPerType) {
+    sequence_recorder_t inner;
+    listeners::latency_recorder_t recorder(inner);
+    static_assert(!TickerListener<listeners::latency_recorder_t<sequence_recorder_t>>);
+
+    // Event times 1.5 ms and 3 ms before "now"
+    const std::chrono::system_clock::time_point now{std::chrono::milliseconds(1'760'083'106'580)};
+    const std::string trade = R"({"e":"aggTrade","E":1760083106577,"s":"BTCUSDT","a":1,"p":"1","q":"1","f":1,"l":1,"T":1,"m":true})";
+    const std::string book = R"({"e":"bookTicker","u":1,"s":"BTCUSDT","b":"1","B":"1","a":"2","A":"1","T":1,"E":1760083106579})";
+    EXPECT_TRUE(binance_future_parser_t::parse(now, trade, recorder));
+    EXPECT_TRUE(binance_future_parser_t::parse(now + std::chrono::microseconds(500), book, recorder));
+    EXPECT_EQ(inner.trades.size(), 1U);
+    EXPECT_EQ(inner.book_update_ids.size(), 1U);
+
+    EXPECT_EQ(recorder.histogram(trace_type_t::trade).count(), 1U);
+    EXPECT_EQ(recorder.histogram(trace_type_t::trade).max(), 3'000'000U);
+    EXPECT_EQ(recorder.histogram(trace_type_t::book_ticker).max(), 1'500'000U);
+    EXPECT_EQ(recorder.to_text(), "book_ticker count=1 min=1500 p50=1500 p90=1500 p99=1500 p99.9=1500 max=1500 mean=1500.0 us\n"
+                                  "trade count=1 min=3000 p50=3000 p90=3000 p99=3000 p99.9=3000 max=3000 mean=3000.0 us\n");
+    EXPECT_EQ(recorder.to_json().rfind(R"({"book_ticker":{"count":1,"min":1500,)", 0), 0U);
+
+    // Exchange clock ahead of ours
+    EXPECT_TRUE(binance_future_parser_t::parse(now - std::chrono::milliseconds(10), trade, recorder));
+    EXPECT_EQ(recorder.ahead(), 1U);
+    EXPECT_EQ(recorder.histogram(trace_type_t::trade).min(), 0U);
+}
+
+TEST(latency_recorder_test_t, MergesPerThreadRecorders) {
+    trade_sink_t sink;
+    listeners::latency_recorder_t total(sink);
+    std::vector<std::unique_ptr<listeners::latency_recorder_t<trade_sink_t>>> recorders;
+    std::vector<trade_sink_t> sinks(2);
+    for (auto &s : sinks) recorders.push_back(std::make_unique<listeners::latency_recorder_t<trade_sink_t>>(s));
+
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < 2; ++t) {
+        threads.emplace_back([&, t] {
+            const std::string message = agg_trade("BTCUSDT", t + 1);
+            for (int i = 0; i < 1000; ++i) {
+                binance_future_parser_t::parse(std::chrono::system_clock::time_point{std::chrono::milliseconds(1 + i)}, message, *recorders[t]);
+            }
+        });
+    }
+    // Merging while the owners record is allowed; the final merge sees everything
+    listeners::latency_recorder_t partial(sink);
+    partial.merge(*recorders[0]);
+    for (auto &thread : threads) thread.join();
+    for (auto const &recorder : recorders) total.merge(*recorder);
+
+    EXPECT_LE(partial.histogram(trace_type_t::trade).count(), 1000U);
+    EXPECT_EQ(total.histogram(trace_type_t::trade).count(), 2000U);
+    EXPECT_EQ(total.histogram(trace_type_t::trade).max(), 999'000'000U);
+    EXPECT_EQ(sinks[0].trades + sinks[1].trades, 2000U);
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
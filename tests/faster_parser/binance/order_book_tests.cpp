@@ -0,0 +1,151 @@
+/**
+ * @file order_book_tests.cpp
+ * @author Kevin Rodrigues
+ * @brief Tests for the flat-array L2 order book and its snapshot/diff synchronisation
+ * @version 1.0
+ * @date 16/10/2026
+ */
+
+#include <gtest/gtest.h>
+#include <array>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include <faster_parser/binance/future.h>
+#include <faster_parser/binance/order_book.h>
+
+using namespace core::faster_parser::binance;
+using namespace core::faster_parser::binance::types;
+
+namespace {
+    constexpr std::string_view snapshot_body =
+        R"({"lastUpdateId":100,"E":1,"T":1,"bids":[["99.9","1"],["100.0","2"],["99.8","3"]],"asks":[["100.1","1.5"],["100.2","2.5"],["100.3","4"]]})";
+
+    std::string depth_message(uint64_t first, uint64_t final, uint64_t previous, std::string_view bids, std::string_view asks) {
+        return R"({"e":"depthUpdate","E":1,"T":1,"s":"BTCUSDT","U":)" + std::to_string(first) + R"(,"u":)" + std::to_string(final) +
+               R"(,"pu":)" + std::to_string(previous) + R"(,"b":)" + std::string(bids) + R"(,"a":)" + std::string(asks) + "}";
+    }
+
+    // Parse a depth update and apply it, returning the book's verdict
+    book_status_t feed(order_book_t &book, std::string const &message) {
+        struct listener_t {
+            order_book_t &book;
+            book_status_t status = book_status_t::stale;
+            void on_depth_update(const depth_update_t &update) { status = book.apply(update); }
+        } listener{book};
+        EXPECT_TRUE(binance_future_parser_t::parse(std::chrono::system_clock::now(), message, listener));
+        return listener.status;
+    }
+
+    void load_snapshot(order_book_t &book, bool expected = true) {
+        depth_snapshot_t snapshot;
+        ASSERT_TRUE(binance_future_parser_t::parse_depth_snapshot(snapshot_body, snapshot));
+        EXPECT_EQ(book.apply_snapshot(snapshot), expected);
+    }
+}
+
+TEST(order_book_test_t, SnapshotLoadsSortedLevels) {
+    order_book_t book(0.1);
+    EXPECT_FALSE(book.synced());
+    load_snapshot(book);
+
+    EXPECT_TRUE(book.synced());
+    EXPECT_EQ(book.last_update_id(), 100U);
+    EXPECT_EQ(book.best_bid().price, 1000);
+    EXPECT_DOUBLE_EQ(book.best_bid().quantity, 2.);
+    EXPECT_EQ(book.best_ask().price, 1001);
+    EXPECT_DOUBLE_EQ(book.to_price(book.best_ask().price), 100.1);
+    EXPECT_EQ(book.depth(book_side_t::bid), 3U);
+
+    std::array<book_level_t, 5> levels;
+    ASSERT_EQ(book.top(book_side_t::bid, levels), 3U);
+    EXPECT_EQ(levels[0].price, 1000);
+    EXPECT_EQ(levels[1].price, 999);
+    EXPECT_EQ(levels[2].price, 998);
+}
+
+TEST(order_book_test_t, BufferedUpdatesBridgeTheSnapshot) {
+    order_book_t book(0.1);
+
+    // Older than the snapshot: dropped on replay
+    EXPECT_EQ(feed(book, depth_message(90, 95, 89, R"([["100.0","9"]])", "[]")), book_status_t::buffered);
+    // Straddles lastUpdateId = 100
+    EXPECT_EQ(feed(book, depth_message(96, 102, 95, R"([["100.0","5"],["99.9","0"]])", "[]")), book_status_t::buffered);
+    EXPECT_EQ(feed(book, depth_message(103, 104, 102, "[]", R"([["100.1","0"]])")), book_status_t::buffered);
+    EXPECT_EQ(book.buffered(), 3U);
+
+    load_snapshot(book);
+    EXPECT_EQ(book.buffered(), 0U);
+    EXPECT_EQ(book.last_update_id(), 104U);
+    EXPECT_DOUBLE_EQ(book.best_bid().quantity, 5.);
+    EXPECT_EQ(book.quantity_at(book_side_t::bid, 999), 0.);
+    EXPECT_EQ(book.depth(book_side_t::bid), 2U);
+    EXPECT_EQ(book.best_ask().price, 1002);
+
+    EXPECT_EQ(feed(book, depth_message(105, 106, 104, R"([["100.1","7"]])", R"([["100.2","0"]])")), book_status_t::applied);
+    EXPECT_EQ(book.best_bid().price, 1001);
+    EXPECT_EQ(book.quantity_at(book_side_t::ask, book.to_ticks(100.2)), 0.);
+    EXPECT_EQ(book.best_ask().price, 1003);
+    EXPECT_EQ(book.updates(), 3U);
+}
+
+TEST(order_book_test_t, FirstLiveUpdateMustStraddleTheSnapshot) {
+    order_book_t book(0.1);
+    load_snapshot(book);
+
+    EXPECT_EQ(feed(book, depth_message(95, 99, 94, R"([["100.0","9"]])", "[]")), book_status_t::stale);
+    EXPECT_DOUBLE_EQ(book.best_bid().quantity, 2.);
+
+    EXPECT_EQ(feed(book, depth_message(98, 101, 97, R"([["100.0","9"]])", "[]")), book_status_t::applied);
+    EXPECT_DOUBLE_EQ(book.best_bid().quantity, 9.);
+    EXPECT_EQ(feed(book, depth_message(102, 103, 101, "[]", "[]")), book_status_t::applied);
+    // Replayed update
+    EXPECT_EQ(feed(book, depth_message(102, 103, 101, "[]", "[]")), book_status_t::stale);
+    EXPECT_EQ(book.gaps(), 0U);
+}
+
+TEST(order_book_test_t, MissingUpdateDesynchronisesTheBook) {
+    order_book_t book(0.1);
+    load_snapshot(book);
+    EXPECT_EQ(feed(book, depth_message(99, 101, 98, "[]", "[]")), book_status_t::applied);
+
+    // pu 105 != 101: updates 102..105 were lost
+    EXPECT_EQ(feed(book, depth_message(106, 107, 105, R"([["100.0","1"]])", "[]")), book_status_t::gap);
+    EXPECT_FALSE(book.synced());
+    EXPECT_EQ(book.gaps(), 1U);
+    EXPECT_EQ(book.depth(book_side_t::bid), 0U);
+    EXPECT_EQ(book.buffered(), 1U);
+    EXPECT_EQ(feed(book, depth_message(108, 109, 107, "[]", "[]")), book_status_t::buffered);
+
+    // A snapshot older than the buffered updates cannot bridge them
+    load_snapshot(book, false);
+    EXPECT_FALSE(book.synced());
+    EXPECT_EQ(book.gaps(), 2U);
+}
+
+TEST(order_book_test_t, VwapWalksTheBookFromTheTop) {
+    order_book_t book(0.1);
+    load_snapshot(book);
+
+    // Asks: 1.5 @ 100.1, 2.5 @ 100.2, 4 @ 100.3
+    vwap_t buy = book.vwap_to_size(book_side_t::ask, 3.);
+    EXPECT_DOUBLE_EQ(buy.filled, 3.);
+    EXPECT_NEAR(buy.price, (1.5 * 100.1 + 1.5 * 100.2) / 3., 1e-9);
+
+    vwap_t sweep = book.vwap_to_size(book_side_t::ask, 100.);
+    EXPECT_DOUBLE_EQ(sweep.filled, 8.);
+    EXPECT_NEAR(sweep.price, (1.5 * 100.1 + 2.5 * 100.2 + 4 * 100.3) / 8., 1e-9);
+
+    vwap_t sell = book.vwap_to_size(book_side_t::bid, 1.);
+    EXPECT_NEAR(sell.price, 100.0, 1e-9);
+
+    order_book_t empty(0.1);
+    EXPECT_DOUBLE_EQ(empty.vwap_to_size(book_side_t::bid, 1.).filled, 0.);
+    EXPECT_DOUBLE_EQ(empty.best_ask().quantity, 0.);
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,194 @@
+/**
+ * @file replay_tests.cpp
+ * @author Kevin Rodrigues
+ * @brief Tests for memory-mapped capture replay and multi-core chunked parsing
+ * @version 1.0
+ * @date 16/10/2026
+ */
+
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <faster_parser/binance/replay.h>
+#include <faster_parser/core/mapped_file.h>
+
+using namespace core::faster_parser;
+using namespace core::faster_parser::binance;
+using namespace core::faster_parser::binance::types;
+
+namespace {
+    std::string agg_trade(uint64_t event_time, uint64_t id) {
+        return R"({"e":"aggTrade","E":)" + std::to_string(event_time) + R"(,"s":"BTCUSDT","a":)" + std::to_string(id) +
+               R"(,"p":"0.001","q":"100","f":100,"l":105,"T":123456785,"m":true})";
+    }
+
+    std::string book_ticker(uint64_t exchange_timestamp) {
+        return R"({"e":"bookTicker","u":1,"s":"ETHUSDT","b":"25.35190000","B":"31.21000000","a":"25.36520000","A":"40.66000000","T":1,"E":)" +
+               std::to_string(exchange_timestamp) + "}";
+    }
+
+    class CountingListener {
+    public:
+        size_t book_tickers = 0;
+        size_t trades = 0;
+        uint64_t id_sum = 0;
+
+        void on_book_ticker(const book_ticker_t &) { ++book_tickers; }
+
+        void on_trade(const trade_t &trade) {
+            ++trades;
+            id_sum += trade.agg_trade_id;
+        }
+    };
+
+    class OrderListener {
+    public:
+        std::vector<uint64_t> timestamps;
+        std::vector<uint64_t> ids;
+
+        void on_book_ticker(const book_ticker_t &ticker) {
+            timestamps.push_back(ticker.exchange_timestamp);
+            ids.push_back(0);
+        }
+
+        void on_trade(const trade_t &trade) {
+            timestamps.push_back(trade.event_time);
+            ids.push_back(trade.agg_trade_id);
+        }
+    };
+
+    std::string capture(size_t trades) {
+        std::string out;
+        for (size_t i = 1; i <= trades; ++i) {
+            out += agg_trade(1000 + i, i) + "\n";
+        }
+        return out;
+    }
+}
+
+TEST(replay_test_t, SplitLinesIsNewlineAlignedAndCoversTheBuffer) {
+    std::string buffer = capture(100);
+    auto chunks = split_lines(buffer, 7);
+
+    ASSERT_EQ(chunks.size(), 7U);
+    std::string joined;
+    for (auto chunk : chunks) {
+        ASSERT_FALSE(chunk.empty());
+        EXPECT_EQ(chunk.back(), '\n');
+        joined += chunk;
+    }
+    EXPECT_EQ(joined, buffer);
+}
+
+TEST(replay_test_t, SplitLinesWithMoreChunksThanLines) {
+    std::string buffer = capture(2);
+    auto chunks = split_lines(buffer, 8);
+
+    EXPECT_LE(chunks.size(), 2U);
+    EXPECT_TRUE(split_lines(std::string_view{}, 4).empty());
+}
+
+TEST(replay_test_t, ParallelMatchesSerialParse) {
+    std::string buffer = capture(1000);
+    for (size_t i = 0; i < 50; ++i) buffer += book_ticker(i) + "\n";
+
+    CountingListener serial;
+    EXPECT_EQ(binance_future_parser_t::parse_stream(std::chrono::system_clock::now(), buffer, serial), buffer.size());
+
+    std::vector<CountingListener> listeners(4);
+    EXPECT_EQ(replay_parallel(buffer, std::span(listeners)), buffer.size());
+
+    size_t trades = 0, book_tickers = 0;
+    uint64_t id_sum = 0;
+    for (auto const &listener : listeners) {
+        trades += listener.trades;
+        book_tickers += listener.book_tickers;
+        id_sum += listener.id_sum;
+    }
+    EXPECT_EQ(trades, serial.trades);
+    EXPECT_EQ(book_tickers, serial.book_tickers);
+    EXPECT_EQ(id_sum, serial.id_sum);
+}
+
+TEST(replay_test_t, ParallelReportsTrailingPartialMessage) {
+    std::string buffer = capture(100);
+    std::string partial = agg_trade(5000, 5000).substr(0, 40);
+    buffer += partial;
+
+    std::vector<CountingListener> listeners(3);
+    EXPECT_EQ(replay_parallel(buffer, std::span(listeners)), buffer.size() - partial.size());
+}
+
+TEST(replay_test_t, OrderedMergesByExchangeTime) {
+    // Out of order across the file, equal timestamps must keep file order
+    std::string buffer;
+    buffer += agg_trade(30, 1) + "\n";
+    buffer += book_ticker(10) + "\n";
+    buffer += agg_trade(20, 2) + "\n";
+    buffer += agg_trade(20, 3) + "\n";
+    buffer += agg_trade(5, 4) + "\n";
+    buffer += book_ticker(25) + "\n";
+
+    OrderListener listener;
+    EXPECT_EQ(replay_ordered(buffer, 3, listener), buffer.size());
+
+    EXPECT_EQ(listener.timestamps, (std::vector<uint64_t>{5, 10, 20, 20, 25, 30}));
+    EXPECT_EQ(listener.ids, (std::vector<uint64_t>{4, 0, 2, 3, 0, 1}));
+}
+
+TEST(replay_test_t, OrderedWithTradeOnlyListener) {
+    struct trade_only_t {
+        std::vector<uint64_t> ids;
+        void on_trade(const trade_t &trade) { ids.push_back(trade.agg_trade_id); }
+    };
+
+    std::string buffer = agg_trade(2, 1) + "\n" + book_ticker(1) + "\n" + agg_trade(1, 2) + "\n";
+    trade_only_t listener;
+    replay_ordered(buffer, 2, listener);
+
+    EXPECT_EQ(listener.ids, (std::vector<uint64_t>{2, 1}));
+}
+
+TEST(mapped_file_test_t, MapsCaptureFile) {
+    auto path = std::filesystem::temp_directory_path() / "faster_parser_replay_test.ndjson";
+    std::string buffer = capture(500);
+    {
+        std::ofstream out(path, std::ios::binary);
+        out << buffer;
+    }
+
+    mapped_file_t file;
+    ASSERT_TRUE(file.open(path.c_str()));
+    EXPECT_EQ(file.view(), buffer);
+
+    std::vector<CountingListener> listeners(4);
+    EXPECT_EQ(replay_parallel(file.view(), std::span(listeners)), buffer.size());
+    size_t trades = 0;
+    for (auto const &listener : listeners) trades += listener.trades;
+    EXPECT_EQ(trades, 500U);
+
+    file.close();
+    std::filesystem::remove(path);
+}
+
+TEST(mapped_file_test_t, MissingAndEmptyFiles) {
+    mapped_file_t missing;
+    EXPECT_FALSE(missing.open("/nonexistent/faster_parser_capture"));
+    EXPECT_FALSE(missing.is_open());
+
+    auto path = std::filesystem::temp_directory_path() / "faster_parser_replay_empty.ndjson";
+    { std::ofstream out(path); }
+    mapped_file_t empty(path.c_str());
+    EXPECT_TRUE(empty.is_open());
+    EXPECT_TRUE(empty.view().empty());
+    std::filesystem::remove(path);
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,205 @@
+/**
+ * @file sharded_tests.cpp
+ * @author Kevin Rodrigues
+ * @brief Tests for the symbol-sharded multi-core parsing pipeline
+ * @version 1.0
+ * @date 16/10/2026
+ */
+
+#include <gtest/gtest.h>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <faster_parser/binance/sharded.h>
+
+using namespace core::faster_parser::binance;
+using namespace core::faster_parser::binance::types;
+
+namespace {
+    const std::vector<std::string> symbols = {"BTCUSDT", "ETHUSDT", "BNBUSDT", "SOLUSDT", "XRPUSDT", "DOGEUSDT", "ADAUSDT"};
+
+    std::string agg_trade(std::string const &symbol, uint64_t id) {
+        return R"({"e":"aggTrade","E":1,"s":")" + symbol + R"(","a":)" + std::to_string(id) +
+               R"(,"p":"0.001","q":"100","f":100,"l":105,"T":123456785,"m":true})";
+    }
+
+    std::string book_ticker(std::string const &symbol, uint64_t update_id) {
+        return R"({"e":"bookTicker","u":)" + std::to_string(update_id) + R"(,"s":")" + symbol +
+               R"(","b":"25.35190000","B":"31.21000000","a":"25.36520000","A":"40.66000000","T":1,"E":2})";
+    }
+
+    std::string ticker(std::string const &symbol, uint64_t trades) {
+        return R"({"e":"24hrTicker","E":1,"s":")" + symbol + R"(","p":"0.0015","P":"250.00","w":"0.0018","c":"0.0025","Q":"10","o":"0.0010","h":"0.0025","l":"0.0010","v":"10000","q":"18","O":0,"C":86400000,"F":0,"L":18150,"n":)" +
+               std::to_string(trades) + "}";
+    }
+
+    // Records (symbol, sequence) in arrival order
+    class RecordingListener {
+    public:
+        std::vector<std::pair<std::string, uint64_t>> events;
+
+        void on_book_ticker(const book_ticker_t &ticker) { events.emplace_back(ticker.symbol, ticker.bid.sequence); }
+        void on_trade(const trade_t &trade) { events.emplace_back(trade.symbol, trade.agg_trade_id); }
+        void on_ticker(const ticker_t &ticker) { events.emplace_back(ticker.symbol, ticker.total_trades); }
+        void on_depth_update(const depth_update_t &update) {
+            events.emplace_back(update.symbol, update.final_update_id);
+            depth_levels.push_back(update.bids.size() + update.asks.size());
+        }
+
+        std::vector<size_t> depth_levels;
+    };
+
+    // Depth update with `levels` bid and ask levels each
+    std::string depth_update(std::string const &symbol, uint64_t update_id, size_t levels) {
+        std::string bids, asks;
+        for (size_t i = 0; i < levels; ++i) {
+            bids += std::string(i ? "," : "") + R"([")" + std::to_string(45000 - i) + R"(.10","1.5"])";
+            asks += std::string(i ? "," : "") + R"([")" + std::to_string(45001 + i) + R"(.20","2.25"])";
+        }
+        return R"({"e":"depthUpdate","E":1,"T":1,"s":")" + symbol + R"(","U":)" + std::to_string(update_id) +
+               R"(,"u":)" + std::to_string(update_id) + R"(,"pu":)" + std::to_string(update_id - 1) +
+               R"(,"b":[)" + bids + R"(],"a":[)" + asks + "]}";
+    }
+}
+
+TEST(sharded_test_t, PeekSymbolFindsTheSymbolOfEveryMessageType) {
+    for (std::string message : {agg_trade("BTCUSDT", 1), book_ticker("BTCUSDT", 1), ticker("BTCUSDT", 1)}) {
+        EXPECT_EQ(peek_symbol(message.data(), message.data() + message.size()), "BTCUSDT") << message;
+    }
+
+    std::string no_symbol = R"({"e":"aggTrade","E":1,"a":5})";
+    EXPECT_TRUE(peek_symbol(no_symbol.data(), no_symbol.data() + no_symbol.size()).empty());
+
+    std::string truncated = R"({"e":"aggTrade","E":1,"s":"BTCU)";
+    EXPECT_TRUE(peek_symbol(truncated.data(), truncated.data() + truncated.size()).empty());
+}
+
+TEST(sharded_test_t, KeepsEverySymbolOnOneWorkerInArrivalOrder) {
+    std::vector<RecordingListener> listeners(4);
+    std::string stream;
+    size_t expected = 0;
+    for (uint64_t i = 1; i <= 2000; ++i) {
+        std::string const &symbol = symbols[i % symbols.size()];
+        stream += (i % 3 == 0 ? book_ticker(symbol, i) : agg_trade(symbol, i)) + "\n";
+        ++expected;
+    }
+
+    sharded_pipeline_options_t options;
+    options.queue_capacity = 64;
+    options.batch_size = 8;
+
+    uint64_t routed = 0;
+    {
+        sharded_pipeline_t<RecordingListener> pipeline(listeners, options);
+        EXPECT_EQ(pipeline.route_stream(std::chrono::system_clock::now(), stream), stream.size());
+        pipeline.stop();
+        routed = pipeline.routed();
+        EXPECT_EQ(pipeline.dropped(), 0U);
+    }
+    EXPECT_EQ(routed, expected);
+
+    std::map<std::string, size_t> owner;
+    size_t total = 0;
+    for (size_t worker = 0; worker < listeners.size(); ++worker) {
+        std::map<std::string, uint64_t> last;
+        for (auto const &[symbol, sequence] : listeners[worker].events) {
+            auto [it, inserted] = owner.emplace(symbol, worker);
+            EXPECT_EQ(it->second, worker) << symbol << " parsed on two workers";
+            EXPECT_GT(sequence, last[symbol]) << symbol << " out of order";
+            last[symbol] = sequence;
+        }
+        total += listeners[worker].events.size();
+    }
+    EXPECT_EQ(total, expected);
+    EXPECT_EQ(owner.size(), symbols.size());
+}
+
+TEST(sharded_test_t, SplitsTickerArraysIntoElements) {
+    std::vector<RecordingListener> listeners(3);
+    sharded_pipeline_t<RecordingListener> pipeline(listeners);
+
+    std::string array = "[" + ticker("BTCUSDT", 1) + "," + ticker("ETHUSDT", 2) + "," + ticker("SOLUSDT", 3) + "]";
+    EXPECT_TRUE(pipeline.route(std::chrono::system_clock::now(), array));
+    const size_t btc_shard = pipeline.shard_of("BTCUSDT");
+    pipeline.stop();
+
+    std::set<uint64_t> seen;
+    for (auto const &listener : listeners) {
+        for (auto const &[symbol, trades] : listener.events) seen.insert(trades);
+    }
+    EXPECT_EQ(seen, (std::set<uint64_t>{1, 2, 3}));
+    ASSERT_FALSE(listeners[btc_shard].events.empty());
+}
+
+TEST(sharded_test_t, LeavesUnterminatedMessageAndDropsUnroutable) {
+    std::vector<RecordingListener> listeners(2);
+    sharded_pipeline_t<RecordingListener> pipeline(listeners);
+    auto now = std::chrono::system_clock::now();
+
+    std::string first = agg_trade("BTCUSDT", 1) + "\n";
+    std::string partial = agg_trade("BTCUSDT", 2);
+    std::string buffer = first + R"({"e":"aggTrade","E":1,"a":5})" "\n" + partial;
+    EXPECT_EQ(pipeline.route_stream(now, buffer), buffer.size() - partial.size());
+    EXPECT_EQ(pipeline.dropped(), 1U);
+
+    EXPECT_FALSE(pipeline.route(now, R"({"e":"aggTrade","E":1,"s":"","a":5})"));
+    EXPECT_EQ(pipeline.dropped(), 2U);
+
+    pipeline.stop();
+    EXPECT_FALSE(pipeline.route(now, first));
+    EXPECT_EQ(listeners[0].events.size() + listeners[1].events.size(), 1U);
+}
+
+TEST(sharded_test_t, RoutesMessagesLongerThanASlot) {
+    std::vector<RecordingListener> listeners(2);
+    sharded_pipeline_options_t options;
+    options.queue_capacity = 4;
+    options.batch_size = 1;
+    sharded_pipeline_t<RecordingListener> pipeline(listeners, options);
+    auto now = std::chrono::system_clock::now();
+
+    // 40 levels a side: several slots each, more than the whole queue for the last one
+    const std::string first = depth_update("BTCUSDT", 10, 40);
+    const std::string last = depth_update("BTCUSDT", 12, 80);
+    ASSERT_GT(first.size(), 1024U);
+    ASSERT_GT(last.size(), 4 * frame_slot_t::max_size);
+
+    EXPECT_TRUE(pipeline.route(now, first));
+    EXPECT_TRUE(pipeline.route(now, agg_trade("BTCUSDT", 11)));
+    EXPECT_TRUE(pipeline.route(now, last));
+    pipeline.stop();
+    EXPECT_EQ(pipeline.dropped(), 0U);
+
+    RecordingListener const &listener = listeners[pipeline.shard_of("BTCUSDT")];
+    ASSERT_EQ(listener.events.size(), 3U);
+    EXPECT_EQ(listener.events[0].second, 10U);
+    EXPECT_EQ(listener.events[1].second, 11U);
+    EXPECT_EQ(listener.events[2].second, 12U);
+    EXPECT_EQ(listener.depth_levels, (std::vector<size_t>{80, 160}));
+}
+
+TEST(sharded_test_t, WaitsForFullQueuesInsteadOfDropping) {
+    std::vector<RecordingListener> listeners(1);
+    sharded_pipeline_options_t options;
+    options.queue_capacity = 2;
+    options.batch_size = 1;
+    sharded_pipeline_t<RecordingListener> pipeline(listeners, options);
+    auto now = std::chrono::system_clock::now();
+
+    for (uint64_t i = 1; i <= 500; ++i) {
+        EXPECT_TRUE(pipeline.route(now, agg_trade("BTCUSDT", i)));
+    }
+    pipeline.stop();
+
+    ASSERT_EQ(listeners[0].events.size(), 500U);
+    for (uint64_t i = 0; i < 500; ++i) {
+        EXPECT_EQ(listeners[0].events[i].second, i + 1);
+    }
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,215 @@
+/**
+ * @file trace_tests.cpp
+ * @author Kevin Rodrigues
+ * @brief Tests for the timestamp counter clock, the latency histogram and per-stage parse tracing
+ * @version 1.0
+ * @date 16/10/2026
+ */
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include <faster_parser/binance/future.h>
+
+using namespace core::faster_parser;
+using namespace core::faster_parser::binance;
+using namespace core::faster_parser::binance::types;
+
+namespace {
+    const std::string book_ticker_message =
+        R"({"e":"bookTicker","u":8822354685185,"s":"ASTERUSDT","b":"1.5822000","B":"457","a":"1.5823000","A":"112","T":1760083106579,"E":1760083106579})";
+    const std::string agg_trade_message =
+        R"({"e":"aggTrade","E":123456789,"s":"BTCUSDT","a":5933014,"p":"0.001","q":"100","f":100,"l":105,"T":123456785,"m":true})";
+    const std::string ticker_message =
+        R"({"e":"24hrTicker","E":123456789,"s":"BTCUSDT","p":"0.0015","P":"250.00","w":"0.0018","c":"0.0025","Q":"10","o":"0.0010","h":"0.0025","l":"0.0010","v":"10000","q":"18","O":0,"C":86400000,"F":0,"L":18150,"n":18151})";
+
+    class RecordingListener {
+    public:
+        std::vector<std::string> symbols;
+
+        void on_book_ticker(const book_ticker_t &ticker) { symbols.emplace_back(ticker.symbol); }
+        void on_trade(const trade_t &trade) { symbols.emplace_back(trade.symbol); }
+        void on_ticker(const ticker_t &ticker) { symbols.emplace_back(ticker.symbol); }
+    };
+
+    auto now() {
+        return std::chrono::system_clock::now();
+    }
+}
+
+TEST(tsc_clock_test_t, CalibratesAgainstTheSystemClock) {
+    const tsc_clock_t clock = tsc_clock_t::calibrate(std::chrono::milliseconds(20));
+    EXPECT_GT(clock.ns_per_tick(), 0.);
+
+    const uint64_t first = read_tsc();
+    const uint64_t second = read_tsc();
+    EXPECT_GE(second, first);
+    const uint64_t start = read_tsc_start();
+    const uint64_t end = read_tsc_end();
+    EXPECT_GE(end, start);
+
+    const auto drift = clock.now() - std::chrono::system_clock::now();
+    EXPECT_LT(std::chrono::abs(drift), std::chrono::milliseconds(5));
+    EXPECT_EQ(clock.to_ns(0), 0U);
+}
+
+TEST(latency_histogram_test_t, KeepsValuesWithinTheBucketResolution) {
+    latency_histogram_t histogram;
+    EXPECT_EQ(histogram.percentile(50.), 0U);
+    for (uint64_t v = 1; v <= 1000; ++v) histogram.record(v);
+
+    EXPECT_EQ(histogram.count(), 1000U);
+    EXPECT_EQ(histogram.min(), 1U);
+    EXPECT_EQ(histogram.max(), 1000U);
+    EXPECT_DOUBLE_EQ(histogram.mean(), 500.5);
+    EXPECT_NEAR(static_cast<double>(histogram.percentile(50.)), 500., 500. / 32);
+    EXPECT_NEAR(static_cast<double>(histogram.percentile(99.)), 990., 990. / 32);
+    EXPECT_EQ(histogram.percentile(100.), 1000U);
+    EXPECT_EQ(histogram.percentile(0.), 1U);
+
+    // Exact below 32, bucket bounds contiguous above, huge values in the last bucket
+    for (uint64_t v = 0; v < 32; ++v) EXPECT_EQ(latency_histogram_t::index_of(v), v);
+    for (size_t i = 32; i + 1 < latency_histogram_t::bucket_count; ++i) {
+        EXPECT_EQ(latency_histogram_t::index_of(latency_histogram_t::upper_bound_of(i)), i);
+        EXPECT_EQ(latency_histogram_t::index_of(latency_histogram_t::upper_bound_of(i) + 1), i + 1);
+    }
+    EXPECT_EQ(latency_histogram_t::index_of(~uint64_t{0}), latency_histogram_t::bucket_count - 1);
+
+    histogram.reset();
+    EXPECT_EQ(histogram.count(), 0U);
+    EXPECT_EQ(histogram.min(), 0U);
+}
+
+TEST(latency_histogram_test_t, MergesAndExports) {
+    latency_histogram_t first;
+    latency_histogram_t second;
+    for (uint64_t v = 1; v <= 100; ++v) first.record(v);
+    for (uint64_t v = 1001; v <= 1100; ++v) second.record(v);
+
+    latency_histogram_t merged;
+    merged.merge(first);
+    merged.merge(second);
+    EXPECT_EQ(merged.count(), 200U);
+    EXPECT_EQ(merged.min(), 1U);
+    EXPECT_EQ(merged.max(), 1100U);
+    EXPECT_DOUBLE_EQ(merged.mean(), 550.5);
+    EXPECT_LE(merged.percentile(50.), 101U);    // Buckets are 2 wide from 64 to 127
+    EXPECT_GE(merged.percentile(51.), 1001U);
+
+    uint64_t bucketed = 0;
+    uint64_t previous = 0;
+    merged.for_each_bucket([&](uint64_t upper_bound, uint64_t count) {
+        EXPECT_GT(upper_bound, previous);
+        previous = upper_bound;
+        bucketed += count;
+    });
+    EXPECT_EQ(bucketed, 200U);
+    EXPECT_GE(previous, 1100U);
+
+    latency_histogram_t empty;
+    merged.merge(empty);
+    EXPECT_EQ(merged.count(), 200U);
+    EXPECT_EQ(merged.min(), 1U);
+
+    EXPECT_EQ(first.to_text("parse"), "parse count=100 min=1 p50=50 p90=91 p99=99 p99.9=100 max=100 mean=50.5");
+    EXPECT_EQ(first.to_text("parse", 2., "ns"), "parse count=100 min=2 p50=100 p90=182 p99=198 p99.9=200 max=200 mean=101.0 ns");
+    EXPECT_EQ(first.to_json(), R"({"count":100,"min":1,"p50":50,"p90":91,"p99":99,"p99.9":100,"max":100,"mean":50.5})");
+    EXPECT_EQ(empty.to_json(), R"({"count":0,"min":0,"p50":0,"p90":0,"p99":0,"p99.9":0,"max":0,"mean":0.0})");
+}
+
+TEST(parse_tracer_test_t, RecordsEveryStagePerMessageType) {
+    parse_tracer_t tracer(tsc_clock_t::calibrate(std::chrono::milliseconds(1)));
+    RecordingListener listener;
+
+    for (int i = 0; i < 10; ++i) {
+        EXPECT_TRUE(binance_future_parser_t::parse(now(), book_ticker_message, listener, tracer));
+    }
+    EXPECT_TRUE(binance_future_parser_t::parse(now(), agg_trade_message, listener, tracer));
+    EXPECT_TRUE(binance_future_parser_t::parse(now(), "[" + ticker_message + "," + ticker_message + "]", listener, tracer));
+
+    EXPECT_EQ(listener.symbols.size(), 13U);
+    EXPECT_EQ(tracer.messages(trace_type_t::book_ticker), 10U);
+    EXPECT_EQ(tracer.messages(trace_type_t::trade), 1U);
+    EXPECT_EQ(tracer.messages(trace_type_t::ticker), 0U);
+    EXPECT_EQ(tracer.messages(trace_type_t::ticker_array), 1U);
+
+    // Stages partition the total
+    for (trace_type_t type : {trace_type_t::book_ticker, trace_type_t::trade, trace_type_t::ticker_array}) {
+        const auto &total = tracer.histogram(type, trace_stage_t::total);
+        uint64_t stage_max = 0;
+        for (trace_stage_t stage : {trace_stage_t::dispatch, trace_stage_t::extract, trace_stage_t::listener}) {
+            EXPECT_EQ(tracer.histogram(type, stage).count(), total.count());
+            stage_max = std::max(stage_max, tracer.histogram(type, stage).max());
+        }
+        EXPECT_LE(stage_max, total.max());
+        EXPECT_GT(total.max(), 0U);
+    }
+    EXPECT_GE(tracer.percentile_ns(trace_type_t::book_ticker, trace_stage_t::total, 99.),
+              tracer.percentile_ns(trace_type_t::book_ticker, trace_stage_t::total, 50.));
+
+    tracer.reset();
+    EXPECT_EQ(tracer.messages(trace_type_t::book_ticker), 0U);
+}
+
+TEST(parse_tracer_test_t, MergesAndExportsTracedTypes) {
+    const tsc_clock_t clock = tsc_clock_t::calibrate(std::chrono::milliseconds(1));
+    parse_tracer_t first(clock);
+    parse_tracer_t second(clock);
+    RecordingListener listener;
+
+    EXPECT_TRUE(binance_future_parser_t::parse(now(), book_ticker_message, listener, first));
+    EXPECT_TRUE(binance_future_parser_t::parse(now(), agg_trade_message, listener, second));
+    EXPECT_FALSE(binance_future_parser_t::parse(now(), agg_trade_message.substr(0, 40), listener, second));
+
+    parse_tracer_t total(clock);
+    EXPECT_EQ(total.to_text(), "");
+    EXPECT_EQ(total.to_json(), "{}");
+    total.merge(first);
+    total.merge(second);
+    EXPECT_EQ(total.messages(trace_type_t::book_ticker), 1U);
+    EXPECT_EQ(total.messages(trace_type_t::trade), 1U);
+    EXPECT_EQ(total.failures(), 1U);
+
+    const std::string text = total.to_text();
+    EXPECT_EQ(std::count(text.begin(), text.end(), '\n'), 8);
+    EXPECT_EQ(text.rfind("book_ticker.dispatch count=1 ", 0), 0U);
+    EXPECT_NE(text.find("\ntrade.total count=1 "), std::string::npos);
+
+    const std::string json = total.to_json();
+    EXPECT_EQ(json.rfind(R"({"book_ticker":{"dispatch":{"count":1,)", 0), 0U);
+    EXPECT_NE(json.find(R"(},"trade":{"dispatch":{"count":1,)"), std::string::npos);
+    EXPECT_EQ(json.find("ticker_array"), std::string::npos);
+    EXPECT_EQ(json.substr(json.size() - 3), "}}}");
+}
+
+TEST(parse_tracer_test_t, CountsRecognisedMessagesThatFailToParse) {
+    parse_tracer_t tracer(tsc_clock_t::calibrate(std::chrono::milliseconds(1)));
+    RecordingListener listener;
+
+    EXPECT_FALSE(binance_future_parser_t::parse(now(), book_ticker_message.substr(0, 60), listener, tracer));
+    EXPECT_FALSE(binance_future_parser_t::parse(now(), R"({"e":"markPriceUpdate","E":1,"s":"BTCUSDT","p":"1"})", listener, tracer));
+    EXPECT_EQ(tracer.failures(), 1U);
+    EXPECT_EQ(tracer.messages(trace_type_t::book_ticker), 0U);
+    EXPECT_TRUE(listener.symbols.empty());
+}
+
+TEST(parse_tracer_test_t, NullTracerIsThePlainParse) {
+    static_assert(!null_tracer_t::enabled);
+    null_tracer_t tracer;
+    RecordingListener listener;
+
+    EXPECT_TRUE(binance_future_parser_t::parse(now(), agg_trade_message, listener, tracer));
+    EXPECT_FALSE(binance_future_parser_t::parse(now(), agg_trade_message.substr(0, 40), listener, tracer));
+    EXPECT_EQ(listener.symbols, (std::vector<std::string>{"BTCUSDT"}));
+
+    default_tracer_t default_tracer;
+    EXPECT_TRUE(binance_future_parser_t::parse(now(), book_ticker_message, listener, default_tracer));
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
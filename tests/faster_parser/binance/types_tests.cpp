@@ -0,0 +1,214 @@
+/**
+ * @file types_tests.cpp
+ * @author Kevin Rodrigues
+ * @brief Tests for the self-contained and compact Binance event types
+ * @version 1.0
+ * @date 16/10/2026
+ */
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <faster_parser/binance/future.h>
+#include <faster_parser/binance/types/compact.h>
+
+using namespace core::faster_parser::binance;
+using namespace core::faster_parser::binance::types;
+
+struct OwnedListener {
+    book_ticker_owned_t book_ticker;
+    trade_owned_t trade;
+    ticker_owned_t ticker;
+
+    void on_book_ticker(const book_ticker_t &t) { book_ticker = book_ticker_owned_t(t); }
+    void on_trade(const trade_t &t) { trade = trade_owned_t(t); }
+    void on_ticker(const ticker_t &t) { ticker = ticker_owned_t(t); }
+};
+
+TEST(symbol_test_t, FromStringView) {
+    std::string buffer = R"("s":"BTCUSDT","b":"1")";
+    symbol_t symbol = symbol_t::from(std::string_view(buffer).substr(5, 7));
+
+    EXPECT_EQ(symbol.size(), 7);
+    EXPECT_EQ(symbol.view(), "BTCUSDT");
+    EXPECT_TRUE(symbol == std::string_view("BTCUSDT"));
+    for (size_t i = 7; i < symbol_t::capacity; ++i) {
+        EXPECT_EQ(symbol.data[i], '\0');
+    }
+}
+
+TEST(symbol_test_t, EmptyAndFullLength) {
+    EXPECT_TRUE(symbol_t{}.empty());
+    EXPECT_EQ(symbol_t{}.size(), 0);
+    EXPECT_EQ(symbol_t::from("").size(), 0);
+
+    std::string sixteen = "ABCDEFGHIJKLMNOP_trailing";
+    EXPECT_EQ(symbol_t::from(std::string_view(sixteen).substr(0, 16)).view(), "ABCDEFGHIJKLMNOP");
+    EXPECT_EQ(symbol_t::from(sixteen).view(), "ABCDEFGHIJKLMNOP");
+    EXPECT_EQ(symbol_t::from(std::string_view(sixteen).substr(0, 9)).view(), "ABCDEFGHI");
+}
+
+TEST(symbol_test_t, EqualityAndHash) {
+    symbol_t a = symbol_t::from("ETHUSDT");
+    symbol_t b = symbol_t::from("ETHUSDT");
+    symbol_t c = symbol_t::from("ETHUSDC");
+
+    EXPECT_TRUE(a == b);
+    EXPECT_FALSE(a == c);
+    EXPECT_EQ(a.hash(), b.hash());
+    EXPECT_NE(a.hash(), c.hash());
+}
+
+TEST(symbol_test_t, HashSpreadsSymbolsSharingAPrefix) {
+    // Linear probing over the low bits, as symbol_registry_t does: symbols differing only
+    // past their first 6 bytes must not pile up in one probe chain
+    constexpr size_t mask = 1023;
+    std::vector<bool> used(mask + 1, false);
+    size_t total = 0;
+    size_t longest = 0;
+    for (int i = 0; i < 300; ++i) {
+        char name[32];
+        std::snprintf(name, sizeof(name), "SYMBOL%03dUSDT", i);
+        size_t slot = symbol_t::from(name).hash() & mask;
+        size_t probes = 1;
+        for (; used[slot]; slot = (slot + 1) & mask) ++probes;
+        used[slot] = true;
+        total += probes;
+        longest = std::max(longest, probes);
+    }
+    EXPECT_LT(total, 2U * 300U);
+    EXPECT_LT(longest, 16U);
+}
+
+TEST(owned_types_test_t, AreTriviallyCopyable) {
+    EXPECT_TRUE(std::is_trivially_copyable_v<book_ticker_owned_t>);
+    EXPECT_TRUE(std::is_trivially_copyable_v<trade_owned_t>);
+    EXPECT_TRUE(std::is_trivially_copyable_v<ticker_owned_t>);
+}
+
+TEST(owned_types_test_t, BookTickerOutlivesBuffer) {
+    OwnedListener listener;
+    {
+        std::string message = R"({"e":"bookTicker","u":8822354685185,"s":"ASTERUSDT","b":"1.5822000","B":"457","a":"1.5823000","A":"112","T":1760083106579,"E":1760083106579})";
+        ASSERT_TRUE(binance_future_parser_t::parse(std::chrono::system_clock::now(), message, listener));
+        message.assign(message.size(), 'x');
+    }
+
+    const auto &ticker = listener.book_ticker;
+    EXPECT_EQ(ticker.symbol.view(), "ASTERUSDT");
+    EXPECT_DOUBLE_EQ(ticker.bid.price, 1.5822);
+    EXPECT_DOUBLE_EQ(ticker.ask.volume, 112.0);
+    EXPECT_EQ(ticker.exchange_timestamp, 1760083106579ULL);
+    EXPECT_EQ(ticker.bid.sequence, 8822354685185ULL);
+
+    book_ticker_t view = ticker.view();
+    EXPECT_EQ(view.symbol, "ASTERUSDT");
+    EXPECT_DOUBLE_EQ(view.ask.price, 1.5823);
+}
+
+TEST(owned_types_test_t, TradeAndTickerRoundTrip) {
+    OwnedListener listener;
+    std::string_view trade_message = R"({"e":"aggTrade","E":123456789,"s":"BTCUSDT","a":5933014,"p":"0.001","q":"100","f":100,"l":105,"T":123456785,"m":true})";
+    std::string_view ticker_message = R"({"e":"24hrTicker","E":123456789,"s":"ETHUSDT","p":"0.0015","P":"250.00","w":"0.0018","c":"0.0025","Q":"10","o":"0.0010","h":"0.0025","l":"0.0010","v":"10000","q":"18","O":0,"C":86400000,"F":0,"L":18150,"n":18151})";
+
+    ASSERT_TRUE(binance_future_parser_t::parse(std::chrono::system_clock::now(), trade_message, listener));
+    ASSERT_TRUE(binance_future_parser_t::parse(std::chrono::system_clock::now(), ticker_message, listener));
+
+    trade_t trade = listener.trade.view();
+    EXPECT_EQ(trade.symbol, "BTCUSDT");
+    EXPECT_EQ(trade.agg_trade_id, 5933014ULL);
+    EXPECT_EQ(trade.last_trade_id, 105ULL);
+    EXPECT_TRUE(trade.is_buyer_maker);
+
+    ticker_t ticker = listener.ticker.view();
+    EXPECT_EQ(ticker.symbol, "ETHUSDT");
+    EXPECT_DOUBLE_EQ(ticker.last_price, 0.0025);
+    EXPECT_EQ(ticker.statistics_close_time, 86400000ULL);
+    EXPECT_EQ(ticker.total_trades, 18151ULL);
+}
+
+TEST(compact_types_test_t, LayoutFitsCacheLines) {
+    EXPECT_EQ(sizeof(book_ticker_compact_t), 64);
+    EXPECT_EQ(sizeof(trade_compact_t), 64);
+    EXPECT_EQ(sizeof(ticker_compact_t), 128);
+    EXPECT_EQ(alignof(book_ticker_compact_t), 64);
+}
+
+TEST(compact_types_test_t, BookTickerKeepsAllFields) {
+    OwnedListener listener;
+    std::string_view message = R"({"e":"bookTicker","u":8822354685185,"s":"ASTERUSDT","b":"1.5822000","B":"457","a":"1.5823000","A":"112","T":1760083106579,"E":1760083106579})";
+    ASSERT_TRUE(binance_future_parser_t::parse(std::chrono::system_clock::now(), message, listener));
+
+    book_ticker_compact_t compact(listener.book_ticker.view());
+    EXPECT_EQ(compact.symbol.view(), "ASTERUSDT");
+    EXPECT_DOUBLE_EQ(compact.bid_price, 1.5822);
+    EXPECT_DOUBLE_EQ(compact.bid_volume, 457.0);
+    EXPECT_DOUBLE_EQ(compact.ask_price, 1.5823);
+    EXPECT_DOUBLE_EQ(compact.ask_volume, 112.0);
+    EXPECT_EQ(compact.update_id, 8822354685185ULL);
+    EXPECT_EQ(compact.exchange_timestamp, 1760083106579ULL);
+}
+
+TEST(compact_types_test_t, TradeDerivedFields) {
+    OwnedListener listener;
+    std::string_view message = R"({"e":"aggTrade","E":123456789,"s":"BTCUSDT","a":5933014,"p":"0.001","q":"100","f":100,"l":105,"T":123456785,"m":true})";
+    ASSERT_TRUE(binance_future_parser_t::parse(std::chrono::system_clock::now(), message, listener));
+
+    trade_compact_t compact(listener.trade.view());
+    EXPECT_EQ(compact.symbol.view(), "BTCUSDT");
+    EXPECT_EQ(compact.event_time(), 123456789ULL);
+    EXPECT_EQ(compact.trade_time, 123456785ULL);
+    EXPECT_EQ(compact.first_trade_id, 100ULL);
+    EXPECT_EQ(compact.last_trade_id(), 105ULL);
+    EXPECT_TRUE(compact.is_buyer_maker());
+    EXPECT_DOUBLE_EQ(compact.price, 0.001);
+}
+
+TEST(compact_types_test_t, TickerDerivedFields) {
+    OwnedListener listener;
+    std::string_view message = R"({"e":"24hrTicker","E":1234567890,"s":"ETHUSDT","p":"150.50","P":"4.52","w":"3320.75","c":"3500.50","Q":"25.5","o":"3350.00","h":"3600.00","l":"3300.00","v":"125000.5","q":"415000000.25","O":1234467890,"C":1234567890,"F":1000000,"L":1050000,"n":50001})";
+    ASSERT_TRUE(binance_future_parser_t::parse(std::chrono::system_clock::now(), message, listener));
+
+    ticker_compact_t compact(listener.ticker.view());
+    EXPECT_EQ(compact.symbol.view(), "ETHUSDT");
+    EXPECT_DOUBLE_EQ(compact.last_price, 3500.50);
+    EXPECT_DOUBLE_EQ(compact.total_traded_quote_volume, 415000000.25);
+    EXPECT_EQ(compact.statistics_open_time(), 1234467890ULL);
+    EXPECT_EQ(compact.statistics_close_time(), 1234567890ULL);
+    EXPECT_EQ(compact.first_trade_id(), 1000000ULL);
+    EXPECT_EQ(compact.last_trade_id, 1050000ULL);
+    EXPECT_EQ(compact.total_trades, 50001U);
+}
+
+TEST(compact_types_test_t, TickerTradeIdsDoNotDependOnTradeCount) {
+    OwnedListener listener;
+
+    // No trade in the window: F = L = -1 and n = 0
+    std::string_view idle = R"({"e":"24hrTicker","E":1760083106579,"s":"NEWUSDT","p":"0","P":"0","w":"0","c":"0","Q":"0","o":"0","h":"0","l":"0","v":"0","q":"0","O":1759996706579,"C":1760083106578,"F":-1,"L":-1,"n":0})";
+    ASSERT_TRUE(binance_future_parser_t::parse(std::chrono::system_clock::now(), idle, listener));
+    ticker_t ticker = listener.ticker.view();
+    ticker_compact_t compact(ticker);
+    EXPECT_EQ(compact.total_trades, 0U);
+    EXPECT_EQ(compact.first_trade_id(), ticker.first_trade_id);
+    EXPECT_EQ(compact.last_trade_id, ticker.last_trade_id);
+    EXPECT_EQ(compact.statistics_close_time(), 1760083106578ULL);
+    EXPECT_EQ(compact.statistics_open_time(), 1759996706579ULL);
+
+    // n is not L - F + 1
+    std::string_view sparse = R"({"e":"24hrTicker","E":1760083106579,"s":"BTCUSDT","p":"0","P":"0","w":"0","c":"0","Q":"0","o":"0","h":"0","l":"0","v":"0","q":"0","O":1759996706579,"C":1760083106579,"F":6000000000,"L":6000000100,"n":42})";
+    ASSERT_TRUE(binance_future_parser_t::parse(std::chrono::system_clock::now(), sparse, listener));
+    compact = ticker_compact_t(listener.ticker.view());
+    EXPECT_EQ(compact.first_trade_id(), 6000000000ULL);
+    EXPECT_EQ(compact.last_trade_id, 6000000100ULL);
+    EXPECT_EQ(compact.total_trades, 42U);
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,95 @@
+/**
+ * @file warm_tests.cpp
+ * @author Kevin Rodrigues
+ * @brief Tests for parser warming with synthetic messages
+ * @version 1.0
+ * @date 16/10/2026
+ */
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include <faster_parser/binance/warm.h>
+
+using namespace core::faster_parser::binance;
+using namespace core::faster_parser::binance::types;
+
+namespace {
+    class RecordingListener {
+    public:
+        std::vector<std::string> symbols;
+
+        void on_book_ticker(const book_ticker_t &ticker) { symbols.emplace_back(ticker.symbol); }
+        void on_trade(const trade_t &trade) { symbols.emplace_back(trade.symbol); }
+        void on_ticker(const ticker_t &ticker) { symbols.emplace_back(ticker.symbol); }
+        void on_depth_update(const depth_update_t &update) { symbols.emplace_back(update.symbol); }
+    };
+
+    struct BookTickerOnly {
+        void on_book_ticker(const book_ticker_t &) {}
+    };
+
+    struct TradeAndDepth {
+        void on_trade(const trade_t &) {}
+        void on_depth_update(const depth_update_t &) {}
+    };
+}
+
+// ============================================================================
+// Synthetic messages
+// ============================================================================
+
+TEST(warm_test_t, SyntheticMessagesParse) {
+    RecordingListener listener;
+    const auto now = std::chrono::system_clock::now();
+    const size_t fed = warm_with<RecordingListener>([&](std::string_view raw) {
+        EXPECT_TRUE(binance_future_parser_t::parse(now, raw, listener)) << raw;
+    });
+
+    EXPECT_EQ(fed, 8U);
+    const std::vector<std::string> expected = {"BTCUSDT", "1000PEPEUSDT", "BTCUSDT", "ETHUSDT",
+                                               "BTCUSDT", "ETHUSDT", "BTCUSDT", "ETHUSDT"};
+    EXPECT_EQ(listener.symbols, expected);
+}
+
+TEST(warm_test_t, FeedsOnlyEnabledTypes) {
+    std::vector<std::string> fed;
+    auto record = [&](std::string_view raw) { fed.emplace_back(raw); };
+
+    EXPECT_EQ(warm_with<BookTickerOnly>(record), 2U);
+    for (auto const &raw : fed) EXPECT_TRUE(raw.starts_with(R"({"e":"bookTicker")")) << raw;
+
+    fed.clear();
+    EXPECT_EQ(warm_with<TradeAndDepth>(record), 4U);
+    for (auto const &raw : fed) {
+        EXPECT_TRUE(raw.starts_with(R"({"e":"aggTrade")") || raw.starts_with(R"({"e":"depthUpdate")")) << raw;
+    }
+}
+
+// ============================================================================
+// warm() and the discarding listener
+// ============================================================================
+
+TEST(warm_test_t, DiscardingListenerMirrorsCallbacks) {
+    static_assert(BookTickerListener<discarding_listener_t<BookTickerOnly>>);
+    static_assert(!TradeListener<discarding_listener_t<BookTickerOnly>>);
+    static_assert(!TickerListener<discarding_listener_t<BookTickerOnly>>);
+    static_assert(!DepthListener<discarding_listener_t<BookTickerOnly>>);
+
+    static_assert(TradeListener<discarding_listener_t<TradeAndDepth>>);
+    static_assert(DepthListener<discarding_listener_t<TradeAndDepth>>);
+    static_assert(!BookTickerListener<discarding_listener_t<TradeAndDepth>>);
+}
+
+TEST(warm_test_t, ParsesEveryEnabledMessage) {
+    EXPECT_EQ(warm<RecordingListener>(), 8U);
+    EXPECT_EQ(warm<BookTickerOnly>(), 2U);
+    EXPECT_EQ(warm<TradeAndDepth>(), 4U);
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
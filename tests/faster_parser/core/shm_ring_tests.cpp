@@ -0,0 +1,165 @@
+/**
+ * @file shm_ring_tests.cpp
+ * @author Kevin Rodrigues
+ * @brief Tests for the shared-memory broadcast ring
+ * @version 1.0
+ * @date 16/10/2026
+ */
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <faster_parser/core/shm_ring.h>
+
+using namespace core::faster_parser;
+
+namespace {
+    struct message_t {
+        uint64_t id;
+        uint64_t check;
+    };
+
+    std::string ring_name(const char *test) {
+        return "/faster_parser_" + std::string(test) + "_" + std::to_string(::getpid());
+    }
+}
+
+TEST(shm_ring_test_t, ReaderSeesEventsPublishedAfterItOpened) {
+    const std::string name = ring_name("open");
+    shm_ring_writer_t<message_t> writer;
+    ASSERT_TRUE(writer.create(name.c_str(), 16));
+    writer.push({1, 1});
+
+    shm_ring_reader_t<message_t> reader;
+    ASSERT_TRUE(reader.open(name.c_str()));
+    EXPECT_TRUE(reader.registered());
+    EXPECT_EQ(reader.capacity(), 16U);
+    EXPECT_EQ(reader.lag(), 0U);
+
+    for (uint64_t i = 2; i <= 5; ++i) writer.push({i, i * 3});
+
+    std::vector<uint64_t> ids;
+    EXPECT_EQ(reader.poll([&](message_t const &message) {
+        EXPECT_EQ(message.check, message.id * 3);
+        ids.push_back(message.id);
+    }), 4U);
+    EXPECT_EQ(ids, (std::vector<uint64_t>{2, 3, 4, 5}));
+
+    message_t message{};
+    EXPECT_FALSE(reader.try_read(message));
+    EXPECT_EQ(reader.lost(), 0U);
+}
+
+TEST(shm_ring_test_t, OpenRejectsMissingOrMismatchedRings) {
+    const std::string name = ring_name("mismatch");
+    shm_ring_reader_t<message_t> reader;
+    EXPECT_FALSE(reader.open(name.c_str()));
+
+    shm_ring_writer_t<message_t> writer;
+    ASSERT_TRUE(writer.create(name.c_str(), 8));
+
+    struct alignas(64) other_t { char bytes[128]; };
+    shm_ring_reader_t<other_t> wrong;
+    EXPECT_FALSE(wrong.open(name.c_str()));
+
+    writer.close();
+    EXPECT_FALSE(reader.open(name.c_str()));
+}
+
+TEST(shm_ring_test_t, LappedReaderSkipsToTheWriterAndCountsLostEvents) {
+    const std::string name = ring_name("lapped");
+    shm_ring_writer_t<message_t> writer;
+    ASSERT_TRUE(writer.create(name.c_str(), 8));
+    shm_ring_reader_t<message_t> reader;
+    ASSERT_TRUE(reader.open(name.c_str()));
+
+    for (uint64_t i = 0; i < 20; ++i) writer.push({i, 0});
+
+    EXPECT_EQ(reader.poll([](message_t const &) {}), 0U);
+    EXPECT_EQ(reader.lost(), 20U);
+    EXPECT_EQ(reader.overruns(), 1U);
+
+    writer.push({20, 0});
+    message_t message{};
+    ASSERT_TRUE(reader.try_read(message));
+    EXPECT_EQ(message.id, 20U);
+}
+
+TEST(shm_ring_test_t, WriterListsSlowReaders) {
+    const std::string name = ring_name("slow");
+    shm_ring_writer_t<message_t> writer;
+    ASSERT_TRUE(writer.create(name.c_str(), 64));
+
+    shm_ring_reader_t<message_t> fast;
+    shm_ring_reader_t<message_t> slow;
+    ASSERT_TRUE(fast.open(name.c_str()));
+    ASSERT_TRUE(slow.open(name.c_str()));
+    EXPECT_EQ(writer.readers(), 2U);
+
+    for (uint64_t i = 0; i < 40; ++i) writer.push({i, 0});
+    fast.poll([](message_t const &) {});
+
+    EXPECT_EQ(writer.slow_readers(10), 1U);
+    std::vector<uint64_t> lags;
+    writer.for_each_reader([&](int32_t pid, uint64_t lag) {
+        EXPECT_EQ(pid, ::getpid());
+        lags.push_back(lag);
+    });
+    std::sort(lags.begin(), lags.end());
+    EXPECT_EQ(lags, (std::vector<uint64_t>{0, 40}));
+
+    slow.close();
+    EXPECT_EQ(writer.readers(), 1U);
+    EXPECT_EQ(writer.slow_readers(10), 0U);
+}
+
+TEST(shm_ring_test_t, ReaderProcessesReceiveEveryEvent) {
+    const std::string name = ring_name("fork");
+    constexpr uint64_t count = 100'000;
+    constexpr int readers = 3;
+
+    shm_ring_writer_t<message_t> writer;
+    ASSERT_TRUE(writer.create(name.c_str(), 1 << 17));
+
+    std::vector<pid_t> children;
+    for (int i = 0; i < readers; ++i) {
+        pid_t pid = ::fork();
+        ASSERT_GE(pid, 0);
+        if (pid == 0) {
+            shm_ring_reader_t<message_t> reader;
+            if (!reader.open(name.c_str())) ::_exit(2);
+            // Attached before the first event: the parent waits for every reader to register
+            uint64_t expected = 0;
+            bool ok = true;
+            while (expected < count && reader.lost() == 0) {
+                reader.poll([&](message_t const &message) {
+                    ok &= message.id == expected && message.check == ~expected;
+                    ++expected;
+                });
+            }
+            ::_exit(ok && reader.lost() == 0 ? 0 : 1);
+        }
+        children.push_back(pid);
+    }
+
+    while (writer.readers() < readers) ::usleep(100);
+    for (uint64_t i = 0; i < count; ++i) writer.push({i, ~i});
+
+    for (pid_t pid : children) {
+        int status = 0;
+        ASSERT_EQ(::waitpid(pid, &status, 0), pid);
+        ASSERT_TRUE(WIFEXITED(status));
+        EXPECT_EQ(WEXITSTATUS(status), 0);
+    }
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,113 @@
+/**
+ * @file spsc_ring_tests.cpp
+ * @author Kevin Rodrigues
+ * @brief Tests for the single-producer single-consumer ring
+ * @version 1.0
+ * @date 16/10/2026
+ */
+
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include <faster_parser/core/spsc_ring.h>
+
+using namespace core::faster_parser;
+
+TEST(spsc_ring_test_t, RoundsCapacityToPowerOfTwo) {
+    EXPECT_EQ(spsc_ring_t<uint64_t>(1000).capacity(), 1024U);
+    EXPECT_EQ(spsc_ring_t<uint64_t>(1024).capacity(), 1024U);
+    EXPECT_EQ(spsc_ring_t<uint64_t>(0).capacity(), 2U);
+}
+
+TEST(spsc_ring_test_t, SlotsAreInvisibleUntilPublished) {
+    spsc_ring_t<uint64_t> ring(8);
+    uint64_t value = 0;
+
+    ASSERT_TRUE(ring.try_push(1));
+    ASSERT_TRUE(ring.try_push(2));
+    EXPECT_EQ(ring.unpublished(), 2U);
+    EXPECT_FALSE(ring.try_pop(value));
+
+    ring.publish();
+    EXPECT_EQ(ring.unpublished(), 0U);
+    EXPECT_EQ(ring.size(), 2U);
+    ASSERT_TRUE(ring.try_pop(value));
+    EXPECT_EQ(value, 1U);
+    ASSERT_TRUE(ring.try_pop(value));
+    EXPECT_EQ(value, 2U);
+    EXPECT_TRUE(ring.empty());
+}
+
+TEST(spsc_ring_test_t, FullRingRejectsUntilConsumed) {
+    spsc_ring_t<uint64_t> ring(4);
+    for (uint64_t i = 0; i < 4; ++i) {
+        ASSERT_TRUE(ring.try_push(i));
+    }
+    EXPECT_EQ(ring.next_slot(), nullptr);
+    EXPECT_FALSE(ring.try_push(4));
+    ring.publish();
+
+    EXPECT_EQ(ring.consume([](uint64_t) {}, 1), 1U);
+    EXPECT_TRUE(ring.try_push(4));
+}
+
+TEST(spsc_ring_test_t, ConsumesInBatchesAcrossWrapAround) {
+    spsc_ring_t<uint64_t> ring(8);
+    std::vector<uint64_t> seen;
+    uint64_t next = 0;
+
+    for (int round = 0; round < 10; ++round) {
+        for (int i = 0; i < 5; ++i) {
+            // Write in place
+            uint64_t *slot = ring.next_slot();
+            ASSERT_NE(slot, nullptr);
+            *slot = next++;
+            ring.commit();
+        }
+        ring.publish();
+        EXPECT_EQ(ring.consume([&](uint64_t v) { seen.push_back(v); }, 3), 3U);
+        EXPECT_EQ(ring.consume([&](uint64_t v) { seen.push_back(v); }), 2U);
+    }
+
+    ASSERT_EQ(seen.size(), 50U);
+    for (uint64_t i = 0; i < seen.size(); ++i) {
+        EXPECT_EQ(seen[i], i);
+    }
+}
+
+TEST(spsc_ring_test_t, TransfersInOrderBetweenThreads) {
+    constexpr uint64_t count = 1'000'000;
+    spsc_ring_t<uint64_t> ring(1024);
+
+    std::thread producer([&] {
+        for (uint64_t i = 0; i < count; ++i) {
+            while (!ring.try_push(i)) {
+                ring.publish();
+                std::this_thread::yield();
+            }
+            if ((i & 15) == 15) ring.publish();
+        }
+        ring.publish();
+    });
+
+    uint64_t expected = 0;
+    bool in_order = true;
+    while (expected < count) {
+        size_t consumed = ring.consume([&](uint64_t v) {
+            in_order &= v == expected;
+            ++expected;
+        });
+        if (consumed == 0) std::this_thread::yield();
+    }
+    producer.join();
+
+    EXPECT_TRUE(in_order);
+    EXPECT_TRUE(ring.empty());
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
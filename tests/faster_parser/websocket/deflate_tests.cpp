@@ -0,0 +1,268 @@
+/**
+ * @file deflate_tests.cpp
+ * @author Kevin Rodrigues
+ * @brief Tests for permessage-deflate decompression and the compressed Binance WebSocket feed
+ * @version 1.0
+ * @date 16/10/2026
+ */
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include <faster_parser/binance/websocket.h>
+#include <faster_parser/websocket/deflate.h>
+#include <faster_parser/websocket/frame.h>
+
+using namespace core::faster_parser::websocket;
+using namespace core::faster_parser::binance;
+using namespace core::faster_parser::binance::types;
+
+namespace {
+    const std::string agg_trade_message = R"({"e":"aggTrade","E":123456789,"s":"BTCUSDT","a":5933014,"p":"0.001","q":"100","f":100,"l":105,"T":123456785,"m":true})";
+    const std::string book_ticker_message = R"({"e":"bookTicker","u":400900217,"s":"BNBUSDT","b":"25.35190000","B":"31.21000000","a":"25.36520000","A":"40.66000000","T":1568014460891,"E":1568014460893})";
+
+    class RecordingListener {
+    public:
+        std::vector<trade_t> trades;
+        std::vector<book_ticker_t> book_tickers;
+
+        void on_trade(const trade_t &trade) { trades.push_back(trade); }
+        void on_book_ticker(const book_ticker_t &ticker) { book_tickers.push_back(ticker); }
+    };
+
+    std::string make_compressed_frame(deflater_t &deflater, std::string_view message) {
+        std::string compressed;
+        EXPECT_TRUE(deflater.deflate(message, compressed));
+        std::string frame;
+        encode_frame(frame, opcode_t::text, compressed, 0, true, true);
+        return frame;
+    }
+}
+
+// ============================================================================
+// inflater_t
+// ============================================================================
+
+TEST(websocket_deflate_test_t, RoundTripsMessages) {
+    deflater_t deflater;
+    inflater_t inflater;
+
+    for (std::string const &message : {agg_trade_message, book_ticker_message, agg_trade_message}) {
+        std::string compressed;
+        ASSERT_TRUE(deflater.deflate(message, compressed));
+
+        std::string_view out;
+        ASSERT_TRUE(inflater.inflate(compressed, out));
+        EXPECT_EQ(out, message);
+    }
+    EXPECT_EQ(inflater.total_out(), 2 * agg_trade_message.size() + book_ticker_message.size());
+}
+
+TEST(websocket_deflate_test_t, ContextTakeoverShrinksRepeatedMessages) {
+    deflater_t deflater;
+    inflater_t inflater;
+
+    std::string first;
+    std::string second;
+    ASSERT_TRUE(deflater.deflate(agg_trade_message, first));
+    ASSERT_TRUE(deflater.deflate(agg_trade_message, second));
+    // The second message is a back reference into the shared window
+    EXPECT_LT(second.size(), first.size() / 2);
+
+    std::string_view out;
+    ASSERT_TRUE(inflater.inflate(first, out));
+    ASSERT_TRUE(inflater.inflate(second, out));
+    EXPECT_EQ(out, agg_trade_message);
+
+    // Without the first message the window is missing and the second cannot be inflated
+    inflater_t fresh;
+    EXPECT_FALSE(fresh.inflate(second, out));
+}
+
+TEST(websocket_deflate_test_t, NoContextTakeoverIsIndependentPerMessage) {
+    deflater_t deflater(15, Z_DEFAULT_COMPRESSION, true);
+
+    std::string first;
+    std::string second;
+    ASSERT_TRUE(deflater.deflate(agg_trade_message, first));
+    ASSERT_TRUE(deflater.deflate(agg_trade_message, second));
+
+    inflater_t inflater(15, true);
+    std::string_view out;
+    ASSERT_TRUE(inflater.inflate(second, out));
+    EXPECT_EQ(out, agg_trade_message);
+}
+
+TEST(websocket_deflate_test_t, GrowsOutputBufferAndPadsIt) {
+    std::string large;
+    while (large.size() < 300 * 1024) large += book_ticker_message;
+
+    deflater_t deflater;
+    std::string compressed;
+    ASSERT_TRUE(deflater.deflate(large, compressed));
+
+    inflater_t inflater(15, false, 1024);
+    std::string_view out;
+    ASSERT_TRUE(inflater.inflate(compressed, out));
+    ASSERT_EQ(out, large);
+    for (size_t i = 0; i < inflater_t::padding; ++i) {
+        EXPECT_EQ(out.data()[out.size() + i], '\0');
+    }
+}
+
+TEST(websocket_deflate_test_t, InflatesMessageEndingInFinalBlock) {
+    // RFC 7692 allows a sender to end a message with a final (BFINAL) block instead of a sync flush
+    auto finish = [](std::string_view message) {
+        z_stream stream{};
+        EXPECT_EQ(deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, -15, 8, Z_DEFAULT_STRATEGY), Z_OK);
+        std::string compressed(deflateBound(&stream, static_cast<uLong>(message.size())), '\0');
+        stream.next_in = reinterpret_cast<Bytef *>(const_cast<char *>(message.data()));
+        stream.avail_in = static_cast<uInt>(message.size());
+        stream.next_out = reinterpret_cast<Bytef *>(compressed.data());
+        stream.avail_out = static_cast<uInt>(compressed.size());
+        EXPECT_EQ(deflate(&stream, Z_FINISH), Z_STREAM_END);
+        compressed.resize(compressed.size() - stream.avail_out);
+        deflateEnd(&stream);
+        return compressed;
+    };
+
+    inflater_t inflater;
+    std::string_view out;
+    ASSERT_TRUE(inflater.inflate(finish(book_ticker_message), out));
+    EXPECT_EQ(out, book_ticker_message);
+
+    // The next message starts a new stream, final block or not
+    ASSERT_TRUE(inflater.inflate(finish(agg_trade_message), out));
+    EXPECT_EQ(out, agg_trade_message);
+    deflater_t deflater;
+    std::string compressed;
+    ASSERT_TRUE(deflater.deflate(book_ticker_message, compressed));
+    ASSERT_TRUE(inflater.inflate(compressed, out));
+    EXPECT_EQ(out, book_ticker_message);
+}
+
+TEST(websocket_deflate_test_t, RejectsOutputAboveLimit) {
+    // 1 MB of repeated messages compresses to a few KB
+    std::string large;
+    while (large.size() < 1024 * 1024) large += book_ticker_message;
+    deflater_t deflater(15, Z_DEFAULT_COMPRESSION, true);
+    std::string compressed;
+    ASSERT_TRUE(deflater.deflate(large, compressed));
+    ASSERT_LT(compressed.size(), 64U * 1024);
+
+    inflater_t inflater(15, true, 1024, 256 * 1024);
+    std::string_view out;
+    EXPECT_FALSE(inflater.inflate(compressed, out));
+
+    // The window is reset after the failure: the next message inflates
+    ASSERT_TRUE(deflater.deflate(agg_trade_message, compressed));
+    ASSERT_TRUE(inflater.inflate(compressed, out));
+    EXPECT_EQ(out, agg_trade_message);
+}
+
+TEST(websocket_deflate_test_t, RejectsCorruptInput) {
+    inflater_t inflater;
+    const std::string garbage = "\xff\xff\xff\xff\xff\xff";
+    std::string_view out;
+    EXPECT_FALSE(inflater.inflate(garbage, out));
+}
+
+// ============================================================================
+// websocket_feed_t with permessage-deflate
+// ============================================================================
+
+TEST(websocket_deflate_feed_test_t, ParsesCompressedFrames) {
+    deflater_t deflater;
+    std::string buffer;
+    for (int i = 0; i < 3; ++i) {
+        buffer += make_compressed_frame(deflater, agg_trade_message);
+        buffer += make_compressed_frame(deflater, book_ticker_message);
+    }
+
+    RecordingListener listener;
+    websocket_feed_t feed(listener);
+    feed.enable_permessage_deflate();
+
+    size_t consumed = feed.feed(std::chrono::system_clock::now(), std::span<char>(buffer.data(), buffer.size()));
+    EXPECT_EQ(consumed, buffer.size());
+    EXPECT_FALSE(feed.failed());
+    EXPECT_EQ(feed.rejected(), 0U);
+
+    ASSERT_EQ(listener.trades.size(), 3U);
+    ASSERT_EQ(listener.book_tickers.size(), 3U);
+    EXPECT_EQ(listener.trades.back().agg_trade_id, 5933014U);
+    EXPECT_EQ(listener.book_tickers.back().bid.sequence, 400900217U);
+    EXPECT_LT(feed.compressed_bytes(), feed.inflated_bytes());
+}
+
+TEST(websocket_deflate_feed_test_t, ParsesFragmentedCompressedMessage) {
+    deflater_t deflater;
+    std::string compressed;
+    ASSERT_TRUE(deflater.deflate(agg_trade_message, compressed));
+
+    // RSV1 is set on the first fragment only
+    const size_t half = compressed.size() / 2;
+    std::string buffer;
+    encode_frame(buffer, opcode_t::text, std::string_view(compressed).substr(0, half), 0, false, true);
+    encode_frame(buffer, opcode_t::continuation, std::string_view(compressed).substr(half), 0, true, false);
+
+    RecordingListener listener;
+    websocket_feed_t feed(listener);
+    feed.enable_permessage_deflate();
+
+    EXPECT_EQ(feed.feed(std::chrono::system_clock::now(), std::span<char>(buffer.data(), buffer.size())), buffer.size());
+    ASSERT_EQ(listener.trades.size(), 1U);
+    EXPECT_EQ(listener.trades[0].agg_trade_id, 5933014U);
+}
+
+TEST(websocket_deflate_feed_test_t, MixesCompressedAndPlainFrames) {
+    deflater_t deflater;
+    std::string buffer = make_compressed_frame(deflater, agg_trade_message);
+    encode_frame(buffer, opcode_t::text, book_ticker_message);
+
+    RecordingListener listener;
+    websocket_feed_t feed(listener);
+    feed.enable_permessage_deflate();
+
+    EXPECT_EQ(feed.feed(std::chrono::system_clock::now(), std::span<char>(buffer.data(), buffer.size())), buffer.size());
+    EXPECT_EQ(listener.trades.size(), 1U);
+    EXPECT_EQ(listener.book_tickers.size(), 1U);
+}
+
+TEST(websocket_deflate_feed_test_t, ResetStartsNewCompressedStream) {
+    RecordingListener listener;
+    websocket_feed_t feed(listener);
+    feed.enable_permessage_deflate();
+
+    for (int connection = 0; connection < 2; ++connection) {
+        // A new connection starts with an empty window on both sides
+        deflater_t deflater;
+        std::string buffer = make_compressed_frame(deflater, agg_trade_message);
+        buffer += make_compressed_frame(deflater, agg_trade_message);
+
+        feed.reset();
+        EXPECT_EQ(feed.feed(std::chrono::system_clock::now(), std::span<char>(buffer.data(), buffer.size())), buffer.size());
+    }
+
+    EXPECT_EQ(listener.trades.size(), 4U);
+    EXPECT_EQ(feed.rejected(), 0U);
+}
+
+TEST(websocket_deflate_feed_test_t, CompressedFrameWithoutNegotiationFails) {
+    deflater_t deflater;
+    std::string buffer = make_compressed_frame(deflater, agg_trade_message);
+
+    RecordingListener listener;
+    websocket_feed_t feed(listener);
+
+    EXPECT_EQ(feed.feed(std::chrono::system_clock::now(), std::span<char>(buffer.data(), buffer.size())), 0U);
+    EXPECT_TRUE(feed.failed());
+    EXPECT_TRUE(listener.trades.empty());
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
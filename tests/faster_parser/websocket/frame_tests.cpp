@@ -0,0 +1,300 @@
+/**
+ * @file frame_tests.cpp
+ * @author Kevin Rodrigues
+ * @brief Tests for the WebSocket frame decoder and the Binance WebSocket feed
+ * @version 1.0
+ * @date 16/10/2026
+ */
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <faster_parser/binance/websocket.h>
+#include <faster_parser/websocket/frame.h>
+
+using namespace core::faster_parser::websocket;
+using namespace core::faster_parser::binance;
+using namespace core::faster_parser::binance::types;
+
+namespace {
+    const std::string agg_trade_message = R"({"e":"aggTrade","E":123456789,"s":"BTCUSDT","a":5933014,"p":"0.001","q":"100","f":100,"l":105,"T":123456785,"m":true})";
+    const std::string book_ticker_message = R"({"e":"bookTicker","u":400900217,"s":"BNBUSDT","b":"25.35190000","B":"31.21000000","a":"25.36520000","A":"40.66000000","T":1568014460891,"E":1568014460893})";
+
+    class RecordingHandler {
+    public:
+        std::vector<std::string> texts;
+        std::vector<std::string> binaries;
+        std::vector<std::string> pings;
+        std::vector<std::string> pongs;
+        uint16_t close_code = 0;
+        std::string close_reason;
+        const char *last_text_data = nullptr;
+
+        void on_text(std::string_view payload) {
+            texts.emplace_back(payload);
+            last_text_data = payload.data();
+        }
+
+        void on_binary(std::string_view payload) { binaries.emplace_back(payload); }
+        void on_ping(std::string_view payload) { pings.emplace_back(payload); }
+        void on_pong(std::string_view payload) { pongs.emplace_back(payload); }
+
+        void on_close(uint16_t code, std::string_view reason) {
+            close_code = code;
+            close_reason = reason;
+        }
+    };
+
+    class TextOnlyHandler {
+    public:
+        size_t texts = 0;
+        void on_text(std::string_view) { ++texts; }
+    };
+
+    class RecordingTradeListener {
+    public:
+        std::vector<trade_t> trades;
+        size_t pings = 0;
+
+        void on_trade(const trade_t &trade) { trades.push_back(trade); }
+        void on_ping(std::string_view) { ++pings; }
+    };
+}
+
+// ============================================================================
+// Header and unmask
+// ============================================================================
+
+TEST(websocket_frame_test_t, ParsesHeaderLengthEncodings) {
+    for (size_t length : {size_t{0}, size_t{125}, size_t{126}, size_t{65535}, size_t{65536}}) {
+        std::string frame;
+        encode_frame(frame, opcode_t::text, std::string(length, 'x'));
+
+        frame_header_t header;
+        ASSERT_EQ(parse_header(frame.data(), frame.size(), header), header_status_t::ok);
+        EXPECT_TRUE(header.fin);
+        EXPECT_EQ(header.opcode, opcode_t::text);
+        EXPECT_FALSE(header.masked);
+        EXPECT_EQ(header.payload_length, length);
+        EXPECT_EQ(header.header_size + length, frame.size());
+
+        for (size_t available = 0; available < header.header_size; ++available) {
+            EXPECT_EQ(parse_header(frame.data(), available, header), header_status_t::incomplete);
+        }
+    }
+}
+
+TEST(websocket_frame_test_t, RejectsInvalidHeaders) {
+    frame_header_t header;
+    const char reserved_bit[] = {static_cast<char>(0xA1), 0x00};
+    const char compressed_ping[] = {static_cast<char>(0xC9), 0x00};
+    const char unknown_opcode[] = {static_cast<char>(0x83), 0x00};
+    const char fragmented_ping[] = {0x09, 0x00};
+    const char long_ping[] = {static_cast<char>(0x89), 126, 0x00, 126};
+
+    EXPECT_EQ(parse_header(reserved_bit, 2, header), header_status_t::invalid);
+    EXPECT_EQ(parse_header(compressed_ping, 2, header), header_status_t::invalid);
+    EXPECT_EQ(parse_header(unknown_opcode, 2, header), header_status_t::invalid);
+    EXPECT_EQ(parse_header(fragmented_ping, 2, header), header_status_t::invalid);
+    EXPECT_EQ(parse_header(long_ping, 4, header), header_status_t::invalid);
+}
+
+TEST(websocket_frame_test_t, UnmaskMatchesScalarForAllLengths) {
+    const uint32_t key = 0x9A3C51E7;
+    uint8_t key_bytes[4];
+    std::memcpy(key_bytes, &key, 4);
+
+    for (size_t length = 0; length < 200; ++length) {
+        std::string data(length, '\0');
+        for (size_t i = 0; i < length; ++i) data[i] = static_cast<char>(i * 31 + 7);
+        std::string expected = data;
+        for (size_t i = 0; i < length; ++i) expected[i] = static_cast<char>(static_cast<uint8_t>(expected[i]) ^ key_bytes[i & 3]);
+
+        unmask(data.data(), data.size(), key);
+        EXPECT_EQ(data, expected) << "length " << length;
+    }
+}
+
+// ============================================================================
+// Decoder
+// ============================================================================
+
+TEST(websocket_frame_test_t, DecodesTextFramesInPlace) {
+    std::string buffer;
+    encode_frame(buffer, opcode_t::text, agg_trade_message);
+    encode_frame(buffer, opcode_t::text, book_ticker_message);
+
+    frame_decoder_t decoder;
+    RecordingHandler handler;
+    EXPECT_EQ(decoder.decode(buffer, handler), buffer.size());
+
+    ASSERT_EQ(handler.texts.size(), 2U);
+    EXPECT_EQ(handler.texts[0], agg_trade_message);
+    EXPECT_EQ(handler.texts[1], book_ticker_message);
+    // Zero copy: the payload view points into the receive buffer
+    EXPECT_EQ(handler.last_text_data, buffer.data() + buffer.size() - book_ticker_message.size());
+}
+
+TEST(websocket_frame_test_t, DecodesMaskedFrames) {
+    std::string buffer;
+    encode_frame(buffer, opcode_t::text, book_ticker_message, 0x11223344);
+
+    frame_decoder_t decoder;
+    RecordingHandler handler;
+    EXPECT_EQ(decoder.decode(buffer, handler), buffer.size());
+    ASSERT_EQ(handler.texts.size(), 1U);
+    EXPECT_EQ(handler.texts[0], book_ticker_message);
+}
+
+TEST(websocket_frame_test_t, LeavesIncompleteFrameUnconsumed) {
+    std::string first, second;
+    encode_frame(first, opcode_t::text, agg_trade_message);
+    encode_frame(second, opcode_t::text, book_ticker_message);
+    std::string buffer = first + second.substr(0, 40);
+
+    frame_decoder_t decoder;
+    RecordingHandler handler;
+    EXPECT_EQ(decoder.decode(buffer, handler), first.size());
+    EXPECT_EQ(handler.texts.size(), 1U);
+
+    std::string rest = second;
+    EXPECT_EQ(decoder.decode(rest, handler), rest.size());
+    ASSERT_EQ(handler.texts.size(), 2U);
+    EXPECT_EQ(handler.texts[1], book_ticker_message);
+}
+
+TEST(websocket_frame_test_t, ReassemblesContinuationFramesAcrossControlFrames) {
+    std::string buffer;
+    encode_frame(buffer, opcode_t::text, std::string_view(agg_trade_message).substr(0, 30), 0, false);
+    encode_frame(buffer, opcode_t::ping, "hb");
+    encode_frame(buffer, opcode_t::continuation, std::string_view(agg_trade_message).substr(30, 50), 0x01020304, false);
+    encode_frame(buffer, opcode_t::continuation, std::string_view(agg_trade_message).substr(80), 0, true);
+    encode_frame(buffer, opcode_t::binary, "\x01\x02");
+
+    frame_decoder_t decoder;
+    RecordingHandler handler;
+    EXPECT_EQ(decoder.decode(buffer, handler), buffer.size());
+
+    ASSERT_EQ(handler.texts.size(), 1U);
+    EXPECT_EQ(handler.texts[0], agg_trade_message);
+    EXPECT_EQ(handler.pings, (std::vector<std::string>{"hb"}));
+    EXPECT_EQ(handler.binaries.size(), 1U);
+}
+
+TEST(websocket_frame_test_t, DeliversControlFrames) {
+    std::string buffer;
+    encode_frame(buffer, opcode_t::pong, "p");
+    encode_frame(buffer, opcode_t::close, std::string("\x03\xE8") + "bye");
+
+    frame_decoder_t decoder;
+    RecordingHandler handler;
+    EXPECT_EQ(decoder.decode(buffer, handler), buffer.size());
+    EXPECT_EQ(handler.pongs, (std::vector<std::string>{"p"}));
+    EXPECT_EQ(handler.close_code, 1000);
+    EXPECT_EQ(handler.close_reason, "bye");
+
+    // Handlers without control callbacks still decode
+    TextOnlyHandler text_only;
+    std::string again;
+    encode_frame(again, opcode_t::ping, "");
+    encode_frame(again, opcode_t::text, "hello");
+    frame_decoder_t other;
+    EXPECT_EQ(other.decode(again, text_only), again.size());
+    EXPECT_EQ(text_only.texts, 1U);
+}
+
+TEST(websocket_frame_test_t, UnexpectedContinuationFails) {
+    std::string buffer;
+    encode_frame(buffer, opcode_t::text, "ok");
+    size_t valid = buffer.size();
+    encode_frame(buffer, opcode_t::continuation, "orphan");
+
+    frame_decoder_t decoder;
+    RecordingHandler handler;
+    EXPECT_EQ(decoder.decode(buffer, handler), valid);
+    EXPECT_TRUE(decoder.failed());
+
+    decoder.reset();
+    EXPECT_FALSE(decoder.failed());
+}
+
+TEST(websocket_frame_test_t, CompressedFrameRequiresNegotiation) {
+    std::string frame;
+    encode_frame(frame, opcode_t::text, "compressed", 0, true, true);
+
+    frame_header_t header;
+    ASSERT_EQ(parse_header(frame.data(), frame.size(), header), header_status_t::ok);
+    EXPECT_TRUE(header.compressed);
+
+    // RSV1 without permessage-deflate is a protocol error
+    frame_decoder_t strict;
+    RecordingHandler handler;
+    EXPECT_EQ(strict.decode(std::span<char>(frame.data(), frame.size()), handler), 0U);
+    EXPECT_TRUE(strict.failed());
+
+    // Negotiated, but the handler cannot inflate
+    frame_decoder_t negotiated;
+    negotiated.set_permessage_deflate(true);
+    EXPECT_EQ(negotiated.decode(std::span<char>(frame.data(), frame.size()), handler), 0U);
+    EXPECT_TRUE(negotiated.failed());
+    EXPECT_TRUE(handler.texts.empty());
+}
+
+// ============================================================================
+// Binance feed over a loopback socket
+// ============================================================================
+
+TEST(websocket_feed_test_t, ParsesFramesFromLoopbackServer) {
+    int sockets[2];
+    ASSERT_EQ(::socketpair(AF_UNIX, SOCK_STREAM, 0, sockets), 0);
+
+    constexpr size_t frames = 200;
+    std::thread server([fd = sockets[1]] {
+        // Server stand-in: unmasked frames written in small, frame-unaligned pieces
+        std::string stream;
+        for (size_t i = 0; i < frames; ++i) {
+            encode_frame(stream, opcode_t::text, agg_trade_message);
+            if (i % 50 == 0) encode_frame(stream, opcode_t::ping, "keepalive");
+        }
+        for (size_t offset = 0; offset < stream.size(); offset += 97) {
+            size_t length = std::min<size_t>(97, stream.size() - offset);
+            ASSERT_EQ(::write(fd, stream.data() + offset, length), static_cast<ssize_t>(length));
+        }
+        ::close(fd);
+    });
+
+    RecordingTradeListener listener;
+    websocket_feed_t feed(listener);
+    std::vector<char> ring(4096);
+    size_t filled = 0;
+    while (true) {
+        ssize_t received = ::read(sockets[0], ring.data() + filled, ring.size() - filled);
+        if (received <= 0) break;
+        filled += static_cast<size_t>(received);
+
+        size_t consumed = feed.feed(std::chrono::system_clock::now(), std::span(ring.data(), filled));
+        std::memmove(ring.data(), ring.data() + consumed, filled - consumed);
+        filled -= consumed;
+    }
+    server.join();
+    ::close(sockets[0]);
+
+    EXPECT_FALSE(feed.failed());
+    EXPECT_EQ(filled, 0U);
+    EXPECT_EQ(feed.rejected(), 0U);
+    EXPECT_EQ(listener.pings, 4U);
+    ASSERT_EQ(listener.trades.size(), frames);
+    EXPECT_EQ(listener.trades.back().agg_trade_id, 5933014U);
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}